@@ -3,6 +3,7 @@
 
 #include "ClusterApplication.h"
 #include "signal/VehicleSignals.h"
+#include <QDebug>
 #include <QTimer>
 #include <QRandomGenerator>
 #include <cmath>
@@ -31,6 +32,20 @@ ClusterApplication::ClusterApplication(signal::SignalHub* signalHub,
     // Initialize telltales
     m_telltaleManager->initializeDefaults();
 
+    // Range follows state of charge (~4km per %). Nothing else writes
+    // BatteryRange, so a rejected derivation would leave it NotAvailable.
+    const bool rangeDerived = m_signalHub->deriveSignal(
+        signal::Signals::BatteryRange::handle(),
+        {signal::Signals::BatterySoc::handle()},
+        [](const QVector<signal::SignalValue>& inputs) {
+            return signal::ScalarValue(inputs.at(0).toDouble() * 4.0);
+        });
+    if (!rangeDerived) {
+        qWarning() << "ClusterApplication: BatteryRange derivation rejected;"
+                   << "range will stay NotAvailable";
+    }
+    Q_ASSERT(rangeDerived);
+
     // Connect scheduler tick
     connect(m_scheduler, &sched::DeterministicScheduler::tick,
             this, &ClusterApplication::onSchedulerTick);
@@ -87,17 +102,10 @@ void ClusterApplication::startSimulation()
     m_simBattery = 75.0;
 
     // Set initial gear
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::GEAR_POSITION),
-        QStringLiteral("P"));
+    m_signalHub->set<signal::Signals::GearPosition>(QStringLiteral("P"));
 
     // Set initial battery
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::BATTERY_SOC),
-        m_simBattery);
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::BATTERY_RANGE),
-        m_simBattery * 4.0);  // ~4km per %
+    m_signalHub->set<signal::Signals::BatterySoc>(m_simBattery);
 
     m_simTimer->start();
     m_simulating = true;
@@ -136,8 +144,6 @@ void ClusterApplication::onSimulationTick()
         return;
     }
 
-    using namespace signal;
-
     // Simulate speed changes
     static int simTick = 0;
     simTick++;
@@ -151,8 +157,7 @@ void ClusterApplication::onSimulationTick()
     m_simSpeed += speedDiff * 0.02;  // Slower, smoother changes
     m_simSpeed = qBound(0.0, m_simSpeed, 200.0);
 
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::VEHICLE_SPEED), m_simSpeed);
+    m_signalHub->set<signal::Signals::VehicleSpeed>(m_simSpeed);
 
     // Simulate gear based on speed
     QString gear;
@@ -163,30 +168,23 @@ void ClusterApplication::onSimulationTick()
     } else {
         gear = QStringLiteral("D");  // Normal drive
     }
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::GEAR_POSITION), gear);
+    m_signalHub->set<signal::Signals::GearPosition>(gear);
 
     // Simulate battery drain
     if (simTick % 100 == 0 && m_simBattery > 10.0) {
         m_simBattery -= 0.1;
-        m_signalHub->updateSignal(
-            QString::fromLatin1(SignalIds::BATTERY_SOC), m_simBattery);
-        m_signalHub->updateSignal(
-            QString::fromLatin1(SignalIds::BATTERY_RANGE), m_simBattery * 4.0);
+        m_signalHub->set<signal::Signals::BatterySoc>(m_simBattery);
     }
 
     // Simulate power consumption
     double power = m_simSpeed * 0.5 + QRandomGenerator::global()->bounded(10);
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::POWER_CONSUMPTION), power);
+    m_signalHub->set<signal::Signals::PowerConsumption>(power);
 
     // Simulate turn signals - alternating left/right every 8 seconds
     bool leftTurn = (simTick / 160) % 2 == 0 && (simTick % 160) < 80;
     bool rightTurn = (simTick / 160) % 2 == 1 && (simTick % 160) < 80;
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::TELLTALE_TURN_LEFT), leftTurn);
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::TELLTALE_TURN_RIGHT), rightTurn);
+    m_signalHub->set<signal::Signals::TelltaleTurnLeft>(leftTurn);
+    m_signalHub->set<signal::Signals::TelltaleTurnRight>(rightTurn);
 
     // Debug output every 2 seconds
     if (simTick % 40 == 0) {
@@ -195,12 +193,10 @@ void ClusterApplication::onSimulationTick()
     }
 
     // Simulate low beam
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::TELLTALE_LOW_BEAM), true);
+    m_signalHub->set<signal::Signals::TelltaleLowBeam>(true);
 
     // Simulate outside temperature
-    m_signalHub->updateSignal(
-        QString::fromLatin1(SignalIds::OUTSIDE_TEMP), 22.0);
+    m_signalHub->set<signal::Signals::OutsideTemp>(22.0);
 }
 
 } // namespace driver
@@ -19,6 +19,7 @@
 #include "adas/AdasVisualQualityManager.h"
 
 #include "signal/SignalHub.h"
+#include "signal/SignalHubMirror.h"
 #include "signal/VehicleSignals.h"
 #include "sched/DeterministicScheduler.h"
 #include "sched/TimeSource.h"
@@ -51,6 +52,7 @@ int main(int argc, char *argv[])
     // Create signal hub
     signal::SignalHub signalHub;
     signal::VehicleSignalFactory::registerClusterSignals(signalHub);
+    signalHub.setCoalescingEnabled(true);  // At most one UI update per signal per tick
 
     // Create scheduler
     sched::DeterministicScheduler scheduler;
@@ -58,6 +60,14 @@ int main(int argc, char *argv[])
     // Create cluster application
     driver::ClusterApplication clusterApp(&signalHub, &scheduler);
 
+    // Same-SoC consumers (infotainment) read the signal table from shared memory
+    QString mirrorError;
+    if (!signalHub.exportSharedMirror(QString::fromLatin1(signal::SignalHubMirror::DEFAULT_KEY),
+                                      &mirrorError)) {
+        AUTO_LOG_WARNING(QStringLiteral("cluster"),
+                         QStringLiteral("Signal mirror unavailable: %1").arg(mirrorError));
+    }
+
     // Create view model for QML
     driver::ClusterViewModel viewModel(clusterApp.stateModel(),
                                         clusterApp.alertManager(),
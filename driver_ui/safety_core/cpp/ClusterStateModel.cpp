@@ -14,13 +14,33 @@ ClusterStateModel::ClusterStateModel(signal::SignalHub* signalHub, QObject* pare
 {
     Q_ASSERT(signalHub != nullptr);
 
-    connect(m_signalHub, &signal::SignalHub::signalUpdated,
-            this, &ClusterStateModel::onSignalUpdated);
+    using namespace signal;
+
+    auto resolve = [this](const char* id) {
+        return m_signalHub->signalHandle(QString::fromLatin1(id));
+    };
+    m_handles.speed = resolve(SignalIds::VEHICLE_SPEED);
+    m_handles.gear = resolve(SignalIds::GEAR_POSITION);
+    m_handles.batterySoc = resolve(SignalIds::BATTERY_SOC);
+    m_handles.batteryRange = resolve(SignalIds::BATTERY_RANGE);
+    m_handles.powerConsumption = resolve(SignalIds::POWER_CONSUMPTION);
+    m_handles.outsideTemp = resolve(SignalIds::OUTSIDE_TEMP);
+
+    // Targeted delivery: only the signals consumed below reach this model
+    m_subscription = m_signalHub->subscribe(
+        QVector<SignalHandle>{m_handles.speed, m_handles.gear, m_handles.batterySoc,
+                              m_handles.batteryRange, m_handles.powerConsumption,
+                              m_handles.outsideTemp},
+        [this](const SignalChange& change) { onSignalChanged(change); });
+
     connect(m_signalHub, &signal::SignalHub::degradedModeChanged,
             this, &ClusterStateModel::onDegradedModeChanged);
 }
 
-ClusterStateModel::~ClusterStateModel() = default;
+ClusterStateModel::~ClusterStateModel()
+{
+    m_signalHub->unsubscribe(m_subscription);
+}
 
 QString ClusterStateModel::speedDisplay() const
 {
@@ -45,8 +65,11 @@ void ClusterStateModel::processTick(uint64_t tickNumber, qint64 elapsedMs)
         emit timeDisplayChanged(m_timeDisplay);
     }
 
-    // Check for stale signals
-    m_signalHub->checkFreshness();
+    // Check for stale signals and publish coalesced changes
+    m_signalHub->processTick();
+
+    // Invalid count also moves for signals this model does not subscribe to
+    updateClusterState();
 }
 
 void ClusterStateModel::forceDegradedMode(bool degraded)
@@ -55,14 +78,16 @@ void ClusterStateModel::forceDegradedMode(bool degraded)
     updateClusterState();
 }
 
-void ClusterStateModel::onSignalUpdated(const QString& signalId,
-                                         const signal::SignalValue& value)
+void ClusterStateModel::onSignalChanged(const signal::SignalChange& change)
 {
     using namespace signal;
 
+    const SignalHandle handle = change.handle;
+    const SignalValue& value = change.value;
+
     // Speed update (SR-CL-001)
-    if (signalId == QString::fromLatin1(SignalIds::VEHICLE_SPEED)) {
-        double newSpeed = value.value.toDouble();
+    if (handle == m_handles.speed) {
+        double newSpeed = value.toDouble();
         bool newValid = value.isValid();
         bool newStale = value.validity == SignalValidity::Stale;
 
@@ -83,8 +108,8 @@ void ClusterStateModel::onSignalUpdated(const QString& signalId,
         }
     }
     // Gear update
-    else if (signalId == QString::fromLatin1(SignalIds::GEAR_POSITION)) {
-        QString newGear = value.value.toString().toUpper();
+    else if (handle == m_handles.gear) {
+        QString newGear = value.toString().toUpper();
         bool newValid = value.isValid();
 
         if (newGear != m_gear) {
@@ -103,8 +128,8 @@ void ClusterStateModel::onSignalUpdated(const QString& signalId,
         }
     }
     // Battery SOC
-    else if (signalId == QString::fromLatin1(SignalIds::BATTERY_SOC)) {
-        double newLevel = value.value.toDouble();
+    else if (handle == m_handles.batterySoc) {
+        double newLevel = value.toDouble();
         bool newValid = value.isValid();
 
         if (newLevel != m_batteryLevel) {
@@ -117,8 +142,8 @@ void ClusterStateModel::onSignalUpdated(const QString& signalId,
         }
     }
     // Range
-    else if (signalId == QString::fromLatin1(SignalIds::BATTERY_RANGE)) {
-        double newRange = value.value.toDouble();
+    else if (handle == m_handles.batteryRange) {
+        double newRange = value.toDouble();
         bool newValid = value.isValid();
 
         if (newRange != m_range) {
@@ -131,16 +156,16 @@ void ClusterStateModel::onSignalUpdated(const QString& signalId,
         }
     }
     // Power consumption
-    else if (signalId == QString::fromLatin1(SignalIds::POWER_CONSUMPTION)) {
-        double newPower = value.value.toDouble();
+    else if (handle == m_handles.powerConsumption) {
+        double newPower = value.toDouble();
         if (newPower != m_powerConsumption) {
             m_powerConsumption = newPower;
             emit powerConsumptionChanged(m_powerConsumption);
         }
     }
     // Outside temperature
-    else if (signalId == QString::fromLatin1(SignalIds::OUTSIDE_TEMP)) {
-        double newTemp = value.value.toDouble();
+    else if (handle == m_handles.outsideTemp) {
+        double newTemp = value.toDouble();
         if (newTemp != m_outsideTemp) {
             m_outsideTemp = newTemp;
             emit outsideTempChanged(m_outsideTemp);
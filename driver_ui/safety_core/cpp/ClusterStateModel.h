@@ -164,14 +164,25 @@ signals:
     void timeDisplayChanged(const QString& time);
 
 private slots:
-    void onSignalUpdated(const QString& signalId, const signal::SignalValue& value);
     void onDegradedModeChanged(bool degraded);
 
 private:
+    void onSignalChanged(const signal::SignalChange& change);
     void updateClusterState();
     DriveMode gearToDriveMode(const QString& gear) const;
 
     signal::SignalHub* m_signalHub{nullptr};
+    signal::SubscriptionId m_subscription{0};
+
+    // Handles of the signals this model consumes
+    struct SignalHandles {
+        signal::SignalHandle speed;
+        signal::SignalHandle gear;
+        signal::SignalHandle batterySoc;
+        signal::SignalHandle batteryRange;
+        signal::SignalHandle powerConsumption;
+        signal::SignalHandle outsideTemp;
+    } m_handles;
 
     // Speed state
     double m_speed{0.0};
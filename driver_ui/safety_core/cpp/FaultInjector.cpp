@@ -14,6 +14,11 @@ FaultInjector::FaultInjector(signal::SignalHub* signalHub, QObject* parent)
 {
     Q_ASSERT(signalHub != nullptr);
 
+    m_speedHandle = m_signalHub->signalHandle(
+        QString::fromLatin1(signal::SignalIds::VEHICLE_SPEED));
+    m_gearHandle = m_signalHub->signalHandle(
+        QString::fromLatin1(signal::SignalIds::GEAR_POSITION));
+
     connect(&m_scenarioTimer, &QTimer::timeout,
             this, &FaultInjector::onScenarioTick);
     connect(&m_durationTimer, &QTimer::timeout,
@@ -54,8 +59,7 @@ void FaultInjector::startScenario(int scenario, int durationMs)
     m_active = true;
 
     // Save current speed for restoration
-    auto speedSignal = m_signalHub->getSignal(
-        QString::fromLatin1(signal::SignalIds::VEHICLE_SPEED));
+    auto speedSignal = m_signalHub->getSignal(m_speedHandle);
     m_lastNormalSpeed = speedSignal.value.toDouble();
 
     // Start scenario timer
@@ -80,12 +84,8 @@ void FaultInjector::stopScenario()
     m_durationTimer.stop();
 
     // Restore normal signal updates
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::VEHICLE_SPEED),
-        m_lastNormalSpeed);
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::GEAR_POSITION),
-        QStringLiteral("D"));
+    m_signalHub->updateSignal(m_speedHandle, m_lastNormalSpeed);
+    m_signalHub->updateSignal(m_gearHandle, QStringLiteral("D"));
 
     m_active = false;
     m_scenario = FaultScenario::None;
@@ -135,17 +135,13 @@ void FaultInjector::injectStaleSpeed()
 
 void FaultInjector::injectOutOfRangeSpeed(double speed)
 {
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::VEHICLE_SPEED),
-        speed);  // Will be clamped by validation
+    m_signalHub->updateSignal(m_speedHandle, speed);  // Will be clamped by validation
     emit faultInjected(QString::fromLatin1("Injected out-of-range speed: %1").arg(speed));
 }
 
 void FaultInjector::injectInvalidGear()
 {
-    m_signalHub->updateSignal(
-        QString::fromLatin1(signal::SignalIds::GEAR_POSITION),
-        QStringLiteral("X"));  // Invalid gear
+    m_signalHub->updateSignal(m_gearHandle, QStringLiteral("X"));  // Invalid gear
     emit faultInjected(QStringLiteral("Injected invalid gear"));
 }
 
@@ -162,8 +158,6 @@ void FaultInjector::onScenarioTimeout()
 
 void FaultInjector::executeScenarioStep()
 {
-    using namespace signal;
-
     switch (m_scenario) {
     case FaultScenario::StaleSpeed:
         // Don't update speed - let it go stale
@@ -171,22 +165,18 @@ void FaultInjector::executeScenarioStep()
 
     case FaultScenario::OutOfRangeSpeed:
         // Inject out-of-range speed
-        m_signalHub->updateSignal(
-            QString::fromLatin1(SignalIds::VEHICLE_SPEED), 500.0);
+        m_signalHub->updateSignal(m_speedHandle, 500.0);
         break;
 
     case FaultScenario::InvalidGear:
-        m_signalHub->updateSignal(
-            QString::fromLatin1(SignalIds::GEAR_POSITION), QStringLiteral("?"));
+        m_signalHub->updateSignal(m_gearHandle, QStringLiteral("?"));
         break;
 
     case FaultScenario::JitterySpeed:
         // Rapid fluctuations
         {
             double jitter = QRandomGenerator::global()->bounded(50) - 25;
-            m_signalHub->updateSignal(
-                QString::fromLatin1(SignalIds::VEHICLE_SPEED),
-                m_lastNormalSpeed + jitter);
+            m_signalHub->updateSignal(m_speedHandle, m_lastNormalSpeed + jitter);
         }
         break;
 
@@ -201,9 +191,7 @@ void FaultInjector::executeScenarioStep()
     case FaultScenario::IntermittentSpeed:
         // Update every other tick
         if (m_scenarioStep % 2 == 0) {
-            m_signalHub->updateSignal(
-                QString::fromLatin1(SignalIds::VEHICLE_SPEED),
-                m_lastNormalSpeed);
+            m_signalHub->updateSignal(m_speedHandle, m_lastNormalSpeed);
         }
         break;
 
@@ -211,8 +199,7 @@ void FaultInjector::executeScenarioStep()
         // Jump speed dramatically
         {
             double speed = (m_scenarioStep % 2 == 0) ? 0.0 : 200.0;
-            m_signalHub->updateSignal(
-                QString::fromLatin1(SignalIds::VEHICLE_SPEED), speed);
+            m_signalHub->updateSignal(m_speedHandle, speed);
         }
         break;
 
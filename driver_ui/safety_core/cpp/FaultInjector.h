@@ -90,6 +90,8 @@ private:
     void executeScenarioStep();
 
     signal::SignalHub* m_signalHub{nullptr};
+    signal::SignalHandle m_speedHandle;
+    signal::SignalHandle m_gearHandle;
     bool m_active{false};
     FaultScenario m_scenario{FaultScenario::None};
     QTimer m_scenarioTimer;
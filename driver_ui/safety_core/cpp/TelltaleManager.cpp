@@ -12,12 +12,14 @@ TelltaleManager::TelltaleManager(signal::SignalHub* signalHub, QObject* parent)
     , m_signalHub(signalHub)
 {
     Q_ASSERT(signalHub != nullptr);
-
-    connect(m_signalHub, &signal::SignalHub::signalUpdated,
-            this, &TelltaleManager::onSignalUpdated);
 }
 
-TelltaleManager::~TelltaleManager() = default;
+TelltaleManager::~TelltaleManager()
+{
+    for (signal::SubscriptionId subscription : m_subscriptions) {
+        m_signalHub->unsubscribe(subscription);
+    }
+}
 
 void TelltaleManager::registerTelltale(const QString& signalId,
                                         const QString& name,
@@ -31,7 +33,20 @@ void TelltaleManager::registerTelltale(const QString& signalId,
     config.active = false;
     config.valid = true;
 
+    const bool alreadyRegistered = m_telltales.contains(signalId);
     m_telltales.insert(signalId, config);
+    if (alreadyRegistered) {
+        return;
+    }
+
+    const signal::SubscriptionId subscription = m_signalHub->subscribe(
+        m_signalHub->signalHandle(signalId),
+        [this, signalId](const signal::SignalChange& change) {
+            onSignalUpdated(signalId, change.value);
+        });
+    if (subscription != 0) {
+        m_subscriptions.append(subscription);
+    }
 }
 
 QVector<TelltaleState> TelltaleManager::activeTelltales() const
@@ -158,7 +173,7 @@ void TelltaleManager::onSignalUpdated(const QString& signalId,
     }
 
     TelltaleConfig& config = m_telltales[signalId];
-    bool newActive = value.value.toBool();
+    bool newActive = value.toBool();
     bool newValid = value.isValid();
 
     if (newActive != config.active || newValid != config.valid) {
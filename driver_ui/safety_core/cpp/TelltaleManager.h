@@ -47,6 +47,9 @@ public:
 
     /**
      * @brief Register a telltale
+     *
+     * Subscribes to the telltale's signal, so only telltale signals are
+     * delivered to this manager.
      */
     void registerTelltale(const QString& signalId,
                           const QString& name,
@@ -86,10 +89,8 @@ signals:
     void telltaleActivated(const QString& id, int priority);
     void telltaleDeactivated(const QString& id);
 
-private slots:
-    void onSignalUpdated(const QString& signalId, const signal::SignalValue& value);
-
 private:
+    void onSignalUpdated(const QString& signalId, const signal::SignalValue& value);
     TelltaleState toState(const QString& signalId) const;
     QVariantMap stateToVariant(const TelltaleState& state) const;
 
@@ -104,6 +105,7 @@ private:
     };
 
     QHash<QString, TelltaleConfig> m_telltales;
+    QVector<signal::SubscriptionId> m_subscriptions;  ///< One per telltale signal
     int m_activeCount{0};
     bool m_hasCritical{false};
 };
@@ -2,11 +2,20 @@
 // IPC channel implementation
 
 #include "ipc/IpcChannel.h"
+#include "ipc/IpcSchemas.h"
 #include <QDebug>
+#include <cstring>
 
 namespace automotive {
 namespace ipc {
 
+namespace {
+
+// Sent on the socket of a SharedMemory channel when the peer must wake up
+constexpr char kDoorbell = 0;
+
+} // namespace
+
 IpcChannel::IpcChannel(QObject* parent)
     : QObject(parent)
     , m_socket(new QLocalSocket(this))
@@ -51,20 +60,53 @@ IpcChannel::~IpcChannel()
 }
 
 bool IpcChannel::send(const IpcMessage& message)
+{
+    return sendFrame(message.serialize());
+}
+
+bool IpcChannel::sendFrame(const QByteArray& frame)
 {
     if (m_state != ChannelState::Connected || !m_socket) {
         m_lastError = QStringLiteral("Not connected");
         return false;
     }
+    if (frame.size() < static_cast<qsizetype>(MessageHeader::SIZE)) {
+        m_lastError = QStringLiteral("Frame too small for header");
+        return false;
+    }
 
-    QByteArray data = message.serialize();
-    qint64 written = m_socket->write(data);
+    // Only the header is copied per channel; the payload is written from
+    // the shared frame
+    char header[MessageHeader::SIZE];
+    std::memcpy(header, frame.constData(), MessageHeader::SIZE);
+    MessageHeader::patchSequenceNumber(header, ++m_sendSequence);
 
-    if (written != data.size()) {
-        m_lastError = QStringLiteral("Failed to write complete message");
+    return writeFrame(header, MessageHeader::SIZE, frame.constData() + MessageHeader::SIZE,
+                      frame.size() - static_cast<qsizetype>(MessageHeader::SIZE));
+}
+
+bool IpcChannel::createSharedMemoryTransport(const QString& key, uint32_t capacity)
+{
+    if (m_state != ChannelState::Connected || !m_socket) {
+        m_lastError = QStringLiteral("Not connected");
+        return false;
+    }
+
+    auto ring = std::make_unique<RingTransport>();
+    if (!ring->create(key, capacity, &m_lastError)) {
         return false;
     }
 
+    // Still on the socket: m_ring is only set once the setup is out
+    TransportSetupBody setup;
+    setup.key = key;
+    if (!sendFrame(IpcMessage::fromBody(setup).serialize())) {
+        m_lastError = QStringLiteral("Failed to write transport setup");
+        return false;
+    }
+
+    m_transport = ChannelTransport::SharedMemory;
+    m_ring = std::move(ring);
     return true;
 }
 
@@ -79,6 +121,10 @@ bool IpcChannel::connectToServer(const QString& serverName, int timeoutMs)
         return false;
     }
 
+    m_ring.reset();
+    m_overflow.clear();
+    m_reader.clear();
+    m_sendSequence = 0;
     setState(ChannelState::Connecting);
     m_socket->connectToServer(serverName);
 
@@ -100,21 +146,46 @@ void IpcChannel::disconnect()
 
 void IpcChannel::onConnected()
 {
-    setState(ChannelState::Connected);
-    m_readBuffer.clear();
+    m_reader.clear();
+    // A SharedMemory channel is connected once the server's ring is attached
+    if (m_transport == ChannelTransport::LocalSocket) {
+        setState(ChannelState::Connected);
+    }
 }
 
 void IpcChannel::onDisconnected()
 {
+    m_ring.reset();
+    m_overflow.clear();
     setState(ChannelState::Disconnected);
-    m_readBuffer.clear();
+    m_reader.clear();
 }
 
 void IpcChannel::onReadyRead()
 {
     if (!m_socket) return;
 
-    m_readBuffer.append(m_socket->readAll());
+    if (m_ring) {
+        // Doorbells only: the frames are in the ring, and a doorbell may
+        // also mean the peer made room for frames held back here
+        char doorbells[64];
+        while (m_socket->read(doorbells, sizeof(doorbells)) > 0) {}
+        flushOverflow();
+        drainRing();
+        return;
+    }
+
+    // Read straight into the frame buffer rather than through readAll()
+    qint64 available = m_socket->bytesAvailable();
+    while (available > 0) {
+        const qint64 bytesRead = m_socket->read(
+            m_reader.prepareWrite(static_cast<qsizetype>(available)), available);
+        if (bytesRead <= 0) {
+            break;
+        }
+        m_reader.commitWrite(static_cast<qsizetype>(bytesRead));
+        available = m_socket->bytesAvailable();
+    }
     processBuffer();
 }
 
@@ -136,56 +207,38 @@ void IpcChannel::setState(ChannelState state)
 
 void IpcChannel::processBuffer()
 {
-    // Keep processing while we have enough data
-    while (m_readBuffer.size() >= static_cast<int>(MessageHeader::SIZE)) {
-        // Peek at header to get payload size
-        QDataStream stream(m_readBuffer);
-        stream.setVersion(QDataStream::Qt_6_0);
-
-        MessageHeader header;
-        stream >> header;
-
-        if (!header.isValid()) {
-            // Invalid header - try to find next valid magic
-            int magicPos = m_readBuffer.indexOf(
-                QByteArray::fromRawData(
-                    reinterpret_cast<const char*>(&MessageHeader::MAGIC), 4),
-                1);
-
-            if (magicPos > 0) {
-                emit malformedMessageReceived(
-                    QStringLiteral("Discarding %1 bytes of invalid data")
-                        .arg(magicPos));
-                m_readBuffer.remove(0, magicPos);
-            } else {
-                // No valid header found, clear buffer
-                emit malformedMessageReceived(
-                    QStringLiteral("No valid header found, clearing buffer"));
-                m_readBuffer.clear();
+    FrameReader::Frame frame;
+    for (;;) {
+        switch (m_reader.next(frame)) {
+        case FrameReader::Result::NeedMoreData:
+            return;
+        case FrameReader::Result::Discarded:
+            emit malformedMessageReceived(
+                QStringLiteral("Discarding %1 bytes of invalid data").arg(frame.size));
+            break;
+        case FrameReader::Result::Frame:
+            if (m_transport == ChannelTransport::SharedMemory && !m_ring) {
+                acceptTransportSetup(frame.header.type, frame.data, frame.size);
                 return;
             }
-            continue;
-        }
-
-        // Check if we have complete message
-        int totalSize = static_cast<int>(MessageHeader::SIZE + header.payloadSize);
-        if (m_readBuffer.size() < totalSize) {
-            // Wait for more data
-            return;
+            if (frame.header.type == MessageType::TransportSetup) {
+                // Security: CR-INF-001 - The peer wants a transport we did not select
+                abortTransport(QStringLiteral("Unexpected transport setup; the peer uses shared memory"),
+                               QStringLiteral("Transport mismatch"));
+                return;
+            }
+            // The frame is consumed already, so a handler that disconnects
+            // (clearing the reader) cannot invalidate this loop
+            parseMessage(frame.data, frame.size);
+            break;
         }
-
-        // Extract and parse complete message
-        QByteArray messageData = m_readBuffer.left(totalSize);
-        m_readBuffer.remove(0, totalSize);
-
-        parseMessage(messageData);
     }
 }
 
-bool IpcChannel::parseMessage(const QByteArray& data)
+bool IpcChannel::parseMessage(const char* data, qsizetype size)
 {
     bool ok = false;
-    IpcMessage message = IpcMessage::deserialize(data, &ok);
+    IpcMessage message = IpcMessage::deserialize(data, size, &ok);
 
     if (!ok) {
         // Security: CR-INF-001 - Log malformed messages
@@ -197,5 +250,146 @@ bool IpcChannel::parseMessage(const QByteArray& data)
     return true;
 }
 
+bool IpcChannel::writeFrame(const char* first, qsizetype firstSize,
+                            const char* second, qsizetype secondSize)
+{
+    if (m_ring) {
+        ByteRing& tx = m_ring->tx();
+        if (firstSize + secondSize > static_cast<qsizetype>(tx.capacity())) {
+            m_lastError = QStringLiteral("Frame larger than the shared-memory ring");
+            return false;
+        }
+        bool wakeReceiver = false;
+        if (m_overflow.isEmpty() && tx.write(first, firstSize, second, secondSize, &wakeReceiver)) {
+            if (wakeReceiver) {
+                ringDoorbell();
+            }
+            return true;
+        }
+
+        // Ring full: hold the frame (behind any already held) until the
+        // receiver has drained, as the socket would buffer it
+        QByteArray frame;
+        frame.reserve(firstSize + secondSize);
+        frame.append(first, firstSize);
+        frame.append(second, secondSize);
+        m_overflow.append(frame);
+        return flushOverflow();
+    }
+
+    if (m_socket->write(first, firstSize) != firstSize ||
+        (secondSize > 0 && m_socket->write(second, secondSize) != secondSize)) {
+        m_lastError = QStringLiteral("Failed to write complete message");
+        return false;
+    }
+    return true;
+}
+
+bool IpcChannel::flushOverflow()
+{
+    while (m_ring && !m_overflow.isEmpty()) {
+        ByteRing& tx = m_ring->tx();
+        const QByteArray& frame = m_overflow.first();
+        bool wakeReceiver = false;
+        if (tx.write(frame.constData(), frame.size(), nullptr, 0, &wakeReceiver)) {
+            m_overflow.removeFirst();
+            if (wakeReceiver) {
+                ringDoorbell();
+            }
+            continue;
+        }
+        if (tx.writable() < 0) {
+            // Security: CR-INF-001 - The peer corrupted the ring; drop the link
+            abortTransport(QStringLiteral("Shared-memory ring indices out of range"),
+                           QStringLiteral("Shared-memory ring corrupted"));
+            return false;
+        }
+        if (tx.prepareToWait(frame.size())) {
+            return true;                   // The receiver rings back once it has read
+        }
+    }
+    return true;
+}
+
+void IpcChannel::ringDoorbell()
+{
+    m_socket->write(&kDoorbell, 1);
+    m_socket->flush();
+}
+
+void IpcChannel::abortTransport(const QString& problem, const QString& error)
+{
+    emit malformedMessageReceived(problem);
+    m_lastError = error;
+    m_ring.reset();
+    m_overflow.clear();
+    setState(ChannelState::Error);
+    emit errorOccurred(m_lastError);
+    disconnect();
+}
+
+void IpcChannel::acceptTransportSetup(MessageType type, const char* data, qsizetype size)
+{
+    if (type != MessageType::TransportSetup) {
+        // Security: CR-INF-001 - Nothing but the setup may precede the ring
+        abortTransport(QStringLiteral("Expected a transport setup; the peer uses the socket transport"),
+                       QStringLiteral("Transport mismatch"));
+        return;
+    }
+
+    bool ok = false;
+    const IpcMessage message = IpcMessage::deserialize(data, size, &ok);
+    TransportSetupBody setup;
+    if (!ok || !message.toBody(setup)) {
+        // Security: CR-INF-001 - Log malformed messages
+        abortTransport(ok ? QStringLiteral("Malformed transport setup") : message.validationError(),
+                       QStringLiteral("Shared-memory transport setup failed"));
+        return;
+    }
+
+    auto ring = std::make_unique<RingTransport>();
+    if (!ring->attach(setup.key, &m_lastError)) {
+        setState(ChannelState::Error);
+        emit errorOccurred(m_lastError);
+        disconnect();
+        return;
+    }
+
+    // Whatever followed the setup on the socket is doorbells
+    m_ring = std::move(ring);
+    m_reader.clear();
+    setState(ChannelState::Connected);
+    drainRing();
+}
+
+void IpcChannel::drainRing()
+{
+    for (;;) {
+        if (!m_ring) {
+            return;                        // A handler disconnected
+        }
+        ByteRing& rx = m_ring->rx();
+        const qsizetype available = rx.readable();
+        if (available < 0) {
+            // Security: CR-INF-001 - The peer corrupted the ring; drop the link
+            abortTransport(QStringLiteral("Shared-memory ring indices out of range"),
+                           QStringLiteral("Shared-memory ring corrupted"));
+            return;
+        }
+        if (available > 0) {
+            rx.read(m_reader.prepareWrite(available), available);
+            m_reader.commitWrite(available);
+            if (rx.takeProducerWakeup()) {
+                ringDoorbell();            // The sender has frames held back
+            }
+            processBuffer();
+            continue;
+        }
+        if (rx.prepareToSleep()) {
+            return;                        // The next write rings the doorbell
+        }
+    }
+}
+
 } // namespace ipc
 } // namespace automotive
@@ -5,10 +5,13 @@
 #ifndef AUTOMOTIVE_IPC_CHANNEL_H
 #define AUTOMOTIVE_IPC_CHANNEL_H
 
+#include "ipc/IpcFrameReader.h"
 #include "ipc/IpcMessage.h"
+#include "ipc/IpcShmRing.h"
 #include <QObject>
 #include <QLocalSocket>
 #include <QByteArray>
+#include <QList>
 #include <memory>
 
 namespace automotive {
@@ -24,11 +27,33 @@ enum class ChannelState {
     Error
 };
 
+/**
+ * @brief Path the channel's frames take
+ */
+enum class ChannelTransport {
+    LocalSocket,                       ///< Frames are written to the socket
+    SharedMemory                       ///< Frames go through a RingTransport; the
+                                       ///< socket carries doorbells and liveness only
+};
+
 /**
  * @brief IPC channel for bidirectional message communication
  *
  * Wraps a QLocalSocket for local IPC between Driver UI and Infotainment UI.
  * Security: Validates all incoming messages (CR-INF-001)
+ *
+ * With ChannelTransport::SharedMemory the server end creates a ring pair
+ * per connection and sends its key in a TransportSetup message; the
+ * client end stays Connecting until it has attached. Frames, framing and
+ * validation are the same on both transports. A sender only writes a
+ * doorbell byte when the receiver has drained its ring and gone back to
+ * the event loop, so a burst costs one wakeup. Frames that do not fit in
+ * a full ring are held by the sender, unbounded like a socket's write
+ * buffer, and written once the receiver rings back after reading.
+ *
+ * Both ends must select the same transport. A SharedMemory client whose
+ * first frame is not a TransportSetup, or a LocalSocket channel that
+ * receives one, reports malformedMessageReceived() and drops the link.
  */
 class IpcChannel : public QObject {
     Q_OBJECT
@@ -58,9 +83,44 @@ public:
      * @brief Send a message over the channel
      * @param message Message to send
      * @return true if message was queued for sending
+     *
+     * On the SharedMemory transport a message that does not fit in the
+     * ring is queued too; only one larger than the whole ring is refused.
+     * The header carries this channel's next sequence number, not the one
+     * the message was created with (see sendFrame()).
      */
     bool send(const IpcMessage& message);
 
+    /**
+     * @brief Send an already serialized message (IpcMessage::serialize())
+     * @param frame Serialized message; shared, never modified
+     * @return true if the frame was queued for sending
+     *
+     * The header is sent with this channel's next sequence number patched
+     * in, so one frame can be fanned out to several channels while each
+     * receiver still sees a gap-free sequence. send() and the transport
+     * setup draw from the same counter, which restarts at 1 for every
+     * connection.
+     */
+    bool sendFrame(const QByteArray& frame);
+
+    /**
+     * @brief Select the transport for the next connection (client end)
+     *
+     * The server must use the same transport (IpcServer::setTransport).
+     */
+    void setTransport(ChannelTransport transport) { m_transport = transport; }
+    ChannelTransport transport() const { return m_transport; }
+
+    /**
+     * @brief Server end: create the ring pair @p key, announce it to the
+     *        client and switch this channel to it
+     * @param capacity Bytes per direction (RingTransport::create)
+     * @return false if the segment could not be created or announced
+     */
+    bool createSharedMemoryTransport(const QString& key,
+                                     uint32_t capacity = RingFormat::DEFAULT_CAPACITY);
+
     /**
      * @brief Connect to a named server
      * @param serverName Server name
@@ -107,13 +167,24 @@ private slots:
 private:
     void setState(ChannelState state);
     void processBuffer();
-    bool parseMessage(const QByteArray& data);
+    bool parseMessage(const char* data, qsizetype size);
+    bool writeFrame(const char* first, qsizetype firstSize,
+                    const char* second = nullptr, qsizetype secondSize = 0);
+    bool flushOverflow();
+    void ringDoorbell();
+    void abortTransport(const QString& problem, const QString& error);
+    void acceptTransportSetup(MessageType type, const char* data, qsizetype size);
+    void drainRing();
 
     QLocalSocket* m_socket{nullptr};
     bool m_ownsSocket{false};
     ChannelState m_state{ChannelState::Disconnected};
     QString m_lastError;
-    QByteArray m_readBuffer;
+    FrameReader m_reader;              ///< Reused across reads and connections
+    uint32_t m_sendSequence{0};        ///< Last sequence number sent on this connection
+    ChannelTransport m_transport{ChannelTransport::LocalSocket};
+    std::unique_ptr<RingTransport> m_ring; ///< Set while frames use shared memory
+    QList<QByteArray> m_overflow;      ///< Frames waiting for ring space, oldest first
 };
 
 } // namespace ipc
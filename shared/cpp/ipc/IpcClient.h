@@ -51,6 +51,11 @@ public:
      */
     bool send(const IpcMessage& message);
 
+    /**
+     * @brief Select the transport used from the next connection on
+     */
+    void setTransport(ChannelTransport transport) { m_channel.setTransport(transport); }
+
     /**
      * @brief Set reconnection interval
      * @param intervalMs Interval in milliseconds (0 to disable)
@@ -0,0 +1,180 @@
+// IpcCodec.cpp
+// Compact body codec primitives
+
+#include "ipc/IpcCodec.h"
+#include <QtEndian>
+
+namespace automotive {
+namespace ipc {
+
+namespace {
+
+int varintSize(uint64_t value)
+{
+    int size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+char* putVarint(char* out, uint64_t value)
+{
+    while (value >= 0x80) {
+        *out++ = static_cast<char>(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<char>(value);
+    return out;
+}
+
+} // namespace
+
+// ============================================================================
+// CompactWriter
+// ============================================================================
+
+void CompactWriter::writeVarint(uint64_t value)
+{
+    char bytes[10];
+    m_buffer->append(bytes, putVarint(bytes, value) - bytes);
+}
+
+void CompactWriter::writeFixed32(uint32_t value)
+{
+    char bytes[4];
+    qToLittleEndian(value, bytes);
+    m_buffer->append(bytes, sizeof(bytes));
+}
+
+void CompactWriter::writeFixed64(uint64_t value)
+{
+    char bytes[8];
+    qToLittleEndian(value, bytes);
+    m_buffer->append(bytes, sizeof(bytes));
+}
+
+void CompactWriter::writeBytes(const char* data, qsizetype size)
+{
+    writeVarint(static_cast<uint64_t>(size));
+    m_buffer->append(data, size);
+}
+
+qsizetype CompactWriter::beginNested()
+{
+    const qsizetype mark = m_buffer->size();
+    m_buffer->append('\0');
+    return mark;
+}
+
+void CompactWriter::endNested(qsizetype mark)
+{
+    const qsizetype bodySize = m_buffer->size() - mark - 1;
+    const int lengthSize = varintSize(static_cast<uint64_t>(bodySize));
+    if (lengthSize > 1) {
+        // Rare for the small bodies of the signal path: make room once
+        m_buffer->insert(mark + 1, QByteArray(lengthSize - 1, '\0'));
+    }
+    putVarint(m_buffer->data() + mark, static_cast<uint64_t>(bodySize));
+}
+
+// ============================================================================
+// CompactReader
+// ============================================================================
+
+bool CompactReader::readKey(uint32_t& fieldId, WireType& type)
+{
+    const uint64_t key = readVarint();
+    const uint64_t id = key >> 3;
+    if (!m_ok || id == 0 || id > CodecLimits::MAX_FIELD_ID) {
+        m_ok = false;
+        return false;
+    }
+    fieldId = static_cast<uint32_t>(id);
+    type = static_cast<WireType>(key & 0x7);
+    return true;
+}
+
+uint64_t CompactReader::readVarint()
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64 && m_ok; shift += 7) {
+        if (m_pos == m_end) {
+            break;
+        }
+        const uint8_t byte = *m_pos++;
+        if (shift == 63 && byte > 0x01) {
+            break;                         // Bits beyond 64: a second encoding of some value
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    m_ok = false;                          // Truncated, longer than 10 bytes or over 64 bits
+    return 0;
+}
+
+uint32_t CompactReader::readFixed32()
+{
+    if (!m_ok || m_end - m_pos < 4) {
+        m_ok = false;
+        return 0;
+    }
+    const uint32_t value = qFromLittleEndian<uint32_t>(m_pos);
+    m_pos += 4;
+    return value;
+}
+
+uint64_t CompactReader::readFixed64()
+{
+    if (!m_ok || m_end - m_pos < 8) {
+        m_ok = false;
+        return 0;
+    }
+    const uint64_t value = qFromLittleEndian<uint64_t>(m_pos);
+    m_pos += 8;
+    return value;
+}
+
+bool CompactReader::readBytes(const char*& data, qsizetype& size)
+{
+    const uint64_t length = readVarint();
+    if (!m_ok || length > static_cast<uint64_t>(m_end - m_pos)) {
+        m_ok = false;
+        return false;
+    }
+    data = reinterpret_cast<const char*>(m_pos);
+    size = static_cast<qsizetype>(length);
+    m_pos += length;
+    return true;
+}
+
+bool CompactReader::skip(WireType type)
+{
+    switch (type) {
+    case WireType::Varint:
+        readVarint();
+        break;
+    case WireType::Fixed64:
+        readFixed64();
+        break;
+    case WireType::Fixed32:
+        readFixed32();
+        break;
+    case WireType::Bytes: {
+        const char* data = nullptr;
+        qsizetype size = 0;
+        readBytes(data, size);
+        break;
+    }
+    default:
+        m_ok = false;                      // Unknown wire type: cannot resync
+        break;
+    }
+    return m_ok;
+}
+
+} // namespace ipc
+} // namespace automotive
@@ -0,0 +1,519 @@
+// IpcCodec.h
+// Schema-driven compact binary codec for IPC message bodies
+// Part of: Shared Platform Layer
+// Security: CR-INF-001 - Decoding is bounds-checked; malformed bodies are rejected
+
+#ifndef AUTOMOTIVE_IPC_CODEC_H
+#define AUTOMOTIVE_IPC_CODEC_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace automotive {
+namespace ipc {
+
+/**
+ * @brief Compact body encoding
+ *
+ * A body is a sequence of fields, each a varint key (field id << 3 | wire
+ * type) followed by its value:
+ *   Varint   unsigned LEB128; signed integers are zigzag-mapped first
+ *   Fixed64  8 bytes little endian (double, fixed 64-bit integers)
+ *   Bytes    varint length + bytes (UTF-8 strings, byte arrays, nested bodies)
+ *   Fixed32  4 bytes little endian (float, fixed 32-bit integers)
+ * Scalars equal to their default are omitted, a list is one field per
+ * element. Decoders skip fields they do not know, so a schema can gain
+ * fields with new ids without breaking older peers.
+ */
+enum class WireType : uint8_t {
+    Varint = 0,
+    Fixed64 = 1,
+    Bytes = 2,
+    Fixed32 = 5
+};
+
+namespace CodecLimits {
+    constexpr uint32_t MAX_FIELD_ID = (1u << 29) - 1;
+    constexpr int MAX_NESTING = 16;    ///< Deepest nested body accepted by the decoder
+}
+
+/**
+ * @brief Appends encoded values to a byte array
+ */
+class CompactWriter {
+public:
+    explicit CompactWriter(QByteArray* buffer) : m_buffer(buffer) {}
+
+    void writeKey(uint32_t fieldId, WireType type)
+    {
+        writeVarint((static_cast<uint64_t>(fieldId) << 3) | static_cast<uint64_t>(type));
+    }
+    void writeVarint(uint64_t value);
+    void writeFixed32(uint32_t value);
+    void writeFixed64(uint64_t value);
+    void writeBytes(const char* data, qsizetype size);
+
+    /**
+     * @brief Start a length-delimited nested body
+     * @return Mark to pass to endNested()
+     *
+     * One length byte is reserved up front; bodies of 128 bytes or more are
+     * shifted once to make room for the longer length.
+     */
+    qsizetype beginNested();
+    void endNested(qsizetype mark);
+
+private:
+    QByteArray* m_buffer;
+};
+
+/**
+ * @brief Bounds-checked reader over an encoded body
+ *
+ * Any read past the end or malformed varint puts the reader in the failed
+ * state; later reads return zero.
+ */
+class CompactReader {
+public:
+    CompactReader(const char* data, qsizetype size, int depth = 0)
+        : m_pos(reinterpret_cast<const uint8_t*>(data))
+        , m_end(reinterpret_cast<const uint8_t*>(data) + size)
+        , m_depth(depth)
+    {}
+
+    bool ok() const { return m_ok; }
+    bool atEnd() const { return !m_ok || m_pos == m_end; }
+    int depth() const { return m_depth; }
+    void fail() { m_ok = false; }
+
+    bool readKey(uint32_t& fieldId, WireType& type);
+    uint64_t readVarint();
+    uint32_t readFixed32();
+    uint64_t readFixed64();
+    bool readBytes(const char*& data, qsizetype& size);
+    bool skip(WireType type);
+
+private:
+    const uint8_t* m_pos;
+    const uint8_t* m_end;
+    int m_depth;
+    bool m_ok{true};
+};
+
+/**
+ * @brief Encoding of an integer field
+ */
+enum class FieldEncoding : uint8_t {
+    Default,                           ///< Varint (zigzag for signed types)
+    Fixed                              ///< Fixed32/Fixed64 by size (large or hashed values)
+};
+
+/**
+ * @brief One entry of a body schema: field id and struct member
+ */
+template<typename Struct, typename Member, FieldEncoding Encoding = FieldEncoding::Default>
+struct Field {
+    using StructType = Struct;
+    using MemberType = Member;
+    static constexpr FieldEncoding encoding = Encoding;
+
+    uint32_t id;
+    Member Struct::* member;
+};
+
+/**
+ * @brief Schema entry with the default encoding for the member type
+ */
+template<typename Struct, typename Member>
+constexpr Field<Struct, Member> field(uint32_t id, Member Struct::* member)
+{
+    return {id, member};
+}
+
+/**
+ * @brief Schema entry for an integer stored as Fixed32/Fixed64
+ */
+template<typename Struct, typename Member>
+constexpr Field<Struct, Member, FieldEncoding::Fixed> fixedField(uint32_t id, Member Struct::* member)
+{
+    static_assert(std::is_integral<Member>::value && (sizeof(Member) == 4 || sizeof(Member) == 8),
+                  "fixedField() is for 32/64-bit integers");
+    return {id, member};
+}
+
+namespace detail {
+
+template<typename T, typename = void>
+struct HasFields : std::false_type {};
+template<typename T>
+struct HasFields<T, std::void_t<decltype(T::fields())>> : std::true_type {};
+
+template<typename T>
+struct IsList : std::false_type {};
+template<typename T>
+struct IsList<QList<T>> : std::true_type {};
+
+/**
+ * @brief Per-type wire mapping
+ */
+template<typename T, FieldEncoding Encoding, typename = void>
+struct ValueCodec;
+
+template<typename T, typename = void>
+struct WireInteger { using type = T; };
+template<typename T>
+struct WireInteger<T, std::enable_if_t<std::is_enum<T>::value>> {
+    using type = std::underlying_type_t<T>;
+};
+
+// Unsigned integers, bool and enums: varint; a value too large for the
+// field is malformed, not truncated
+template<typename T>
+struct ValueCodec<T, FieldEncoding::Default,
+                  std::enable_if_t<(std::is_integral<T>::value && !std::is_signed<T>::value) ||
+                                   std::is_enum<T>::value>> {
+    static constexpr WireType wire = WireType::Varint;
+    static bool isDefault(const T& value) { return value == T{}; }
+    static void write(CompactWriter& writer, const T& value)
+    {
+        writer.writeVarint(static_cast<uint64_t>(value));
+    }
+    static void read(CompactReader& reader, T& value)
+    {
+        using Integer = typename WireInteger<T>::type;
+        const uint64_t raw = reader.readVarint();
+        if (raw > static_cast<uint64_t>(std::numeric_limits<Integer>::max())) {
+            reader.fail();
+            return;
+        }
+        value = static_cast<T>(raw);
+    }
+};
+
+// Signed integers: zigzag varint, range-checked like the unsigned ones
+template<typename T>
+struct ValueCodec<T, FieldEncoding::Default,
+                  std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value>> {
+    static constexpr WireType wire = WireType::Varint;
+    static bool isDefault(const T& value) { return value == 0; }
+    static void write(CompactWriter& writer, const T& value)
+    {
+        const int64_t wide = value;
+        writer.writeVarint((static_cast<uint64_t>(wide) << 1) ^ static_cast<uint64_t>(wide >> 63));
+    }
+    static void read(CompactReader& reader, T& value)
+    {
+        const uint64_t raw = reader.readVarint();
+        const int64_t wide = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+        if (wide < std::numeric_limits<T>::min() || wide > std::numeric_limits<T>::max()) {
+            reader.fail();
+            return;
+        }
+        value = static_cast<T>(wide);
+    }
+};
+
+// Integers with fixedField(): little-endian Fixed32/Fixed64
+template<typename T>
+struct ValueCodec<T, FieldEncoding::Fixed, std::enable_if_t<std::is_integral<T>::value>> {
+    static constexpr WireType wire = sizeof(T) == 8 ? WireType::Fixed64 : WireType::Fixed32;
+    static bool isDefault(const T& value) { return value == 0; }
+    static void write(CompactWriter& writer, const T& value)
+    {
+        if (sizeof(T) == 8) {
+            writer.writeFixed64(static_cast<uint64_t>(value));
+        } else {
+            writer.writeFixed32(static_cast<uint32_t>(value));
+        }
+    }
+    static void read(CompactReader& reader, T& value)
+    {
+        value = sizeof(T) == 8 ? static_cast<T>(reader.readFixed64())
+                               : static_cast<T>(reader.readFixed32());
+    }
+};
+
+template<>
+struct ValueCodec<double, FieldEncoding::Default> {
+    static constexpr WireType wire = WireType::Fixed64;
+    static bool isDefault(const double& value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits == 0;                  // +0.0 only; -0.0 and NaN are sent
+    }
+    static void write(CompactWriter& writer, const double& value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writer.writeFixed64(bits);
+    }
+    static void read(CompactReader& reader, double& value)
+    {
+        const uint64_t bits = reader.readFixed64();
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+};
+
+template<>
+struct ValueCodec<float, FieldEncoding::Default> {
+    static constexpr WireType wire = WireType::Fixed32;
+    static bool isDefault(const float& value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits == 0;
+    }
+    static void write(CompactWriter& writer, const float& value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writer.writeFixed32(bits);
+    }
+    static void read(CompactReader& reader, float& value)
+    {
+        const uint32_t bits = reader.readFixed32();
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+};
+
+template<>
+struct ValueCodec<QByteArray, FieldEncoding::Default> {
+    static constexpr WireType wire = WireType::Bytes;
+    static bool isDefault(const QByteArray& value) { return value.isEmpty(); }
+    static void write(CompactWriter& writer, const QByteArray& value)
+    {
+        writer.writeBytes(value.constData(), value.size());
+    }
+    static void read(CompactReader& reader, QByteArray& value)
+    {
+        const char* data = nullptr;
+        qsizetype size = 0;
+        if (reader.readBytes(data, size)) {
+            value = QByteArray(data, size);
+        }
+    }
+};
+
+template<>
+struct ValueCodec<QString, FieldEncoding::Default> {
+    static constexpr WireType wire = WireType::Bytes;
+    static bool isDefault(const QString& value) { return value.isEmpty(); }
+    static void write(CompactWriter& writer, const QString& value)
+    {
+        const QByteArray utf8 = value.toUtf8();
+        writer.writeBytes(utf8.constData(), utf8.size());
+    }
+    static void read(CompactReader& reader, QString& value)
+    {
+        const char* data = nullptr;
+        qsizetype size = 0;
+        if (reader.readBytes(data, size)) {
+            value = QString::fromUtf8(data, size);
+        }
+    }
+};
+
+template<typename Struct>
+void encodeFields(CompactWriter& writer, const Struct& body);
+template<typename Struct>
+bool decodeFields(CompactReader& reader, Struct& body);
+template<typename Struct>
+void resetFields(Struct& body);
+
+// Nested bodies: length-delimited
+template<typename T>
+struct ValueCodec<T, FieldEncoding::Default, std::enable_if_t<HasFields<T>::value>> {
+    static constexpr WireType wire = WireType::Bytes;
+    static bool isDefault(const T&) { return false; }
+    static void write(CompactWriter& writer, const T& value)
+    {
+        const qsizetype mark = writer.beginNested();
+        encodeFields(writer, value);
+        writer.endNested(mark);
+    }
+    static void read(CompactReader& reader, T& value)
+    {
+        const char* data = nullptr;
+        qsizetype size = 0;
+        if (!reader.readBytes(data, size)) {
+            return;
+        }
+        if (reader.depth() >= CodecLimits::MAX_NESTING) {
+            reader.fail();
+            return;
+        }
+        CompactReader nested(data, size, reader.depth() + 1);
+        if (!decodeFields(nested, value)) {
+            reader.fail();
+        }
+    }
+};
+
+template<typename Struct, typename Member, FieldEncoding Encoding>
+void encodeField(CompactWriter& writer, const Struct& body,
+                 const Field<Struct, Member, Encoding>& spec)
+{
+    const Member& value = body.*(spec.member);
+    if constexpr (IsList<Member>::value) {
+        using Codec = ValueCodec<typename Member::value_type, Encoding>;
+        for (const auto& element : value) {
+            writer.writeKey(spec.id, Codec::wire);
+            Codec::write(writer, element);
+        }
+    } else {
+        using Codec = ValueCodec<Member, Encoding>;
+        if (!Codec::isDefault(value)) {
+            writer.writeKey(spec.id, Codec::wire);
+            Codec::write(writer, value);
+        }
+    }
+}
+
+// Decodes the value if the key belongs to @p spec; returns whether it did
+template<typename Struct, typename Member, FieldEncoding Encoding>
+bool decodeField(CompactReader& reader, Struct& body,
+                 const Field<Struct, Member, Encoding>& spec, uint32_t fieldId, WireType type)
+{
+    if (fieldId != spec.id) {
+        return false;
+    }
+    Member& value = body.*(spec.member);
+    if constexpr (IsList<Member>::value) {
+        using Element = typename Member::value_type;
+        using Codec = ValueCodec<Element, Encoding>;
+        if (type != Codec::wire) {
+            reader.fail();
+            return true;
+        }
+        Codec::read(reader, value.emplaceBack());
+    } else {
+        using Codec = ValueCodec<Member, Encoding>;
+        if (type != Codec::wire) {
+            reader.fail();
+            return true;
+        }
+        Codec::read(reader, value);
+    }
+    return true;
+}
+
+template<typename Struct, typename Member, FieldEncoding Encoding>
+void resetField(Struct& body, const Field<Struct, Member, Encoding>& spec)
+{
+    Member& value = body.*(spec.member);
+    if constexpr (IsList<Member>::value) {
+        value.clear();                     // Keeps the capacity for the next decode
+    } else if constexpr (HasFields<Member>::value) {
+        resetFields(value);
+    } else {
+        value = Member{};
+    }
+}
+
+template<typename Struct>
+void encodeFields(CompactWriter& writer, const Struct& body)
+{
+    std::apply([&](const auto&... spec) { (encodeField(writer, body, spec), ...); },
+               Struct::fields());
+}
+
+template<typename Struct>
+bool decodeFields(CompactReader& reader, Struct& body)
+{
+    resetFields(body);
+    constexpr auto specs = Struct::fields();
+    uint32_t fieldId = 0;
+    WireType type = WireType::Varint;
+    while (!reader.atEnd()) {
+        if (!reader.readKey(fieldId, type)) {
+            return false;
+        }
+        const bool known = std::apply([&](const auto&... spec) {
+            return (decodeField(reader, body, spec, fieldId, type) || ...);
+        }, specs);
+        if (!known && !reader.skip(type)) {
+            return false;
+        }
+    }
+    return reader.ok();
+}
+
+template<typename Struct>
+void resetFields(Struct& body)
+{
+    std::apply([&](const auto&... spec) { (resetField(body, spec), ...); }, Struct::fields());
+}
+
+template<typename... Specs>
+constexpr bool fieldIdsValid(const Specs&... specs)
+{
+    const uint32_t ids[] = {0u, specs.id...};
+    const int count = static_cast<int>(sizeof...(Specs));
+    for (int i = 1; i <= count; ++i) {
+        if (ids[i] == 0 || ids[i] > CodecLimits::MAX_FIELD_ID) {
+            return false;
+        }
+        for (int j = 1; j < i; ++j) {
+            if (ids[i] == ids[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief True if a body schema has unique, non-zero field ids
+ */
+template<typename Body>
+constexpr bool schemaValid()
+{
+    return std::apply([](const auto&... spec) { return detail::fieldIdsValid(spec...); },
+                      Body::fields());
+}
+
+/**
+ * @brief Append the compact encoding of @p body to @p buffer
+ *
+ * A body is a plain struct with a static constexpr fields() returning a
+ * std::tuple of field()/fixedField() entries (see IpcSchemas.h).
+ */
+template<typename Body>
+void encodeBody(const Body& body, QByteArray* buffer)
+{
+    static_assert(schemaValid<Body>(), "Body schema field ids must be unique and non-zero");
+    CompactWriter writer(buffer);
+    detail::encodeFields(writer, body);
+}
+
+/**
+ * @brief Decode a compact body into @p body
+ * @return false if the bytes are malformed (body contents then unspecified)
+ *
+ * Fields absent from the bytes are reset to their defaults. Lists are
+ * cleared rather than reallocated, so decoding into the same body again
+ * reuses its storage: a steady stream of batches decodes without heap
+ * allocation once the lists have grown to the batch size (string and
+ * byte-array fields still allocate).
+ */
+template<typename Body>
+bool decodeBody(const char* data, qsizetype size, Body& body)
+{
+    static_assert(schemaValid<Body>(), "Body schema field ids must be unique and non-zero");
+    CompactReader reader(data, size);
+    return detail::decodeFields(reader, body);
+}
+
+} // namespace ipc
+} // namespace automotive
+
+#endif // AUTOMOTIVE_IPC_CODEC_H
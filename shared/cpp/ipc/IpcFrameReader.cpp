@@ -0,0 +1,90 @@
+// IpcFrameReader.cpp
+// Receive buffer and message framing implementation
+
+#include "ipc/IpcFrameReader.h"
+#include <algorithm>
+#include <cstring>
+
+namespace automotive {
+namespace ipc {
+
+namespace {
+
+constexpr qsizetype kInitialCapacity = 16 * 1024;
+
+// MessageHeader::MAGIC as it appears on the wire (big endian)
+constexpr char kMagicBytes[] = {'A', 'U', 'T', 'I'};
+constexpr qsizetype kMagicSize = sizeof(kMagicBytes);
+
+} // namespace
+
+char* FrameReader::prepareWrite(qsizetype size)
+{
+    const qsizetype unread = m_write - m_read;
+    if (m_buffer.size() - m_write < size) {
+        if (m_read > 0 && unread <= m_read && m_buffer.size() - unread >= size) {
+            // Moves at most as many bytes as were consumed since the last move
+            std::memmove(m_buffer.data(), m_buffer.constData() + m_read,
+                         static_cast<size_t>(unread));
+            m_read = 0;
+            m_write = unread;
+        } else {
+            m_buffer.resize(std::max({m_write + size, 2 * m_buffer.size(), kInitialCapacity}));
+        }
+    }
+    return m_buffer.data() + m_write;
+}
+
+void FrameReader::commitWrite(qsizetype size)
+{
+    m_write += size;
+}
+
+void FrameReader::append(const char* data, qsizetype size)
+{
+    std::memcpy(prepareWrite(size), data, static_cast<size_t>(size));
+    commitWrite(size);
+}
+
+FrameReader::Result FrameReader::next(Frame& frame)
+{
+    const qsizetype available = m_write - m_read;
+    if (available < static_cast<qsizetype>(MessageHeader::SIZE)) {
+        return Result::NeedMoreData;
+    }
+
+    const char* begin = m_buffer.constData() + m_read;
+    frame.header = MessageHeader::decode(begin);
+    frame.data = begin;
+
+    if (!frame.header.isValid()) {
+        // Skip to the next magic; keep a possibly partial one at the end
+        const char* end = begin + available;
+        const char* found = std::search(begin + 1, end, kMagicBytes, kMagicBytes + kMagicSize);
+        frame.size = found != end ? found - begin : available - (kMagicSize - 1);
+        consume(frame.size);
+        return Result::Discarded;
+    }
+
+    const qsizetype totalSize = static_cast<qsizetype>(MessageHeader::SIZE) +
+                                static_cast<qsizetype>(frame.header.payloadSize);
+    if (available < totalSize) {
+        return Result::NeedMoreData;
+    }
+
+    frame.size = totalSize;
+    consume(totalSize);
+    return Result::Frame;
+}
+
+void FrameReader::consume(qsizetype size)
+{
+    m_read += size;
+    if (m_read == m_write) {
+        // Drained: the next write starts at the front without moving anything
+        m_read = m_write = 0;
+    }
+}
+
+} // namespace ipc
+} // namespace automotive
@@ -0,0 +1,86 @@
+// IpcFrameReader.h
+// Receive buffer and message framing for IPC byte streams
+// Part of: Shared Platform Layer
+// Security: CR-INF-001 - Invalid headers are skipped up to the next magic
+
+#ifndef AUTOMOTIVE_IPC_FRAME_READER_H
+#define AUTOMOTIVE_IPC_FRAME_READER_H
+
+#include "ipc/IpcMessage.h"
+#include <QByteArray>
+
+namespace automotive {
+namespace ipc {
+
+/**
+ * @brief Splits a received byte stream into IpcMessage frames
+ *
+ * Bytes are written straight into one reusable buffer (prepareWrite /
+ * commitWrite) and frames are handed out as views into it, so neither the
+ * header peek nor the frame hand-off copies. Consumed bytes are reclaimed
+ * by moving the unread tail to the front only when that tail is no larger
+ * than what was consumed, so a burst of N bytes costs O(N) regardless of
+ * how many messages it carries.
+ */
+class FrameReader {
+public:
+    enum class Result {
+        NeedMoreData,                  ///< No complete frame buffered
+        Frame,                         ///< frame holds a complete message
+        Discarded                      ///< frame.size bytes of invalid data were skipped
+    };
+
+    /**
+     * @brief A complete frame (header + payload) or a discarded range
+     *
+     * data stays valid until the next prepareWrite(), append() or clear().
+     */
+    struct Frame {
+        MessageHeader header;
+        const char* data{nullptr};
+        qsizetype size{0};
+    };
+
+    /**
+     * @brief Writable space for at least @p size bytes; follow with commitWrite()
+     */
+    char* prepareWrite(qsizetype size);
+
+    /**
+     * @brief Mark @p size bytes written at prepareWrite() as received
+     */
+    void commitWrite(qsizetype size);
+
+    /**
+     * @brief Copy @p size received bytes in (prepareWrite + commitWrite)
+     */
+    void append(const char* data, qsizetype size);
+
+    /**
+     * @brief Take the next frame or discard data up to the next magic
+     *
+     * The frame is consumed by this call; its payload is not validated
+     * beyond the header (IpcMessage::deserialize does that).
+     */
+    Result next(Frame& frame);
+
+    /**
+     * @brief Drop all buffered data (the allocation is kept)
+     */
+    void clear() { m_read = m_write = 0; }
+
+    qsizetype bufferedBytes() const { return m_write - m_read; }
+    qsizetype capacity() const { return m_buffer.size(); }
+
+private:
+    void consume(qsizetype size);
+
+    QByteArray m_buffer;
+    qsizetype m_read{0};               ///< Start of unread data
+    qsizetype m_write{0};              ///< End of received data
+};
+
+} // namespace ipc
+} // namespace automotive
+
+#endif // AUTOMOTIVE_IPC_FRAME_READER_H
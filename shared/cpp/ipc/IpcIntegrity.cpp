@@ -0,0 +1,221 @@
+// IpcIntegrity.cpp
+// CRC32C implementation
+//
+// The portable variant is slicing-by-8: eight 256-entry tables fold eight
+// input bytes per step. The hardware variants use the CPU's CRC32C
+// instruction eight bytes at a time. All variants work on the inverted
+// running CRC; the public entry points apply the initial/final inversion.
+
+#include "ipc/IpcIntegrity.h"
+#include <QtEndian>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AUTOMOTIVE_CRC_X86 1
+#include <nmmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AUTOMOTIVE_CRC_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define AUTOMOTIVE_CRC_HAS_SSE42 1
+#elif defined(__SSE4_2__) || defined(__AVX__)
+#define AUTOMOTIVE_CRC_TARGET_SSE42
+#define AUTOMOTIVE_CRC_HAS_SSE42 1
+#endif
+#endif
+
+// ARMv8.0 makes the CRC32 instructions optional: the path is compiled in
+// when the target enables them (-march=armv8-a+crc, mandatory from v8.1)
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define AUTOMOTIVE_CRC_HAS_ARM 1
+#include <arm_acle.h>
+#endif
+
+namespace automotive {
+namespace ipc {
+
+namespace {
+
+constexpr uint32_t POLYNOMIAL = 0x82F63B78u;  // Castagnoli, reflected
+
+struct SlicingTables {
+    uint32_t table[8][256];
+};
+
+constexpr SlicingTables makeSlicingTables()
+{
+    SlicingTables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1u) ? POLYNOMIAL : 0u);
+        }
+        tables.table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (int slice = 1; slice < 8; ++slice) {
+            const uint32_t previous = tables.table[slice - 1][i];
+            tables.table[slice][i] = (previous >> 8) ^ tables.table[0][previous & 0xFFu];
+        }
+    }
+    return tables;
+}
+
+constexpr SlicingTables TABLES = makeSlicingTables();
+
+using CrcFunction = uint32_t (*)(const uint8_t* data, size_t size, uint32_t crc);
+
+uint32_t crcPortable(const uint8_t* data, size_t size, uint32_t crc)
+{
+    const auto& t = TABLES.table;
+    for (; size >= 8; data += 8, size -= 8) {
+        const uint32_t low = qFromLittleEndian<uint32_t>(data) ^ crc;
+        const uint32_t high = qFromLittleEndian<uint32_t>(data + 4);
+        crc = t[7][low & 0xFFu] ^ t[6][(low >> 8) & 0xFFu] ^
+              t[5][(low >> 16) & 0xFFu] ^ t[4][low >> 24] ^
+              t[3][high & 0xFFu] ^ t[2][(high >> 8) & 0xFFu] ^
+              t[1][(high >> 16) & 0xFFu] ^ t[0][high >> 24];
+    }
+    for (; size > 0; ++data, --size) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFFu];
+    }
+    return crc;
+}
+
+#ifdef AUTOMOTIVE_CRC_HAS_SSE42
+
+AUTOMOTIVE_CRC_TARGET_SSE42
+uint32_t crcSse42(const uint8_t* data, size_t size, uint32_t crc)
+{
+    uint64_t crc64 = crc;
+    for (; size >= 8; data += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; size > 0; ++data, --size) {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+
+#endif // AUTOMOTIVE_CRC_HAS_SSE42
+
+#ifdef AUTOMOTIVE_CRC_HAS_ARM
+
+uint32_t crcArm(const uint8_t* data, size_t size, uint32_t crc)
+{
+    for (; size >= 8; data += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; ++data, --size) {
+        crc = __crc32cb(crc, *data);
+    }
+    return crc;
+}
+
+#endif // AUTOMOTIVE_CRC_HAS_ARM
+
+bool isSupported(IntegrityIsa isa)
+{
+    switch (isa) {
+    case IntegrityIsa::Portable:
+        return true;
+    case IntegrityIsa::Sse42:
+#ifdef AUTOMOTIVE_CRC_HAS_SSE42
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("sse4.2");
+#else
+        return true;   // Built for SSE4.2 or later
+#endif
+#else
+        return false;
+#endif
+    case IntegrityIsa::ArmCrc:
+#ifdef AUTOMOTIVE_CRC_HAS_ARM
+        return true;   // Enabled by the build target
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+CrcFunction functionFor(IntegrityIsa isa)
+{
+    switch (isa) {
+#ifdef AUTOMOTIVE_CRC_HAS_SSE42
+    case IntegrityIsa::Sse42:
+        return crcSse42;
+#endif
+#ifdef AUTOMOTIVE_CRC_HAS_ARM
+    case IntegrityIsa::ArmCrc:
+        return crcArm;
+#endif
+    default:
+        return crcPortable;
+    }
+}
+
+} // namespace
+
+IntegrityIsa bestIntegrityIsa()
+{
+    static const IntegrityIsa best = isSupported(IntegrityIsa::Sse42)  ? IntegrityIsa::Sse42
+                                   : isSupported(IntegrityIsa::ArmCrc) ? IntegrityIsa::ArmCrc
+                                                                       : IntegrityIsa::Portable;
+    return best;
+}
+
+const char* integrityIsaName(IntegrityIsa isa)
+{
+    switch (isa) {
+    case IntegrityIsa::Portable: return "slicing-by-8";
+    case IntegrityIsa::Sse42:    return "sse4.2";
+    case IntegrityIsa::ArmCrc:   return "armv8-crc";
+    }
+    return "unknown";
+}
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc)
+{
+    static const CrcFunction best = functionFor(bestIntegrityIsa());
+    return ~best(static_cast<const uint8_t*>(data), size, ~crc);
+}
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc, IntegrityIsa isa)
+{
+    if (!isSupported(isa)) {
+        isa = bestIntegrityIsa();
+    }
+    return ~functionFor(isa)(static_cast<const uint8_t*>(data), size, ~crc);
+}
+
+// ============================================================================
+// IntegrityWriter
+// ============================================================================
+
+IntegrityWriter::IntegrityWriter(QByteArray* buffer)
+    : m_buffer(buffer)
+{
+    open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+}
+
+qint64 IntegrityWriter::readData(char* data, qint64 maxSize)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(maxSize)
+    return -1;
+}
+
+qint64 IntegrityWriter::writeData(const char* data, qint64 size)
+{
+    m_buffer->append(data, static_cast<qsizetype>(size));
+    m_crc = crc32c(data, static_cast<size_t>(size), m_crc);
+    m_written += size;
+    return size;
+}
+
+} // namespace ipc
+} // namespace automotive
@@ -0,0 +1,92 @@
+// IpcIntegrity.h
+// CRC32C integrity engine for IPC message payloads
+// Part of: Shared Platform Layer
+// Security: CR-INF-001 - Detects corrupted payloads; not an authentication code
+
+#ifndef AUTOMOTIVE_IPC_INTEGRITY_H
+#define AUTOMOTIVE_IPC_INTEGRITY_H
+
+#include <QByteArray>
+#include <QIODevice>
+#include <cstddef>
+#include <cstdint>
+
+namespace automotive {
+namespace ipc {
+
+/**
+ * @brief Implementation used to compute CRC32C
+ *
+ * All variants produce the same checksum (Castagnoli polynomial,
+ * reflected, initial value and final XOR 0xFFFFFFFF, as in iSCSI/SCTP).
+ */
+enum class IntegrityIsa : uint8_t {
+    Portable = 0,                      ///< Table-driven slicing-by-8
+    Sse42,                             ///< x86-64 SSE4.2 crc32 instruction
+    ArmCrc                             ///< ARMv8 CRC32 extension
+};
+
+/**
+ * @brief Fastest implementation supported by the running CPU
+ */
+IntegrityIsa bestIntegrityIsa();
+
+/**
+ * @brief Human-readable name of an implementation
+ */
+const char* integrityIsaName(IntegrityIsa isa);
+
+/**
+ * @brief CRC32C of a buffer using the best implementation
+ * @param crc CRC32C of the preceding bytes (0 to start), so a buffer can be
+ *            checksummed in pieces: crc32c(b, nb, crc32c(a, na)) equals the
+ *            checksum of a followed by b
+ */
+uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+/**
+ * @brief CRC32C with a specific implementation
+ *
+ * Falls back to the best supported implementation if @p isa is not
+ * available on this CPU or build.
+ */
+uint32_t crc32c(const void* data, size_t size, uint32_t crc, IntegrityIsa isa);
+
+/**
+ * @brief Write-only device that appends to a byte array and checksums
+ *
+ * Lets a QDataStream serialize a payload and compute its CRC32C in the
+ * same pass, without a second walk over the serialized bytes. Bytes that
+ * already are in @p buffer when the device is created are not checksummed,
+ * so a header can be reserved in front of the payload.
+ */
+class IntegrityWriter : public QIODevice {
+public:
+    explicit IntegrityWriter(QByteArray* buffer);
+
+    /**
+     * @brief CRC32C of everything written so far
+     */
+    uint32_t checksum() const { return m_crc; }
+
+    /**
+     * @brief Number of bytes written so far
+     */
+    qint64 bytesWritten() const { return m_written; }
+
+    bool isSequential() const override { return true; }
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 size) override;
+
+private:
+    QByteArray* m_buffer;
+    uint32_t m_crc{0};
+    qint64 m_written{0};
+};
+
+} // namespace ipc
+} // namespace automotive
+
+#endif // AUTOMOTIVE_IPC_INTEGRITY_H
@@ -2,9 +2,10 @@
 // IPC message implementation
 
 #include "ipc/IpcMessage.h"
-#include <QCryptographicHash>
+#include "ipc/IpcIntegrity.h"
 #include <QDateTime>
 #include <QIODevice>
+#include <QtEndian>
 
 namespace automotive {
 namespace ipc {
@@ -34,11 +35,17 @@ IpcMessage::IpcMessage(MessageType type, const QVariantMap& payload)
 void IpcMessage::setValue(const QString& key, const QVariant& value)
 {
     m_payload.insert(key, value);
+    m_header.encoding = PayloadEncoding::VariantMap;
+    m_body.clear();
+    m_checksumVerified = false;
 }
 
 void IpcMessage::setPayload(const QVariantMap& payload)
 {
     m_payload = payload;
+    m_header.encoding = PayloadEncoding::VariantMap;
+    m_body.clear();
+    m_checksumVerified = false;
 }
 
 void IpcMessage::setSequenceNumber(uint32_t seq)
@@ -53,47 +60,54 @@ uint32_t IpcMessage::nextSequenceNumber()
 
 QByteArray IpcMessage::serialize() const
 {
-    // Serialize payload first
-    QByteArray payloadData;
+    MessageHeader header = m_header;
+
+    if (m_header.encoding == PayloadEncoding::Compact) {
+        QByteArray result;
+        result.reserve(static_cast<qsizetype>(MessageHeader::SIZE) + m_body.size());
+        result.resize(static_cast<qsizetype>(MessageHeader::SIZE));
+        result.append(m_body);
+
+        header.payloadSize = static_cast<uint32_t>(m_body.size());
+        header.checksum = crc32c(m_body.constData(), static_cast<size_t>(m_body.size()));
+        header.encode(result.data());
+        return result;
+    }
+
+    // Reserve the header, then stream the payload behind it. The writer
+    // checksums the payload as it is written, so it is walked only once.
+    QByteArray result(static_cast<qsizetype>(MessageHeader::SIZE), '\0');
+    IntegrityWriter writer(&result);
     {
-        QDataStream payloadStream(&payloadData, QIODevice::WriteOnly);
+        QDataStream payloadStream(&writer);
         payloadStream.setVersion(QDataStream::Qt_6_0);
         payloadStream << m_payload;
     }
 
-    // Build complete message
-    QByteArray result;
-    result.reserve(static_cast<int>(MessageHeader::SIZE) + payloadData.size());
-
-    MessageHeader header = m_header;
-    header.payloadSize = static_cast<uint32_t>(payloadData.size());
-    header.checksum = calculateChecksum(payloadData);
-
-    QDataStream stream(&result, QIODevice::WriteOnly);
-    stream.setVersion(QDataStream::Qt_6_0);
-    stream << header;
-
-    result.append(payloadData);
+    header.payloadSize = static_cast<uint32_t>(writer.bytesWritten());
+    header.checksum = writer.checksum();
+    header.encode(result.data());
 
     return result;
 }
 
 IpcMessage IpcMessage::deserialize(const QByteArray& data, bool* ok)
+{
+    return deserialize(data.constData(), data.size(), ok);
+}
+
+IpcMessage IpcMessage::deserialize(const char* data, qsizetype size, bool* ok)
 {
     IpcMessage msg;
 
     if (ok) *ok = false;
 
-    if (data.size() < static_cast<int>(MessageHeader::SIZE)) {
+    if (size < static_cast<qsizetype>(MessageHeader::SIZE)) {
         msg.m_validationError = QStringLiteral("Data too small for header");
         return msg;
     }
 
-    QDataStream stream(data);
-    stream.setVersion(QDataStream::Qt_6_0);
-
-    // Read header
-    stream >> msg.m_header;
+    msg.m_header = MessageHeader::decode(data);
 
     if (!msg.m_header.isValid()) {
         msg.m_validationError = QStringLiteral("Invalid message header (magic/version)");
@@ -101,23 +115,32 @@ IpcMessage IpcMessage::deserialize(const QByteArray& data, bool* ok)
     }
 
     // Validate payload size
-    int expectedSize = static_cast<int>(MessageHeader::SIZE + msg.m_header.payloadSize);
-    if (data.size() < expectedSize) {
+    const qint64 expectedSize = static_cast<qint64>(MessageHeader::SIZE) +
+                                static_cast<qint64>(msg.m_header.payloadSize);
+    if (size < expectedSize) {
         msg.m_validationError = QStringLiteral("Data too small for payload");
         return msg;
     }
 
-    // Extract and validate payload
-    QByteArray payloadData = data.mid(static_cast<int>(MessageHeader::SIZE),
-                                       static_cast<int>(msg.m_header.payloadSize));
-
-    uint32_t expectedChecksum = calculateChecksum(payloadData);
-    if (msg.m_header.checksum != expectedChecksum) {
+    // Validate the payload in place
+    const char* payload = data + MessageHeader::SIZE;
+    const qsizetype payloadSize = static_cast<qsizetype>(msg.m_header.payloadSize);
+    if (msg.m_header.checksum != crc32c(payload, static_cast<size_t>(payloadSize))) {
         msg.m_validationError = QStringLiteral("Checksum mismatch - message corrupted");
         return msg;
     }
 
+    if (msg.m_header.encoding == PayloadEncoding::Compact) {
+        // Decoded on demand by toBody() against the receiver's schema
+        msg.m_body = QByteArray(payload, payloadSize);
+        msg.m_valid = true;
+        msg.m_checksumVerified = true;
+        if (ok) *ok = true;
+        return msg;
+    }
+
     // Deserialize payload
+    const QByteArray payloadData = QByteArray::fromRawData(payload, payloadSize);
     QDataStream payloadStream(payloadData);
     payloadStream.setVersion(QDataStream::Qt_6_0);
     payloadStream >> msg.m_payload;
@@ -128,51 +151,43 @@ IpcMessage IpcMessage::deserialize(const QByteArray& data, bool* ok)
     }
 
     msg.m_valid = true;
+    msg.m_checksumVerified = true;
     if (ok) *ok = true;
 
     return msg;
 }
 
-bool IpcMessage::validateChecksum() const
+void MessageHeader::encode(char* out) const
 {
-    QByteArray payloadData;
-    {
-        QDataStream payloadStream(&payloadData, QIODevice::WriteOnly);
-        payloadStream.setVersion(QDataStream::Qt_6_0);
-        payloadStream << m_payload;
-    }
-
-    return m_header.checksum == calculateChecksum(payloadData);
+    qToBigEndian(magic, out);
+    qToBigEndian(version, out + 4);
+    qToBigEndian(static_cast<uint16_t>(type), out + 6);
+    qToBigEndian(payloadSize, out + 8);
+    qToBigEndian(sequenceNumber, out + 12);
+    qToBigEndian(timestamp, out + 16);
+    qToBigEndian(checksum, out + 24);
+    qToBigEndian(static_cast<uint16_t>(encoding), out + 28);
+    qToBigEndian(reserved, out + 30);
 }
 
-uint32_t IpcMessage::calculateChecksum(const QByteArray& data)
+MessageHeader MessageHeader::decode(const char* in)
 {
-    // Use CRC32-style checksum (simplified for demonstration)
-    // In production, use a proper CRC32 implementation
-    QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Md5);
-
-    // Take first 4 bytes as checksum
-    uint32_t checksum = 0;
-    if (hash.size() >= 4) {
-        checksum = static_cast<uint32_t>(
-            (static_cast<uint8_t>(hash[0]) << 24) |
-            (static_cast<uint8_t>(hash[1]) << 16) |
-            (static_cast<uint8_t>(hash[2]) << 8) |
-            static_cast<uint8_t>(hash[3])
-        );
-    }
-    return checksum;
+    MessageHeader header;
+    header.magic = qFromBigEndian<uint32_t>(in);
+    header.version = qFromBigEndian<uint16_t>(in + 4);
+    header.type = static_cast<MessageType>(qFromBigEndian<uint16_t>(in + 6));
+    header.payloadSize = qFromBigEndian<uint32_t>(in + 8);
+    header.sequenceNumber = qFromBigEndian<uint32_t>(in + 12);
+    header.timestamp = qFromBigEndian<uint64_t>(in + 16);
+    header.checksum = qFromBigEndian<uint32_t>(in + 24);
+    header.encoding = static_cast<PayloadEncoding>(qFromBigEndian<uint16_t>(in + 28));
+    header.reserved = qFromBigEndian<uint16_t>(in + 30);
+    return header;
 }
 
-void IpcMessage::updateChecksum()
+void MessageHeader::patchSequenceNumber(char* header, uint32_t sequenceNumber)
 {
-    QByteArray payloadData;
-    {
-        QDataStream payloadStream(&payloadData, QIODevice::WriteOnly);
-        payloadStream.setVersion(QDataStream::Qt_6_0);
-        payloadStream << m_payload;
-    }
-    m_header.checksum = calculateChecksum(payloadData);
+    qToBigEndian(sequenceNumber, header + 12);
 }
 
 QDataStream& operator<<(QDataStream& stream, const MessageHeader& header)
@@ -184,6 +199,8 @@ QDataStream& operator<<(QDataStream& stream, const MessageHeader& header)
     stream << header.sequenceNumber;
     stream << header.timestamp;
     stream << header.checksum;
+    stream << static_cast<uint16_t>(header.encoding);
+    stream << header.reserved;
     return stream;
 }
 
@@ -198,6 +215,10 @@ QDataStream& operator>>(QDataStream& stream, MessageHeader& header)
     stream >> header.sequenceNumber;
     stream >> header.timestamp;
     stream >> header.checksum;
+    uint16_t encodingValue;
+    stream >> encodingValue;
+    header.encoding = static_cast<PayloadEncoding>(encodingValue);
+    stream >> header.reserved;
     return stream;
 }
 
@@ -6,6 +6,7 @@
 #ifndef AUTOMOTIVE_IPC_MESSAGE_H
 #define AUTOMOTIVE_IPC_MESSAGE_H
 
+#include "ipc/IpcCodec.h"
 #include <QByteArray>
 #include <QVariantMap>
 #include <QString>
@@ -21,6 +22,7 @@ namespace ipc {
 enum class MessageType : uint16_t {
     Invalid = 0,
     Heartbeat = 1,
+    TransportSetup = 2,                ///< Shared-memory ring key (IpcChannel)
     SignalUpdate = 10,
     SignalBatch = 11,
     AlertNotify = 20,
@@ -36,6 +38,14 @@ enum class MessageType : uint16_t {
     Error = 255
 };
 
+/**
+ * @brief Encoding of the payload following the header
+ */
+enum class PayloadEncoding : uint16_t {
+    VariantMap = 0,                    ///< QVariantMap via QDataStream (Qt_6_0)
+    Compact = 1                        ///< Schema body via IpcCodec.h (IpcSchemas.h)
+};
+
 /**
  * @brief IPC message header
  *
@@ -44,7 +54,8 @@ enum class MessageType : uint16_t {
  */
 struct MessageHeader {
     static constexpr uint32_t MAGIC = 0x41555449;  // "AUTI"
-    static constexpr uint16_t VERSION = 1;
+    // 3: payload encoding field, 2: CRC32C checksum, 1: truncated MD5
+    static constexpr uint16_t VERSION = 3;
 
     uint32_t magic{MAGIC};
     uint16_t version{VERSION};
@@ -52,13 +63,34 @@ struct MessageHeader {
     uint32_t payloadSize{0};
     uint32_t sequenceNumber{0};
     uint64_t timestamp{0};
-    uint32_t checksum{0};  // CRC32 of payload
+    uint32_t checksum{0};  // CRC32C of payload (IpcIntegrity.h)
+    PayloadEncoding encoding{PayloadEncoding::VariantMap};
+    uint16_t reserved{0};
 
     bool isValid() const {
-        return magic == MAGIC && version == VERSION;
+        return magic == MAGIC && version == VERSION &&
+               (encoding == PayloadEncoding::VariantMap || encoding == PayloadEncoding::Compact);
     }
 
-    static constexpr size_t SIZE = 28;  // Fixed header size in bytes
+    static constexpr size_t SIZE = 32;  // Fixed header size in bytes
+
+    /**
+     * @brief Write the SIZE-byte wire form (big endian, as operator<<)
+     */
+    void encode(char* out) const;
+
+    /**
+     * @brief Read the wire form from at least SIZE bytes
+     */
+    static MessageHeader decode(const char* in);
+
+    /**
+     * @brief Overwrite the sequence number of an encoded header
+     *
+     * The checksum covers the payload only, so a serialized message can be
+     * renumbered per receiver without touching its payload.
+     */
+    static void patchSequenceNumber(char* header, uint32_t sequenceNumber);
 };
 
 /**
@@ -79,7 +111,42 @@ public:
     uint64_t timestamp() const { return m_header.timestamp; }
     bool isValid() const { return m_valid; }
 
-    // Payload access
+    // Compact body access (IpcSchemas.h)
+    /**
+     * @brief Message of type Body::TYPE carrying @p body in compact encoding
+     */
+    template<typename Body>
+    static IpcMessage fromBody(const Body& body)
+    {
+        IpcMessage message(Body::TYPE);
+        message.m_header.encoding = PayloadEncoding::Compact;
+        encodeBody(body, &message.m_body);
+        return message;
+    }
+
+    /**
+     * @brief Decode the compact body into @p body
+     * @return false if the message is not a compact Body::TYPE message or
+     *         its body is malformed
+     *
+     * Decoding into the same body again reuses its list storage.
+     */
+    template<typename Body>
+    bool toBody(Body& body) const
+    {
+        return m_header.encoding == PayloadEncoding::Compact && m_header.type == Body::TYPE &&
+               decodeBody(m_body.constData(), m_body.size(), body);
+    }
+
+    PayloadEncoding encoding() const { return m_header.encoding; }
+
+    /**
+     * @brief Encoded compact body (empty for VariantMap messages)
+     */
+    const QByteArray& body() const { return m_body; }
+
+    // Payload access (VariantMap encoding; setting a value switches a
+    // compact message to it and drops the compact body)
     const QVariantMap& payload() const { return m_payload; }
     QVariant value(const QString& key) const { return m_payload.value(key); }
     void setValue(const QString& key, const QVariant& value);
@@ -89,21 +156,32 @@ public:
     QByteArray serialize() const;
     static IpcMessage deserialize(const QByteArray& data, bool* ok = nullptr);
 
+    /**
+     * @brief Deserialize from a view of @p size bytes (e.g. a received frame)
+     *
+     * The view is only read during the call; the message keeps no pointer
+     * into it.
+     */
+    static IpcMessage deserialize(const char* data, qsizetype size, bool* ok = nullptr);
+
     // Sequence number management
     void setSequenceNumber(uint32_t seq);
     static uint32_t nextSequenceNumber();
 
     // Validation
-    bool validateChecksum() const;
+    /**
+     * @brief True if the payload is the one the received checksum was
+     *        verified against (false for local or modified messages)
+     */
+    bool validateChecksum() const { return m_checksumVerified; }
     QString validationError() const { return m_validationError; }
 
 private:
-    static uint32_t calculateChecksum(const QByteArray& data);
-    void updateChecksum();
-
     MessageHeader m_header;
     QVariantMap m_payload;
+    QByteArray m_body;                 ///< Compact encoding
     bool m_valid{false};
+    bool m_checksumVerified{false};
     QString m_validationError;
 
     static uint32_t s_sequenceCounter;
@@ -0,0 +1,107 @@
+// IpcSchemas.h
+// Compact body schemas of the IPC message types
+// Part of: Shared Platform Layer
+// Security: CR-INF-001 - Field ids are part of the wire contract; never reuse one
+
+#ifndef AUTOMOTIVE_IPC_SCHEMAS_H
+#define AUTOMOTIVE_IPC_SCHEMAS_H
+
+#include "ipc/IpcCodec.h"
+#include "ipc/IpcMessage.h"
+#include <QString>
+#include <QVector>
+
+namespace automotive {
+namespace ipc {
+
+/**
+ * Each body is a plain struct naming its MessageType in TYPE and its field
+ * layout in fields(). The codec templates in IpcCodec.h generate encode
+ * and decode from that table. To evolve a schema, add members under new
+ * field ids; removed ids stay reserved.
+ *
+ * Signals are addressed by catalog index (the SignalHub handle of the
+ * shared catalog), not by identifier string.
+ */
+
+/**
+ * @brief MessageType::TransportSetup - ring pair offered by the server end
+ *
+ * Sent once on the socket of a ChannelTransport::SharedMemory channel.
+ */
+struct TransportSetupBody {
+    static constexpr MessageType TYPE = MessageType::TransportSetup;
+
+    QString key;                       ///< RingTransport segment key
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &TransportSetupBody::key));
+    }
+};
+
+/**
+ * @brief One signal value inside a SignalBatchBody
+ */
+struct SignalSample {
+    uint32_t signal{0};                ///< Catalog index of the signal
+    double value{0.0};                 ///< Committed value
+    uint8_t validity{0};               ///< SignalValidity (0 = Valid)
+    uint32_t ageMs{0};                 ///< Batch timestamp minus the sample's source time
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &SignalSample::signal),
+                               field(2, &SignalSample::value),
+                               field(3, &SignalSample::validity),
+                               field(4, &SignalSample::ageMs));
+    }
+};
+
+/**
+ * @brief MessageType::SignalUpdate - a single signal value
+ */
+struct SignalUpdateBody {
+    static constexpr MessageType TYPE = MessageType::SignalUpdate;
+
+    uint32_t signal{0};                ///< Catalog index of the signal
+    double value{0.0};                 ///< Committed value
+    uint8_t validity{0};               ///< SignalValidity (0 = Valid)
+    uint64_t sourceTimestampMs{0};     ///< Source time (0 = unknown)
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &SignalUpdateBody::signal),
+                               field(2, &SignalUpdateBody::value),
+                               field(3, &SignalUpdateBody::validity),
+                               field(4, &SignalUpdateBody::sourceTimestampMs));
+    }
+};
+
+/**
+ * @brief MessageType::SignalBatch - the signals changed in one tick
+ */
+struct SignalBatchBody {
+    static constexpr MessageType TYPE = MessageType::SignalBatch;
+
+    uint64_t timestampMs{0};           ///< Batch time; samples carry their age against it
+    uint32_t tick{0};                  ///< Producer tick counter
+    QVector<SignalSample> samples;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &SignalBatchBody::timestampMs),
+                               field(2, &SignalBatchBody::tick),
+                               field(3, &SignalBatchBody::samples));
+    }
+};
+
+static_assert(schemaValid<TransportSetupBody>(), "TransportSetupBody field ids");
+static_assert(schemaValid<SignalSample>(), "SignalSample field ids");
+static_assert(schemaValid<SignalUpdateBody>(), "SignalUpdateBody field ids");
+static_assert(schemaValid<SignalBatchBody>(), "SignalBatchBody field ids");
+
+} // namespace ipc
+} // namespace automotive
+
+#endif // AUTOMOTIVE_IPC_SCHEMAS_H
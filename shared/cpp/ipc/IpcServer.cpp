@@ -2,6 +2,7 @@
 // IPC server implementation
 
 #include "ipc/IpcServer.h"
+#include <QCoreApplication>
 #include <QDebug>
 
 namespace automotive {
@@ -19,6 +20,12 @@ IpcServer::~IpcServer()
     close();
 }
 
+void IpcServer::setTransport(ChannelTransport transport, uint32_t ringCapacity)
+{
+    m_transport = transport;
+    m_ringCapacity = ringCapacity;
+}
+
 bool IpcServer::listen(const QString& serverName)
 {
     if (m_server.isListening()) {
@@ -63,9 +70,14 @@ QString IpcServer::serverName() const
 
 int IpcServer::broadcast(const IpcMessage& message)
 {
+    if (m_clients.isEmpty()) {
+        return 0;
+    }
+
+    const QByteArray frame = message.serialize();
     int sentCount = 0;
     for (IpcChannel* client : qAsConst(m_clients)) {
-        if (client->isConnected() && client->send(message)) {
+        if (client->isConnected() && client->sendFrame(frame)) {
             ++sentCount;
         }
     }
@@ -80,6 +92,20 @@ void IpcServer::onNewConnection()
 
         auto* channel = new IpcChannel(socket, this);
 
+        if (m_transport == ChannelTransport::SharedMemory) {
+            const QString key = QStringLiteral("%1.ring.%2.%3")
+                                    .arg(m_server.serverName())
+                                    .arg(QCoreApplication::applicationPid())
+                                    .arg(++m_ringSerial);
+            if (!channel->createSharedMemoryTransport(key, m_ringCapacity)) {
+                qWarning() << "IpcServer: Shared-memory transport failed -"
+                           << channel->lastError();
+                channel->disconnect();
+                channel->deleteLater();
+                continue;
+            }
+        }
+
         connect(channel, &IpcChannel::stateChanged,
                 this, &IpcServer::onChannelStateChanged);
         connect(channel, &IpcChannel::messageReceived,
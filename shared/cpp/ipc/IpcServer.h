@@ -29,6 +29,15 @@ public:
     explicit IpcServer(QObject* parent = nullptr);
     ~IpcServer() override;
 
+    /**
+     * @brief Select the transport for clients connecting from now on
+     * @param ringCapacity Bytes per direction of each client's ring pair
+     *
+     * Clients must select the same transport (IpcChannel::setTransport).
+     */
+    void setTransport(ChannelTransport transport,
+                      uint32_t ringCapacity = RingFormat::DEFAULT_CAPACITY);
+
     /**
      * @brief Start listening on the specified server name
      * @param serverName Name for the local server
@@ -60,6 +69,10 @@ public:
      * @brief Broadcast a message to all connected clients
      * @param message Message to broadcast
      * @return Number of clients message was sent to
+     *
+     * The message is serialized and checksummed once; every client gets
+     * the same frame with its channel's sequence number in the header
+     * (IpcChannel::sendFrame).
      */
     int broadcast(const IpcMessage& message);
 
@@ -95,6 +108,9 @@ private:
     QLocalServer m_server;
     QVector<IpcChannel*> m_clients;
     QString m_lastError;
+    ChannelTransport m_transport{ChannelTransport::LocalSocket};
+    uint32_t m_ringCapacity{RingFormat::DEFAULT_CAPACITY};
+    uint32_t m_ringSerial{0};          ///< Makes ring keys unique per connection
 };
 
 } // namespace ipc
@@ -0,0 +1,237 @@
+// IpcShmRing.cpp
+// Shared-memory ring pair implementation
+
+#include "ipc/IpcShmRing.h"
+#include <cstring>
+#include <new>
+
+namespace automotive {
+namespace ipc {
+
+namespace {
+
+uint32_t alignUp(uint32_t offset)
+{
+    return (offset + RingFormat::ALIGNMENT - 1) & ~(RingFormat::ALIGNMENT - 1);
+}
+
+uint32_t ringCapacity(uint32_t requested)
+{
+    uint32_t capacity = RingFormat::MIN_CAPACITY;
+    while (capacity < requested && capacity < RingFormat::MAX_CAPACITY) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+uint32_t segmentSize(uint32_t capacity)
+{
+    return alignUp(sizeof(RingSegmentHeader)) + 2 * (sizeof(RingControl) + capacity);
+}
+
+void setError(QString* error, const QString& message)
+{
+    if (error) {
+        *error = message;
+    }
+}
+
+ByteRing ringAt(char* base, const RingSegmentHeader* header, int index)
+{
+    char* control = base + header->ringOffsets[index];
+    return ByteRing(reinterpret_cast<RingControl*>(control), control + sizeof(RingControl),
+                    header->capacity);
+}
+
+} // namespace
+
+// ============================================================================
+// ByteRing
+// ============================================================================
+
+bool ByteRing::write(const char* first, qsizetype firstSize,
+                     const char* second, qsizetype secondSize, bool* wakeConsumer)
+{
+    *wakeConsumer = false;
+    const uint64_t size = static_cast<uint64_t>(firstSize) + static_cast<uint64_t>(secondSize);
+    const uint64_t head = m_control->head.load(std::memory_order_relaxed);
+    const uint64_t used = head - m_control->tail.load(std::memory_order_acquire);
+    if (used > m_capacity || size > m_capacity - used) {
+        return false;                      // Full (or a corrupt tail: never overwrite)
+    }
+
+    copyIn(head, first, firstSize);
+    copyIn(head + static_cast<uint64_t>(firstSize), second, secondSize);
+
+    // Publish, then look for a sleeping consumer. Paired with the
+    // seq_cst store and load in prepareToSleep(): one side always sees
+    // the other, so a wakeup cannot be lost.
+    m_control->head.store(head + size, std::memory_order_seq_cst);
+    if (m_control->consumerWaiting.load(std::memory_order_seq_cst) != 0) {
+        *wakeConsumer = m_control->consumerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+    return true;
+}
+
+qsizetype ByteRing::writable() const
+{
+    const uint64_t used = m_control->head.load(std::memory_order_relaxed) -
+                          m_control->tail.load(std::memory_order_acquire);
+    return used <= m_capacity ? static_cast<qsizetype>(m_capacity - used) : -1;
+}
+
+bool ByteRing::prepareToWait(qsizetype size)
+{
+    // Paired with the seq_cst tail store in read() and the load in
+    // takeProducerWakeup(), as prepareToSleep() is with write()
+    m_control->producerWaiting.store(1, std::memory_order_seq_cst);
+    const uint64_t used = m_control->head.load(std::memory_order_relaxed) -
+                          m_control->tail.load(std::memory_order_seq_cst);
+    if (used <= m_capacity && static_cast<uint64_t>(size) <= m_capacity - used) {
+        m_control->producerWaiting.exchange(0, std::memory_order_seq_cst);
+        return false;
+    }
+    return true;
+}
+
+void ByteRing::copyIn(uint64_t position, const char* data, qsizetype size)
+{
+    const uint32_t offset = static_cast<uint32_t>(position) & (m_capacity - 1);
+    const size_t untilEnd = qMin<size_t>(static_cast<size_t>(size), m_capacity - offset);
+    if (size > 0) {
+        std::memcpy(m_data + offset, data, untilEnd);
+        std::memcpy(m_data, data + untilEnd, static_cast<size_t>(size) - untilEnd);
+    }
+}
+
+qsizetype ByteRing::readable() const
+{
+    const uint64_t available = m_control->head.load(std::memory_order_acquire) -
+                               m_control->tail.load(std::memory_order_relaxed);
+    return available <= m_capacity ? static_cast<qsizetype>(available) : -1;
+}
+
+void ByteRing::read(char* out, qsizetype size)
+{
+    const uint64_t tail = m_control->tail.load(std::memory_order_relaxed);
+    const uint32_t offset = static_cast<uint32_t>(tail) & (m_capacity - 1);
+    const size_t untilEnd = qMin<size_t>(static_cast<size_t>(size), m_capacity - offset);
+    std::memcpy(out, m_data + offset, untilEnd);
+    std::memcpy(out + untilEnd, m_data, static_cast<size_t>(size) - untilEnd);
+    m_control->tail.store(tail + static_cast<uint64_t>(size), std::memory_order_seq_cst);
+}
+
+bool ByteRing::takeProducerWakeup()
+{
+    return m_control->producerWaiting.load(std::memory_order_seq_cst) != 0 &&
+           m_control->producerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+bool ByteRing::prepareToSleep()
+{
+    m_control->consumerWaiting.store(1, std::memory_order_seq_cst);
+    if (m_control->head.load(std::memory_order_seq_cst) !=
+        m_control->tail.load(std::memory_order_relaxed)) {
+        m_control->consumerWaiting.exchange(0, std::memory_order_seq_cst);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// RingTransport
+// ============================================================================
+
+bool RingTransport::create(const QString& key, uint32_t capacity, QString* error)
+{
+    capacity = ringCapacity(capacity);
+    const uint32_t totalSize = segmentSize(capacity);
+
+    m_memory.setKey(key);
+    if (!m_memory.create(static_cast<qsizetype>(totalSize))) {
+        if (m_memory.error() != QSharedMemory::AlreadyExists) {
+            setError(error, m_memory.errorString());
+            return false;
+        }
+        // Left behind by a peer that did not shut down: reclaim it
+        if (m_memory.attach()) {
+            m_memory.detach();
+        }
+        if (!m_memory.create(static_cast<qsizetype>(totalSize))) {
+            setError(error, m_memory.errorString());
+            return false;
+        }
+    }
+
+    char* base = static_cast<char*>(m_memory.data());
+    std::memset(base, 0, totalSize);
+
+    auto* header = new (base) RingSegmentHeader;
+    std::memcpy(header->magic, RingFormat::MAGIC, sizeof(header->magic));
+    header->formatVersion = RingFormat::VERSION;
+    header->headerSize = sizeof(RingSegmentHeader);
+    header->controlSize = sizeof(RingControl);
+    header->capacity = capacity;
+    header->ringOffsets[0] = alignUp(sizeof(RingSegmentHeader));
+    header->ringOffsets[1] = header->ringOffsets[0] + sizeof(RingControl) + capacity;
+    header->totalSize = totalSize;
+
+    for (int i = 0; i < 2; ++i) {
+        auto* control = new (base + header->ringOffsets[i]) RingControl;  // Zeroed above
+        // Doorbell armed: the first write wakes a consumer that has not
+        // started reading yet
+        control->consumerWaiting.store(1, std::memory_order_relaxed);
+    }
+
+    m_tx = ringAt(base, header, 0);
+    m_rx = ringAt(base, header, 1);
+    header->state.store(RingFormat::Ready, std::memory_order_release);
+    return true;
+}
+
+bool RingTransport::attach(const QString& key, QString* error)
+{
+    m_memory.setKey(key);
+    if (!m_memory.attach()) {
+        setError(error, m_memory.errorString());
+        return false;
+    }
+
+    char* base = static_cast<char*>(m_memory.data());
+    const qsizetype size = m_memory.size();
+    const auto* header = reinterpret_cast<const RingSegmentHeader*>(base);
+
+    QString problem;
+    if (size < static_cast<qsizetype>(sizeof(RingSegmentHeader)) ||
+        std::memcmp(header->magic, RingFormat::MAGIC, sizeof(header->magic)) != 0) {
+        problem = QStringLiteral("Not an IPC ring segment");
+    } else if (header->formatVersion != RingFormat::VERSION ||
+               header->headerSize != sizeof(RingSegmentHeader) ||
+               header->controlSize != sizeof(RingControl)) {
+        problem = QStringLiteral("Incompatible IPC ring layout");
+    } else if (header->state.load(std::memory_order_acquire) != RingFormat::Ready) {
+        problem = QStringLiteral("IPC ring segment is not ready");
+    } else if (header->capacity < RingFormat::MIN_CAPACITY ||
+               header->capacity > RingFormat::MAX_CAPACITY ||
+               (header->capacity & (header->capacity - 1)) != 0 ||
+               header->totalSize != segmentSize(header->capacity) ||
+               static_cast<qsizetype>(header->totalSize) > size ||
+               header->ringOffsets[0] != alignUp(sizeof(RingSegmentHeader)) ||
+               header->ringOffsets[1] != header->ringOffsets[0] + sizeof(RingControl) +
+                                             header->capacity) {
+        problem = QStringLiteral("Truncated IPC ring segment");
+    }
+
+    if (!problem.isEmpty()) {
+        setError(error, problem);
+        m_memory.detach();
+        return false;
+    }
+
+    m_tx = ringAt(base, header, 1);
+    m_rx = ringAt(base, header, 0);
+    return true;
+}
+
+} // namespace ipc
+} // namespace automotive
@@ -0,0 +1,192 @@
+// IpcShmRing.h
+// Shared-memory ring pair carrying IPC frames between two processes
+// Part of: Shared Platform Layer
+// Security: CR-INF-001 - Ring indices written by the peer are bounds-checked
+
+#ifndef AUTOMOTIVE_IPC_SHM_RING_H
+#define AUTOMOTIVE_IPC_SHM_RING_H
+
+#include <QSharedMemory>
+#include <QString>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace automotive {
+namespace ipc {
+
+/**
+ * @brief Segment layout
+ *
+ * [header][ring 0 control][ring 0 data][ring 1 control][ring 1 data]
+ *
+ * Ring 0 carries creator -> attacher bytes, ring 1 the other direction.
+ * Controls and data start on a cache line. Host byte order and layout:
+ * both ends are builds of this code on one SoC, which the format version
+ * and the recorded sizes guard.
+ */
+namespace RingFormat {
+    constexpr char MAGIC[4] = {'A', 'I', 'R', 'G'};
+    constexpr uint16_t VERSION = 2;
+    constexpr uint32_t ALIGNMENT = 64;
+    constexpr uint32_t MIN_CAPACITY = 4 * 1024;
+    constexpr uint32_t DEFAULT_CAPACITY = 1024 * 1024;
+    constexpr uint32_t MAX_CAPACITY = 64 * 1024 * 1024;
+
+    enum State : uint32_t {
+        Initializing = 0,
+        Ready = 1
+    };
+}
+
+struct RingSegmentHeader {
+    char magic[4];                     ///< RingFormat::MAGIC
+    uint16_t formatVersion;            ///< RingFormat::VERSION
+    uint16_t headerSize;               ///< sizeof(RingSegmentHeader)
+    uint32_t controlSize;              ///< sizeof(RingControl)
+    uint32_t capacity;                 ///< Data bytes per ring (power of two)
+    uint32_t ringOffsets[2];           ///< Byte offset of each ring's control
+    uint32_t totalSize;                ///< Bytes used by the segment
+    std::atomic<uint32_t> state;       ///< RingFormat::State
+};
+
+/**
+ * @brief Indices of one single-producer/single-consumer byte ring
+ *
+ * head and tail count bytes since creation (never wrapped), so
+ * head - tail is the fill level. Producer and consumer fields live on
+ * separate cache lines.
+ */
+struct RingControl {
+    std::atomic<uint64_t> head;        ///< Written by the producer
+    std::atomic<uint32_t> producerWaiting; ///< Producer wants a doorbell once space frees up
+    uint8_t producerPad[52];
+    std::atomic<uint64_t> tail;        ///< Written by the consumer
+    std::atomic<uint32_t> consumerWaiting; ///< Consumer wants a doorbell for the next write
+    uint8_t consumerPad[52];
+};
+
+static_assert(std::is_standard_layout<RingSegmentHeader>::value, "Header must be standard layout");
+static_assert(sizeof(RingControl) == 2 * RingFormat::ALIGNMENT, "Control is two cache lines");
+static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<uint64_t>::is_always_lock_free,
+              "Shared atomics must be lock-free (address-free)");
+
+/**
+ * @brief One direction of a ring pair, seen from one end
+ *
+ * Writes are all-or-nothing so the reader only ever sees whole frames
+ * appended. The doorbell protocol batches wakeups: the consumer arms
+ * consumerWaiting before it sleeps, and only the first write after that
+ * asks the caller to ring the doorbell. The same works in reverse for a
+ * producer that found the ring full: it arms producerWaiting, and the
+ * first read after that asks the consumer to ring back.
+ */
+class ByteRing {
+public:
+    ByteRing() = default;
+    ByteRing(RingControl* control, char* data, uint32_t capacity)
+        : m_control(control), m_data(data), m_capacity(capacity) {}
+
+    bool isValid() const { return m_control != nullptr; }
+    uint32_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief Producer: append @p first followed by @p second
+     * @param wakeConsumer Set to true if the consumer is asleep and must
+     *        be woken (at most once per sleep)
+     * @return false if the ring lacks space for both; nothing is written
+     */
+    bool write(const char* first, qsizetype firstSize,
+               const char* second, qsizetype secondSize, bool* wakeConsumer);
+
+    /**
+     * @brief Producer: free bytes, or -1 if the peer corrupted the indices
+     */
+    qsizetype writable() const;
+
+    /**
+     * @brief Producer: arm the doorbell before waiting for @p size bytes
+     *        of space
+     * @return false if the space freed up meanwhile (doorbell disarmed;
+     *         write on)
+     */
+    bool prepareToWait(qsizetype size);
+
+    /**
+     * @brief Consumer: bytes ready to read, or -1 if the peer corrupted
+     *        the indices
+     */
+    qsizetype readable() const;
+
+    /**
+     * @brief Consumer: move @p size bytes (at most readable()) to @p out
+     */
+    void read(char* out, qsizetype size);
+
+    /**
+     * @brief Consumer: after read(), whether a producer waiting for space
+     *        must be woken (at most once per wait)
+     */
+    bool takeProducerWakeup();
+
+    /**
+     * @brief Consumer: arm the doorbell before sleeping
+     * @return false if data arrived meanwhile (doorbell disarmed; read on)
+     */
+    bool prepareToSleep();
+
+private:
+    void copyIn(uint64_t position, const char* data, qsizetype size);
+
+    RingControl* m_control{nullptr};
+    char* m_data{nullptr};
+    uint32_t m_capacity{0};
+};
+
+/**
+ * @brief Ring pair in one QSharedMemory segment
+ *
+ * One end create()s the segment and hands its key to the other, which
+ * attach()es; each then writes to tx() and reads rx(). The segment goes
+ * away when both ends have detached. No wakeup mechanism of its own:
+ * the owner rings a doorbell when write() asks it to.
+ */
+class RingTransport {
+public:
+    RingTransport() = default;
+    ~RingTransport() = default;
+
+    RingTransport(const RingTransport&) = delete;
+    RingTransport& operator=(const RingTransport&) = delete;
+
+    /**
+     * @brief Create the segment @p key with two rings of @p capacity bytes
+     *
+     * The capacity is rounded up to a power of two within
+     * [MIN_CAPACITY, MAX_CAPACITY]. A stale segment under the same key
+     * is replaced.
+     */
+    bool create(const QString& key, uint32_t capacity = RingFormat::DEFAULT_CAPACITY,
+                QString* error = nullptr);
+
+    /**
+     * @brief Attach to the segment @p key created by the peer
+     */
+    bool attach(const QString& key, QString* error = nullptr);
+
+    bool isOpen() const { return m_tx.isValid(); }
+
+    ByteRing& tx() { return m_tx; }
+    ByteRing& rx() { return m_rx; }
+
+private:
+    QSharedMemory m_memory;
+    ByteRing m_tx;
+    ByteRing m_rx;
+};
+
+} // namespace ipc
+} // namespace automotive
+
+#endif // AUTOMOTIVE_IPC_SHM_RING_H
@@ -0,0 +1,121 @@
+// FreshnessQueue.cpp
+// Deadline-ordered freshness tracking implementation
+
+#include "signal/FreshnessQueue.h"
+
+namespace automotive {
+namespace signal {
+
+void FreshnessQueue::addSignal()
+{
+    m_positions.append(NOT_QUEUED);
+    if (m_heap.capacity() < m_positions.size()) {
+        m_heap.reserve(m_positions.capacity());  // Grow with positions, not per signal
+    }
+}
+
+void FreshnessQueue::reserve(int count)
+{
+    m_positions.reserve(count);
+    m_heap.reserve(count);
+}
+
+void FreshnessQueue::schedule(uint32_t index, qint64 deadlineMs)
+{
+    Q_ASSERT(index < static_cast<uint32_t>(m_positions.size()));
+
+    const uint32_t pos = m_positions[index];
+    if (pos == NOT_QUEUED) {
+        const int last = static_cast<int>(m_heap.size());
+        m_heap.append({deadlineMs, index});
+        m_positions[index] = static_cast<uint32_t>(last);
+        siftUp(last);
+        return;
+    }
+
+    const qint64 previous = m_heap[pos].deadlineMs;
+    m_heap[pos].deadlineMs = deadlineMs;
+    if (deadlineMs < previous) {
+        siftUp(static_cast<int>(pos));
+    } else {
+        siftDown(static_cast<int>(pos));
+    }
+}
+
+void FreshnessQueue::cancel(uint32_t index)
+{
+    if (!isScheduled(index)) {
+        return;
+    }
+    removeAt(static_cast<int>(m_positions[index]));
+}
+
+bool FreshnessQueue::popExpired(qint64 nowMs, uint32_t& index)
+{
+    if (m_heap.isEmpty() || nowMs <= m_heap.first().deadlineMs) {
+        return false;
+    }
+
+    index = m_heap.first().index;
+    removeAt(0);
+    return true;
+}
+
+void FreshnessQueue::removeAt(int pos)
+{
+    m_positions[m_heap[pos].index] = NOT_QUEUED;
+
+    const int last = static_cast<int>(m_heap.size()) - 1;
+    if (pos != last) {
+        place(pos, m_heap[last]);
+        m_heap.removeLast();
+        siftUp(pos);
+        siftDown(pos);
+    } else {
+        m_heap.removeLast();
+    }
+}
+
+void FreshnessQueue::place(int pos, const Entry& entry)
+{
+    m_heap[pos] = entry;
+    m_positions[entry.index] = static_cast<uint32_t>(pos);
+}
+
+void FreshnessQueue::siftUp(int pos)
+{
+    const Entry entry = m_heap[pos];
+    while (pos > 0) {
+        const int parent = (pos - 1) / 2;
+        if (m_heap[parent].deadlineMs <= entry.deadlineMs) {
+            break;
+        }
+        place(pos, m_heap[parent]);
+        pos = parent;
+    }
+    place(pos, entry);
+}
+
+void FreshnessQueue::siftDown(int pos)
+{
+    const int count = static_cast<int>(m_heap.size());
+    const Entry entry = m_heap[pos];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && m_heap[child + 1].deadlineMs < m_heap[child].deadlineMs) {
+            ++child;
+        }
+        if (entry.deadlineMs <= m_heap[child].deadlineMs) {
+            break;
+        }
+        place(pos, m_heap[child]);
+        pos = child;
+    }
+    place(pos, entry);
+}
+
+} // namespace signal
+} // namespace automotive
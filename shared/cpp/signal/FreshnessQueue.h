@@ -0,0 +1,97 @@
+// FreshnessQueue.h
+// Deadline-ordered freshness tracking for SignalHub
+// Part of: Shared Platform Layer
+// Safety: Drives SR-CL-001 stale detection
+
+#ifndef AUTOMOTIVE_FRESHNESS_QUEUE_H
+#define AUTOMOTIVE_FRESHNESS_QUEUE_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <cstdint>
+#include <limits>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Indexed min-heap of signal expiry deadlines
+ *
+ * Holds at most one deadline (timestampMs + freshnessMs) per signal index,
+ * ordered by deadline. Rescheduling a signal moves its existing entry, so a
+ * freshness tick only touches the signals that actually expire:
+ * O(k log n) for k expiries instead of a scan of all n signals.
+ *
+ * Storage is sized at registration; schedule/cancel/pop never allocate.
+ * Not thread-safe; SignalHub guards it with its writer mutex.
+ */
+class FreshnessQueue {
+public:
+    static constexpr qint64 NO_DEADLINE = std::numeric_limits<qint64>::max();
+
+    /**
+     * @brief Make room for one more signal (registration phase only)
+     */
+    void addSignal();
+
+    /**
+     * @brief Pre-size for @p count signals (registration phase only)
+     */
+    void reserve(int count);
+
+    /**
+     * @brief Set or move the deadline of a signal
+     */
+    void schedule(uint32_t index, qint64 deadlineMs);
+
+    /**
+     * @brief Remove the deadline of a signal (no-op if none)
+     */
+    void cancel(uint32_t index);
+
+    /**
+     * @brief Pop the earliest signal whose deadline is before nowMs
+     * @param nowMs Current monotonic time
+     * @param index Receives the expired signal index
+     * @return false if no deadline has passed
+     *
+     * A signal expires when nowMs > deadline (matching "age > freshnessMs").
+     */
+    bool popExpired(qint64 nowMs, uint32_t& index);
+
+    bool isScheduled(uint32_t index) const {
+        return index < static_cast<uint32_t>(m_positions.size()) &&
+               m_positions[index] != NOT_QUEUED;
+    }
+
+    /**
+     * @brief Earliest pending deadline, NO_DEADLINE if none
+     */
+    qint64 nextDeadline() const {
+        return m_heap.isEmpty() ? NO_DEADLINE : m_heap.first().deadlineMs;
+    }
+
+    int size() const { return static_cast<int>(m_heap.size()); }
+    bool isEmpty() const { return m_heap.isEmpty(); }
+
+private:
+    static constexpr uint32_t NOT_QUEUED = 0xFFFFFFFFu;
+
+    struct Entry {
+        qint64 deadlineMs;
+        uint32_t index;
+    };
+
+    void siftUp(int pos);
+    void siftDown(int pos);
+    void place(int pos, const Entry& entry);
+    void removeAt(int pos);
+
+    QVector<Entry> m_heap;            ///< Binary min-heap on deadlineMs
+    QVector<uint32_t> m_positions;    ///< Signal index -> heap position
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_FRESHNESS_QUEUE_H
@@ -0,0 +1,72 @@
+// SignalCatalog.cpp
+// Compile-time signal catalog implementation
+
+#include "signal/SignalCatalog.h"
+#include "signal/SignalHub.h"
+#include <QDebug>
+
+namespace automotive {
+namespace signal {
+
+SignalDefinition toSignalDefinition(const SignalSpec& spec)
+{
+    SignalDefinition def;
+    def.id = QString::fromLatin1(spec.id);
+    def.name = QString::fromLatin1(spec.name);
+    def.unit = QString::fromUtf8(spec.unit);
+    def.kind = spec.kind;
+    if (spec.hasMin) {
+        def.minValue = spec.minValue;
+    }
+    if (spec.hasMax) {
+        def.maxValue = spec.maxValue;
+    }
+
+    switch (spec.kind) {
+    case SignalKind::Double:
+        def.defaultValue = spec.defaultValue;
+        break;
+    case SignalKind::Int:
+    case SignalKind::Enum:
+        def.defaultValue = static_cast<qint64>(spec.defaultValue);
+        break;
+    case SignalKind::Bool:
+        def.defaultValue = spec.defaultValue != 0.0;
+        break;
+    case SignalKind::String:
+        def.defaultValue = QString::fromUtf8(spec.defaultText);
+        break;
+    }
+
+    def.freshnessMs = spec.freshnessMs;
+    def.maxRateOfChange = spec.maxRateOfChange;
+    def.isSafetyCritical = spec.isSafetyCritical;
+    def.historyCapacity = spec.historyCapacity;
+    def.historyDecimation = spec.historyDecimation;
+    def.deadbandAbsolute = spec.deadbandAbsolute;
+    def.deadbandRelative = spec.deadbandRelative;
+    def.displayResolution = spec.displayResolution;
+    def.minPublishIntervalMs = spec.minPublishIntervalMs;
+    return def;
+}
+
+bool registerCatalog(SignalHub& hub, const SignalSpec* specs, int count)
+{
+    if (hub.signalCount() != 0) {
+        qWarning() << "SignalHub: Catalog must be registered with an empty hub";
+        return false;
+    }
+
+    hub.reserveSignals(count);
+    for (int i = 0; i < count; ++i) {
+        const SignalHandle handle = hub.registerSignal(toSignalDefinition(specs[i]));
+        if (handle.index != static_cast<uint32_t>(i)) {
+            qWarning() << "SignalHub: Catalog entry" << i << "not registered:" << specs[i].id;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace signal
+} // namespace automotive
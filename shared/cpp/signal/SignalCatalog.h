@@ -0,0 +1,236 @@
+// SignalCatalog.h
+// Compile-time signal catalog: constexpr definitions and typed signal tags
+// Part of: Shared Platform Layer
+// Safety: Signal identity, kind and limits fixed at build time
+
+#ifndef AUTOMOTIVE_SIGNAL_CATALOG_H
+#define AUTOMOTIVE_SIGNAL_CATALOG_H
+
+#include "signal/SignalTypes.h"
+#include <QString>
+#include <cstddef>
+
+namespace automotive {
+namespace signal {
+
+class SignalHub;
+
+/**
+ * @brief constexpr form of SignalDefinition
+ *
+ * Literal type, so a whole catalog can live in read-only data and be
+ * checked with static_assert. Built with the numeric()/boolean()/text()
+ * helpers and the chained with*() modifiers, e.g.
+ * @code
+ * SignalSpec::numeric(SignalIds::VEHICLE_SPEED, "Vehicle Speed", "km/h", 0.0, 400.0, 300)
+ *     .withRate(50.0).critical()
+ * @endcode
+ */
+struct SignalSpec {
+    const char* id{nullptr};           ///< Unique signal identifier
+    const char* name{""};              ///< Human-readable name
+    const char* unit{""};              ///< Unit of measurement
+    SignalKind kind{SignalKind::Double}; ///< Storage kind of the value
+    bool hasMin{false};                ///< minValue is set
+    bool hasMax{false};                ///< maxValue is set
+    double minValue{0.0};              ///< Minimum valid value
+    double maxValue{0.0};              ///< Maximum valid value
+    double defaultValue{0.0};          ///< Default value (non-string kinds)
+    const char* defaultText{""};       ///< Default value (String kind)
+    qint64 freshnessMs{300};           ///< Freshness timeout in ms
+    double maxRateOfChange{0.0};       ///< Maximum rate of change (0 = disabled)
+    bool isSafetyCritical{false};      ///< Safety-critical flag
+    int historyCapacity{0};            ///< Samples kept for trend queries
+    int historyDecimation{1};          ///< Store every Nth valid update
+    double deadbandAbsolute{0.0};      ///< See SignalDefinition
+    double deadbandRelative{0.0};      ///< See SignalDefinition
+    double displayResolution{0.0};     ///< See SignalDefinition
+    qint64 minPublishIntervalMs{0};    ///< See SignalDefinition
+
+    /**
+     * @brief Bounded numeric (Double) signal
+     */
+    static constexpr SignalSpec numeric(const char* id, const char* name, const char* unit,
+                                        double minValue, double maxValue, qint64 freshnessMs)
+    {
+        SignalSpec spec;
+        spec.id = id;
+        spec.name = name;
+        spec.unit = unit;
+        spec.hasMin = true;
+        spec.hasMax = true;
+        spec.minValue = minValue;
+        spec.maxValue = maxValue;
+        spec.freshnessMs = freshnessMs;
+        return spec;
+    }
+
+    /**
+     * @brief Bool signal defaulting to false
+     */
+    static constexpr SignalSpec boolean(const char* id, const char* name, qint64 freshnessMs)
+    {
+        SignalSpec spec;
+        spec.id = id;
+        spec.name = name;
+        spec.kind = SignalKind::Bool;
+        spec.freshnessMs = freshnessMs;
+        return spec;
+    }
+
+    /**
+     * @brief String signal
+     */
+    static constexpr SignalSpec text(const char* id, const char* name,
+                                     const char* defaultText, qint64 freshnessMs)
+    {
+        SignalSpec spec;
+        spec.id = id;
+        spec.name = name;
+        spec.kind = SignalKind::String;
+        spec.defaultText = defaultText;
+        spec.freshnessMs = freshnessMs;
+        return spec;
+    }
+
+    constexpr SignalSpec ofKind(SignalKind k) const { SignalSpec s = *this; s.kind = k; return s; }
+    constexpr SignalSpec withDefault(double v) const { SignalSpec s = *this; s.defaultValue = v; return s; }
+    constexpr SignalSpec withRate(double r) const { SignalSpec s = *this; s.maxRateOfChange = r; return s; }
+    constexpr SignalSpec critical() const { SignalSpec s = *this; s.isSafetyCritical = true; return s; }
+
+    constexpr SignalSpec withHistory(int capacity, int decimation = 1) const {
+        SignalSpec s = *this;
+        s.historyCapacity = capacity;
+        s.historyDecimation = decimation;
+        return s;
+    }
+
+    constexpr SignalSpec withDeadband(double absolute, double relative = 0.0) const {
+        SignalSpec s = *this;
+        s.deadbandAbsolute = absolute;
+        s.deadbandRelative = relative;
+        return s;
+    }
+
+    constexpr SignalSpec withResolution(double step) const {
+        SignalSpec s = *this;
+        s.displayResolution = step;
+        return s;
+    }
+
+    constexpr SignalSpec withMinInterval(qint64 ms) const {
+        SignalSpec s = *this;
+        s.minPublishIntervalMs = ms;
+        return s;
+    }
+};
+
+/**
+ * @brief Expand a spec into a runtime SignalDefinition
+ */
+SignalDefinition toSignalDefinition(const SignalSpec& spec);
+
+/**
+ * @brief Register a catalog with an empty hub
+ * @param hub Hub with no signals registered yet
+ * @param specs Catalog table
+ * @param count Number of entries
+ * @return true if every entry was registered at its catalog index
+ *
+ * Catalog tags address signals by index, so the catalog must own handles
+ * 0..count-1; registering into a hub that already has signals is refused.
+ */
+bool registerCatalog(SignalHub& hub, const SignalSpec* specs, int count);
+
+template<std::size_t N>
+bool registerCatalog(SignalHub& hub, const SignalSpec (&specs)[N])
+{
+    return registerCatalog(hub, specs, static_cast<int>(N));
+}
+
+/**
+ * @brief Value type used by SignalHub::set<>() for each storage kind
+ */
+template<SignalKind Kind> struct CatalogValueType { using type = qint64; };
+template<> struct CatalogValueType<SignalKind::Double> { using type = double; };
+template<> struct CatalogValueType<SignalKind::Bool> { using type = bool; };
+template<> struct CatalogValueType<SignalKind::String> { using type = QString; };
+
+/**
+ * @brief Base of typed signal tags
+ *
+ * A tag names one catalog entry by index; the derived tag adds its
+ * identifier as @c id. Use with SignalHub::get<>() / set<>():
+ * @code
+ * hub.get<Signals::VehicleSpeed>();    // O(1), no string lookup
+ * hub.set<Signals::GearPosition>(QStringLiteral("D"));
+ * @endcode
+ * A misspelled tag does not compile; catalogMatches() verifies that tags
+ * and table agree.
+ */
+template<uint32_t Index, SignalKind Kind>
+struct CatalogSignal {
+    static constexpr uint32_t index = Index;
+    static constexpr SignalKind kind = Kind;
+    using ValueType = typename CatalogValueType<Kind>::type;
+
+    static constexpr SignalHandle handle() { return SignalHandle(Index); }
+};
+
+namespace detail {
+
+constexpr bool idEquals(const char* a, const char* b)
+{
+    if (a == nullptr || b == nullptr) {
+        return a == b;
+    }
+    while (*a != '\0' && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return *a == *b;
+}
+
+template<typename Tag>
+constexpr bool tagMatches(const SignalSpec* specs, std::size_t count)
+{
+    return Tag::index < count && idEquals(specs[Tag::index].id, Tag::id) &&
+           specs[Tag::index].kind == Tag::kind;
+}
+
+} // namespace detail
+
+/**
+ * @brief True if no two catalog entries share an identifier
+ */
+template<std::size_t N>
+constexpr bool catalogIdsUnique(const SignalSpec (&specs)[N])
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        if (specs[i].id == nullptr || specs[i].id[0] == '\0') {
+            return false;
+        }
+        for (std::size_t j = i + 1; j < N; ++j) {
+            if (detail::idEquals(specs[i].id, specs[j].id)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief True if every tag's index, identifier and kind match the table
+ *
+ * Meant for static_assert next to the catalog definition.
+ */
+template<typename... Tags, std::size_t N>
+constexpr bool catalogMatches(const SignalSpec (&specs)[N])
+{
+    return (detail::tagMatches<Tags>(specs, N) && ...);
+}
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_CATALOG_H
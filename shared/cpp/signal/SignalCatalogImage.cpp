@@ -0,0 +1,363 @@
+// SignalCatalogImage.cpp
+// Precompiled binary signal catalog implementation
+
+#include "signal/SignalCatalogImage.h"
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <array>
+#include <cstring>
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+constexpr std::array<uint32_t, 256> makeCrc32Table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCrc32Table = makeCrc32Table();
+
+uint32_t crc32(const uchar* data, qint64 size)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (qint64 i = 0; i < size; ++i) {
+        crc = kCrc32Table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void setError(QString* error, const QString& message)
+{
+    if (error) {
+        *error = message;
+    }
+}
+
+bool kindFromName(const QString& name, SignalKind* kind)
+{
+    static const QHash<QString, SignalKind> kinds = {
+        {QStringLiteral("double"), SignalKind::Double},
+        {QStringLiteral("int"), SignalKind::Int},
+        {QStringLiteral("bool"), SignalKind::Bool},
+        {QStringLiteral("enum"), SignalKind::Enum},
+        {QStringLiteral("string"), SignalKind::String},
+    };
+    const auto it = kinds.constFind(name);
+    if (it == kinds.constEnd()) {
+        return false;
+    }
+    *kind = it.value();
+    return true;
+}
+
+/**
+ * @brief Appends UTF-16 strings to the image string table, sharing duplicates
+ */
+class StringTableWriter {
+public:
+    CatalogImageString add(const QString& text) {
+        const auto it = m_offsets.constFind(text);
+        if (it != m_offsets.constEnd()) {
+            return {it.value(), static_cast<uint32_t>(text.size())};
+        }
+        const uint32_t offset = static_cast<uint32_t>(m_data.size() / sizeof(QChar));
+        m_data.append(reinterpret_cast<const char*>(text.constData()),
+                      text.size() * static_cast<qsizetype>(sizeof(QChar)));
+        m_offsets.insert(text, offset);
+        return {offset, static_cast<uint32_t>(text.size())};
+    }
+
+    const QByteArray& data() const { return m_data; }
+
+private:
+    QByteArray m_data;
+    QHash<QString, uint32_t> m_offsets;
+};
+
+} // namespace
+
+bool parseSignalCatalogJson(const QByteArray& json,
+                            QVector<SignalDefinition>* definitions,
+                            quint32* catalogVersion,
+                            QString* error)
+{
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(json, &parseError);
+    if (!document.isObject()) {
+        setError(error, QStringLiteral("Invalid catalog JSON: %1").arg(parseError.errorString()));
+        return false;
+    }
+
+    const QJsonObject root = document.object();
+    const QJsonArray signalArray = root.value(QStringLiteral("signals")).toArray();
+    *catalogVersion = static_cast<quint32>(root.value(QStringLiteral("version")).toInteger());
+
+    definitions->clear();
+    definitions->reserve(signalArray.size());
+    QHash<QString, int> seen;
+
+    for (const QJsonValue& value : signalArray) {
+        const QJsonObject object = value.toObject();
+        SignalDefinition def;
+        def.id = object.value(QStringLiteral("id")).toString();
+        if (def.id.isEmpty()) {
+            setError(error, QStringLiteral("Signal %1 has no id").arg(definitions->size()));
+            return false;
+        }
+        if (seen.contains(def.id)) {
+            setError(error, QStringLiteral("Duplicate signal id: %1").arg(def.id));
+            return false;
+        }
+        seen.insert(def.id, definitions->size());
+
+        const QString kindName = object.value(QStringLiteral("kind")).toString(QStringLiteral("double"));
+        if (!kindFromName(kindName, &def.kind)) {
+            setError(error, QStringLiteral("Signal %1 has unknown kind: %2").arg(def.id, kindName));
+            return false;
+        }
+
+        def.name = object.value(QStringLiteral("name")).toString(def.id);
+        def.unit = object.value(QStringLiteral("unit")).toString();
+        if (object.contains(QStringLiteral("min"))) {
+            def.minValue = object.value(QStringLiteral("min")).toDouble();
+        }
+        if (object.contains(QStringLiteral("max"))) {
+            def.maxValue = object.value(QStringLiteral("max")).toDouble();
+        }
+        def.defaultValue = object.value(QStringLiteral("default")).toVariant();
+        def.freshnessMs = object.value(QStringLiteral("freshnessMs")).toInteger(def.freshnessMs);
+        def.maxRateOfChange = object.value(QStringLiteral("maxRateOfChange")).toDouble();
+        def.isSafetyCritical = object.value(QStringLiteral("safetyCritical")).toBool();
+        def.historyCapacity = object.value(QStringLiteral("historyCapacity")).toInt();
+        def.historyDecimation = object.value(QStringLiteral("historyDecimation")).toInt(1);
+        def.deadbandAbsolute = object.value(QStringLiteral("deadbandAbsolute")).toDouble();
+        def.deadbandRelative = object.value(QStringLiteral("deadbandRelative")).toDouble();
+        def.displayResolution = object.value(QStringLiteral("displayResolution")).toDouble();
+        def.minPublishIntervalMs = object.value(QStringLiteral("minPublishIntervalMs")).toInteger();
+        definitions->append(def);
+    }
+
+    return true;
+}
+
+QByteArray buildSignalCatalogImage(const QVector<SignalDefinition>& definitions,
+                                   quint32 catalogVersion)
+{
+    StringTableWriter strings;
+    QVector<CatalogImageEntry> entries(definitions.size());
+
+    for (int i = 0; i < definitions.size(); ++i) {
+        const SignalDefinition& def = definitions.at(i);
+        CatalogImageEntry& entry = entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+
+        entry.id = strings.add(def.id);
+        entry.name = strings.add(def.name);
+        entry.unit = strings.add(def.unit);
+        entry.kind = static_cast<uint8_t>(def.kind);
+        if (def.kind == SignalKind::String) {
+            entry.defaultText = strings.add(def.defaultValue.toString());
+        } else {
+            entry.defaultValue = scalarFromVariant(def.defaultValue, def.kind).toDouble();
+        }
+        if (def.minValue.isValid()) {
+            entry.flags |= CatalogImageFormat::HasMin;
+            entry.minValue = def.minValue.toDouble();
+        }
+        if (def.maxValue.isValid()) {
+            entry.flags |= CatalogImageFormat::HasMax;
+            entry.maxValue = def.maxValue.toDouble();
+        }
+        if (def.isSafetyCritical) {
+            entry.flags |= CatalogImageFormat::SafetyCritical;
+        }
+        entry.maxRateOfChange = def.maxRateOfChange;
+        entry.deadbandAbsolute = def.deadbandAbsolute;
+        entry.deadbandRelative = def.deadbandRelative;
+        entry.displayResolution = def.displayResolution;
+        entry.freshnessMs = def.freshnessMs;
+        entry.minPublishIntervalMs = def.minPublishIntervalMs;
+        entry.historyCapacity = def.historyCapacity;
+        entry.historyDecimation = def.historyDecimation;
+    }
+
+    CatalogImageHeader header;
+    std::memcpy(header.magic, CatalogImageFormat::MAGIC, sizeof(header.magic));
+    header.formatVersion = CatalogImageFormat::VERSION;
+    header.headerSize = sizeof(CatalogImageHeader);
+    header.catalogVersion = catalogVersion;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.entrySize = sizeof(CatalogImageEntry);
+    header.stringsOffset = static_cast<uint32_t>(sizeof(CatalogImageHeader) +
+                                                 entries.size() * sizeof(CatalogImageEntry));
+    header.stringsSize = static_cast<uint32_t>(strings.data().size());
+    header.checksum = 0;
+
+    QByteArray image;
+    image.reserve(header.stringsOffset + header.stringsSize);
+    image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    image.append(reinterpret_cast<const char*>(entries.constData()),
+                 entries.size() * static_cast<qsizetype>(sizeof(CatalogImageEntry)));
+    image.append(strings.data());
+
+    header.checksum = crc32(reinterpret_cast<const uchar*>(image.constData()) + sizeof(header),
+                            image.size() - static_cast<qsizetype>(sizeof(header)));
+    std::memcpy(image.data(), &header, sizeof(header));
+    return image;
+}
+
+std::shared_ptr<const SignalCatalogImage> SignalCatalogImage::open(const QString& path,
+                                                                   QString* error)
+{
+    std::shared_ptr<SignalCatalogImage> image(new SignalCatalogImage());
+    image->m_file.setFileName(path);
+    if (!image->m_file.open(QIODevice::ReadOnly)) {
+        setError(error, QStringLiteral("Cannot open %1: %2").arg(path, image->m_file.errorString()));
+        return nullptr;
+    }
+
+    image->m_size = image->m_file.size();
+    if (image->m_size > 0) {
+        image->m_mapped = image->m_file.map(0, image->m_size);
+    }
+    image->m_file.close();  // The mapping stays valid until unmapped
+    if (!image->m_mapped) {
+        setError(error, QStringLiteral("Cannot map %1").arg(path));
+        return nullptr;
+    }
+    image->m_base = image->m_mapped;
+
+    if (!image->validate(error)) {
+        return nullptr;
+    }
+    return image;
+}
+
+std::shared_ptr<const SignalCatalogImage> SignalCatalogImage::fromData(const QByteArray& data,
+                                                                       QString* error)
+{
+    std::shared_ptr<SignalCatalogImage> image(new SignalCatalogImage());
+    image->m_data = data;
+    image->m_base = reinterpret_cast<const uchar*>(image->m_data.constData());
+    image->m_size = image->m_data.size();
+
+    if (!image->validate(error)) {
+        return nullptr;
+    }
+    return image;
+}
+
+SignalCatalogImage::~SignalCatalogImage()
+{
+    if (m_mapped) {
+        m_file.unmap(m_mapped);
+    }
+}
+
+bool SignalCatalogImage::validate(QString* error) const
+{
+    if (m_size < static_cast<qint64>(sizeof(CatalogImageHeader))) {
+        setError(error, QStringLiteral("Catalog image truncated"));
+        return false;
+    }
+    if (reinterpret_cast<quintptr>(m_base) % alignof(CatalogImageEntry) != 0) {
+        setError(error, QStringLiteral("Catalog image misaligned"));
+        return false;
+    }
+
+    const CatalogImageHeader* h = header();
+    if (std::memcmp(h->magic, CatalogImageFormat::MAGIC, sizeof(h->magic)) != 0) {
+        setError(error, QStringLiteral("Not a signal catalog image"));
+        return false;
+    }
+    if (h->formatVersion != CatalogImageFormat::VERSION ||
+        h->headerSize != sizeof(CatalogImageHeader) ||
+        h->entrySize != sizeof(CatalogImageEntry)) {
+        setError(error, QStringLiteral("Unsupported catalog image version %1").arg(h->formatVersion));
+        return false;
+    }
+
+    const quint64 entriesEnd = quint64(h->headerSize) + quint64(h->entryCount) * h->entrySize;
+    if (h->stringsOffset != entriesEnd || h->stringsSize % sizeof(QChar) != 0 ||
+        quint64(h->stringsOffset) + h->stringsSize != quint64(m_size)) {
+        setError(error, QStringLiteral("Catalog image size mismatch"));
+        return false;
+    }
+
+    if (crc32(m_base + h->headerSize, m_size - h->headerSize) != h->checksum) {
+        setError(error, QStringLiteral("Catalog image checksum mismatch"));
+        return false;
+    }
+
+    // Checked once here so definition() can index without bounds checks
+    const uint32_t stringUnits = h->stringsSize / sizeof(QChar);
+    auto inTable = [stringUnits](const CatalogImageString& ref) {
+        return ref.offset <= stringUnits && ref.length <= stringUnits - ref.offset;
+    };
+    const CatalogImageEntry* table = entries();
+    for (uint32_t i = 0; i < h->entryCount; ++i) {
+        const CatalogImageEntry& entry = table[i];
+        if (!inTable(entry.id) || !inTable(entry.name) || !inTable(entry.unit) ||
+            !inTable(entry.defaultText) || entry.id.length == 0 ||
+            entry.kind > static_cast<uint8_t>(SignalKind::String)) {
+            setError(error, QStringLiteral("Catalog image entry %1 is corrupt").arg(i));
+            return false;
+        }
+    }
+    return true;
+}
+
+QString SignalCatalogImage::string(const CatalogImageString& ref) const
+{
+    const QChar* base = reinterpret_cast<const QChar*>(m_base + header()->stringsOffset);
+    return QString::fromRawData(base + ref.offset, ref.length);
+}
+
+SignalDefinition SignalCatalogImage::definition(int index) const
+{
+    Q_ASSERT(index >= 0 && index < count());
+    const CatalogImageEntry& entry = entries()[index];
+
+    SignalDefinition def;
+    def.id = string(entry.id);
+    def.name = string(entry.name);
+    def.unit = string(entry.unit);
+    def.kind = static_cast<SignalKind>(entry.kind);
+    if (entry.flags & CatalogImageFormat::HasMin) {
+        def.minValue = entry.minValue;
+    }
+    if (entry.flags & CatalogImageFormat::HasMax) {
+        def.maxValue = entry.maxValue;
+    }
+    if (def.kind == SignalKind::String) {
+        def.defaultValue = string(entry.defaultText);
+    } else {
+        def.defaultValue = entry.defaultValue;  // Converted to the kind at registration
+    }
+    def.freshnessMs = entry.freshnessMs;
+    def.maxRateOfChange = entry.maxRateOfChange;
+    def.isSafetyCritical = (entry.flags & CatalogImageFormat::SafetyCritical) != 0;
+    def.historyCapacity = entry.historyCapacity;
+    def.historyDecimation = entry.historyDecimation;
+    def.deadbandAbsolute = entry.deadbandAbsolute;
+    def.deadbandRelative = entry.deadbandRelative;
+    def.displayResolution = entry.displayResolution;
+    def.minPublishIntervalMs = entry.minPublishIntervalMs;
+    return def;
+}
+
+} // namespace signal
+} // namespace automotive
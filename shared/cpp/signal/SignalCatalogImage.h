@@ -0,0 +1,172 @@
+// SignalCatalogImage.h
+// Precompiled binary signal catalog: offline writer and memory-mapped loader
+// Part of: Shared Platform Layer
+// Safety: Images are checksummed and bounds-checked before any signal is registered
+
+#ifndef AUTOMOTIVE_SIGNAL_CATALOG_IMAGE_H
+#define AUTOMOTIVE_SIGNAL_CATALOG_IMAGE_H
+
+#include "signal/SignalTypes.h"
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QVector>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Image file layout
+ *
+ * [header][entries: entryCount x CatalogImageEntry][UTF-16 string table]
+ *
+ * Host byte order (images are built for the target). Strings are UTF-16
+ * so the loader can wrap them with QString::fromRawData() instead of
+ * allocating. The checksum is CRC-32 (IEEE) of everything after the header.
+ */
+namespace CatalogImageFormat {
+    constexpr char MAGIC[4] = {'A', 'S', 'C', 'I'};
+    constexpr uint16_t VERSION = 1;
+
+    enum EntryFlag : uint8_t {
+        HasMin = 0x01,
+        HasMax = 0x02,
+        SafetyCritical = 0x04
+    };
+}
+
+struct CatalogImageHeader {
+    char magic[4];                     ///< CatalogImageFormat::MAGIC
+    uint16_t formatVersion;            ///< CatalogImageFormat::VERSION
+    uint16_t headerSize;               ///< sizeof(CatalogImageHeader)
+    uint32_t catalogVersion;           ///< Version of the catalog content (from the source)
+    uint32_t entryCount;               ///< Number of signals
+    uint32_t entrySize;                ///< sizeof(CatalogImageEntry)
+    uint32_t stringsOffset;            ///< Byte offset of the string table
+    uint32_t stringsSize;              ///< Byte size of the string table
+    uint32_t checksum;                 ///< CRC-32 of bytes [headerSize, end)
+};
+
+/**
+ * @brief Reference into the string table, in UTF-16 code units
+ */
+struct CatalogImageString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct CatalogImageEntry {
+    CatalogImageString id;
+    CatalogImageString name;
+    CatalogImageString unit;
+    CatalogImageString defaultText;    ///< String kind default
+    double minValue;
+    double maxValue;
+    double defaultValue;               ///< Non-string default
+    double maxRateOfChange;
+    double deadbandAbsolute;
+    double deadbandRelative;
+    double displayResolution;
+    int64_t freshnessMs;
+    int64_t minPublishIntervalMs;
+    int32_t historyCapacity;
+    int32_t historyDecimation;
+    uint8_t kind;                      ///< SignalKind
+    uint8_t flags;                     ///< CatalogImageFormat::EntryFlag
+    uint8_t reserved[6];
+};
+
+static_assert(sizeof(CatalogImageHeader) == 32, "Catalog image header layout changed");
+static_assert(sizeof(CatalogImageEntry) == 120, "Catalog image entry layout changed");
+static_assert(std::is_trivially_copyable<CatalogImageEntry>::value,
+              "Catalog image entries are read in place");
+
+/**
+ * @brief Parse a JSON signal catalog
+ * @param json Document of the form
+ *        {"version": N, "signals": [{"id": ..., "kind": "double", ...}, ...]}
+ *        Field names follow SignalDefinition ("min", "max", "default" and
+ *        "safetyCritical" are shortened).
+ * @param definitions Receives the signals, in file order
+ * @param catalogVersion Receives "version" (0 if absent)
+ * @param error Set on failure
+ * @return false on malformed input, unknown kind or duplicate id
+ */
+bool parseSignalCatalogJson(const QByteArray& json,
+                            QVector<SignalDefinition>* definitions,
+                            quint32* catalogVersion,
+                            QString* error = nullptr);
+
+/**
+ * @brief Build a binary catalog image
+ * @param definitions Signals, in handle order
+ * @param catalogVersion Content version stored in the header
+ */
+QByteArray buildSignalCatalogImage(const QVector<SignalDefinition>& definitions,
+                                   quint32 catalogVersion);
+
+/**
+ * @brief Read-only, validated catalog image
+ *
+ * Opened from a file (memory-mapped) or from a byte array. definition()
+ * returns strings that point into the image, so the image must outlive
+ * every copy of them; SignalHub::registerCatalogImage() keeps it alive
+ * for the hub's lifetime.
+ */
+class SignalCatalogImage {
+public:
+    /**
+     * @brief Map and validate an image file
+     * @return Image, or nullptr (with @p error set) if the file is missing,
+     *         truncated, of another format version or fails the checksum
+     */
+    static std::shared_ptr<const SignalCatalogImage> open(const QString& path,
+                                                          QString* error = nullptr);
+
+    /**
+     * @brief Validate an image held in memory (the array is shared, not copied)
+     */
+    static std::shared_ptr<const SignalCatalogImage> fromData(const QByteArray& data,
+                                                              QString* error = nullptr);
+
+    ~SignalCatalogImage();
+
+    SignalCatalogImage(const SignalCatalogImage&) = delete;
+    SignalCatalogImage& operator=(const SignalCatalogImage&) = delete;
+
+    quint32 catalogVersion() const { return header()->catalogVersion; }
+    int count() const { return static_cast<int>(header()->entryCount); }
+
+    /**
+     * @brief Definition of entry @p index (0 <= index < count())
+     *
+     * Strings and defaults reference the image; no heap allocation.
+     */
+    SignalDefinition definition(int index) const;
+
+private:
+    SignalCatalogImage() = default;
+
+    bool validate(QString* error) const;
+    const CatalogImageHeader* header() const {
+        return reinterpret_cast<const CatalogImageHeader*>(m_base);
+    }
+    const CatalogImageEntry* entries() const {
+        return reinterpret_cast<const CatalogImageEntry*>(m_base + header()->headerSize);
+    }
+    QString string(const CatalogImageString& ref) const;
+
+    QFile m_file;                      ///< Backing file (mapped images)
+    uchar* m_mapped{nullptr};          ///< Mapping, unmapped on destruction
+    QByteArray m_data;                 ///< Backing array (in-memory images)
+    const uchar* m_base{nullptr};
+    qint64 m_size{0};
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_CATALOG_IMAGE_H
@@ -0,0 +1,135 @@
+// SignalHistory.cpp
+// Fixed-capacity time-series history implementation
+
+#include "signal/SignalHistory.h"
+#include <limits>
+
+namespace automotive {
+namespace signal {
+
+SignalHistory::SignalHistory(int capacity, int decimation)
+    : m_samples(qMax(capacity, 0))
+    , m_decimation(qMax(decimation, 1))
+{
+}
+
+void SignalHistory::append(qint64 timestampMs, double value)
+{
+    if (m_samples.isEmpty()) {
+        return;
+    }
+
+    // Store the first value, then every Nth
+    if (m_count > 0 && ++m_skipped < m_decimation) {
+        return;
+    }
+    m_skipped = 0;
+
+    const int capacity = static_cast<int>(m_samples.size());
+    if (m_count < capacity) {
+        m_samples[(m_start + m_count) % capacity] = {timestampMs, value};
+        ++m_count;
+    } else {
+        m_samples[m_start] = {timestampMs, value};
+        m_start = (m_start + 1) % capacity;
+    }
+}
+
+HistoryStats SignalHistory::stats(qint64 fromMs, qint64 toMs) const
+{
+    HistoryStats result;
+    const int first = lowerBound(fromMs);
+    const int last = upperBound(toMs);
+    if (first >= last) {
+        return result;
+    }
+
+    double minValue = std::numeric_limits<double>::max();
+    double maxValue = std::numeric_limits<double>::lowest();
+    double sum = 0.0;
+    for (int i = first; i < last; ++i) {
+        const double value = at(i).value;
+        minValue = qMin(minValue, value);
+        maxValue = qMax(maxValue, value);
+        sum += value;
+    }
+
+    result.count = last - first;
+    result.min = minValue;
+    result.max = maxValue;
+    result.mean = sum / result.count;
+    return result;
+}
+
+QVector<HistorySample> SignalHistory::range(qint64 fromMs, qint64 toMs, int maxPoints) const
+{
+    QVector<HistorySample> result;
+    const int first = lowerBound(fromMs);
+    const int last = upperBound(toMs);
+    const int count = last - first;
+    if (count <= 0) {
+        return result;
+    }
+
+    if (maxPoints <= 0 || count <= maxPoints) {
+        result.reserve(count);
+        for (int i = first; i < last; ++i) {
+            result.append(at(i));
+        }
+        return result;
+    }
+
+    // Split the window into maxPoints buckets of (nearly) equal sample count
+    result.reserve(maxPoints);
+    for (int bucket = 0; bucket < maxPoints; ++bucket) {
+        const int begin = first + static_cast<int>(static_cast<qint64>(count) * bucket / maxPoints);
+        const int end = first + static_cast<int>(static_cast<qint64>(count) * (bucket + 1) / maxPoints);
+
+        double sum = 0.0;
+        for (int i = begin; i < end; ++i) {
+            sum += at(i).value;
+        }
+        result.append({at(end - 1).timestampMs, sum / (end - begin)});
+    }
+    return result;
+}
+
+void SignalHistory::clear()
+{
+    m_start = 0;
+    m_count = 0;
+    m_skipped = 0;
+}
+
+int SignalHistory::lowerBound(qint64 timestampMs) const
+{
+    int low = 0;
+    int high = m_count;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (at(mid).timestampMs < timestampMs) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+int SignalHistory::upperBound(qint64 timestampMs) const
+{
+    int low = 0;
+    int high = m_count;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (at(mid).timestampMs <= timestampMs) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+} // namespace signal
+} // namespace automotive
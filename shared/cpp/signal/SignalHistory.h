@@ -0,0 +1,92 @@
+// SignalHistory.h
+// Fixed-capacity time-series history of a signal
+// Part of: Shared Platform Layer
+// Safety: QM - trend display only, not used for safety decisions
+
+#ifndef AUTOMOTIVE_SIGNAL_HISTORY_H
+#define AUTOMOTIVE_SIGNAL_HISTORY_H
+
+#include <QVector>
+#include <QtGlobal>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief One recorded value
+ */
+struct HistorySample {
+    qint64 timestampMs{0};             ///< Hub monotonic time of the update
+    double value{0.0};                 ///< Value as double
+};
+
+/**
+ * @brief Aggregate over a time window
+ */
+struct HistoryStats {
+    int count{0};                      ///< Samples in the window (0 = no data)
+    double min{0.0};
+    double max{0.0};
+    double mean{0.0};
+};
+
+/**
+ * @brief Ring buffer of recent samples of one signal
+ *
+ * Storage is allocated once by the constructor; append() overwrites the
+ * oldest sample when full and never allocates. With a decimation of N only
+ * every Nth appended value is stored. Samples are kept in time order, so
+ * window queries binary-search the ring.
+ *
+ * A default-constructed history is disabled (capacity 0).
+ */
+class SignalHistory {
+public:
+    SignalHistory() = default;
+    SignalHistory(int capacity, int decimation);
+
+    bool isEnabled() const { return !m_samples.isEmpty(); }
+    int capacity() const { return static_cast<int>(m_samples.size()); }
+    int size() const { return m_count; }
+    int decimation() const { return m_decimation; }
+
+    /**
+     * @brief Record a value (subject to decimation)
+     */
+    void append(qint64 timestampMs, double value);
+
+    /**
+     * @brief Min/max/mean of samples with fromMs <= timestamp <= toMs
+     */
+    HistoryStats stats(qint64 fromMs, qint64 toMs) const;
+
+    /**
+     * @brief Export samples with fromMs <= timestamp <= toMs
+     * @param maxPoints Downsample to at most this many points by averaging
+     *                  consecutive samples (0 = no downsampling)
+     *
+     * Each downsampled point carries the mean value and the timestamp of
+     * the last sample in its bucket.
+     */
+    QVector<HistorySample> range(qint64 fromMs, qint64 toMs, int maxPoints = 0) const;
+
+    void clear();
+
+private:
+    const HistorySample& at(int logicalIndex) const {
+        return m_samples[(m_start + logicalIndex) % m_samples.size()];
+    }
+    int lowerBound(qint64 timestampMs) const;
+    int upperBound(qint64 timestampMs) const;
+
+    QVector<HistorySample> m_samples;  ///< Ring storage (fixed size)
+    int m_start{0};                    ///< Physical index of the oldest sample
+    int m_count{0};                    ///< Number of stored samples
+    int m_decimation{1};
+    int m_skipped{0};                  ///< Values skipped since the last stored one
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_HISTORY_H
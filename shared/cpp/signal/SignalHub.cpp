@@ -2,12 +2,39 @@
 // Central signal distribution and validation hub implementation
 
 #include "signal/SignalHub.h"
+#include "signal/SignalHubMirror.h"
+#include "signal/SignalTrace.h"
 #include <QDebug>
+#include <QtAlgorithms>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace automotive {
 namespace signal {
 
+namespace {
+
+// Value as compared by the change filter (display quantization)
+double filterValue(const SignalDefinition& def, double value)
+{
+    if (def.displayResolution > 0.0) {
+        return std::round(value / def.displayResolution) * def.displayResolution;
+    }
+    return value;
+}
+
+// True if the change from the notified value is visible downstream
+bool exceedsDeadband(const SignalDefinition& def, double value, double notifiedValue)
+{
+    const double delta = std::abs(value - notifiedValue);
+    const double deadband = std::max(def.deadbandAbsolute,
+                                     def.deadbandRelative * std::abs(notifiedValue));
+    return delta != 0.0 && !(delta < deadband);
+}
+
+} // namespace
+
 SignalHub::SignalHub(QObject* parent)
     : QObject(parent)
 {
@@ -16,279 +43,1807 @@ SignalHub::SignalHub(QObject* parent)
 
 SignalHub::~SignalHub() = default;
 
-bool SignalHub::registerSignal(const SignalDefinition& def)
+SignalHandle SignalHub::registerSignal(const SignalDefinition& def)
 {
     if (def.id.isEmpty()) {
         qWarning() << "SignalHub: Cannot register signal with empty ID";
-        return false;
+        return SignalHandle();
     }
 
     QMutexLocker locker(&m_mutex);
 
-    if (m_initialized) {
+    if (m_initialized.load(std::memory_order_relaxed)) {
         qWarning() << "SignalHub: Cannot register signals after initialization";
-        return false;
+        return SignalHandle();
     }
 
-    if (m_signals.contains(def.id)) {
+    if (m_handles.contains(def.id)) {
         qWarning() << "SignalHub: Signal already registered:" << def.id;
-        return false;
+        return SignalHandle();
     }
 
     SignalState state;
     state.definition = def;
-    state.current.value = def.defaultValue;
+    if (def.kind == SignalKind::String) {
+        state.current.value.kind = SignalKind::String;
+        state.current.text = def.defaultValue.toString();
+    } else {
+        state.current.value = scalarFromVariant(def.defaultValue, def.kind);
+    }
     state.current.validity = SignalValidity::NotAvailable;
     state.current.timestampMs = 0;
     state.current.updateCount = 0;
+    state.previousValue = state.current.value;
+
+    if (def.historyCapacity > 0 && def.kind != SignalKind::String) {
+        state.history = SignalHistory(def.historyCapacity, def.historyDecimation);
+    }
+
+    state.changeFilter = def.kind != SignalKind::String && def.kind != SignalKind::Bool &&
+                         (def.deadbandAbsolute > 0.0 || def.deadbandRelative > 0.0 ||
+                          def.displayResolution > 0.0 || def.minPublishIntervalMs > 0);
+
+    const SignalHandle handle(static_cast<uint32_t>(m_signals.size()));
+    m_signals.append(state);
+    m_handles.insert(def.id, handle);
+    m_signalIds.append(def.id);
+
+    m_published.emplace_back();
+    m_published.back().store(state.current);
+    m_telemetry.emplace_back();
+    m_publishedText.append(state.current.text);
+    m_freshness.addSignal();
+    m_dirtyBits.resize((m_signals.size() + 63) / 64);
+
+    // Convert range limits once so the update path stays variant-free
+    m_minValues.append(def.minValue.isValid() ? def.minValue.toDouble()
+                                              : -std::numeric_limits<double>::infinity());
+    m_maxValues.append(def.maxValue.isValid() ? def.maxValue.toDouble()
+                                              : std::numeric_limits<double>::infinity());
+
+    // One kernel lane per signal: a segment never holds a signal twice
+    const int lanes = m_signals.size();
+    m_scratch.values.resize(lanes);
+    m_scratch.minValues.resize(lanes);
+    m_scratch.maxValues.resize(lanes);
+    m_scratch.previousValues.resize(lanes);
+    m_scratch.maxRates.resize(lanes);
+    m_scratch.deltaTimesMs.resize(lanes);
+    m_scratch.clampedValues.resize(lanes);
+    m_scratch.outOfRange.resize((lanes + 63) / 64);
+    m_scratch.rateViolation.resize((lanes + 63) / 64);
+    m_scratch.seenStamp.resize(lanes);
+    if (m_heldSignals.capacity() < lanes) {
+        m_heldSignals.reserve(m_signals.capacity());
+    }
+
+    for (SnapshotBuffer& buffer : m_snapshots) {
+        buffer.records.resize(lanes);
+        buffer.texts.resize(lanes);
+    }
+
+    return handle;
+}
+
+void SignalHub::reserveSignals(int count)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_initialized.load(std::memory_order_relaxed) || count <= m_signals.size()) {
+        return;
+    }
+
+    m_signals.reserve(count);
+    m_handles.reserve(count);
+    m_signalIds.reserve(count);
+    m_published.reserve(static_cast<size_t>(count));
+    m_telemetry.reserve(static_cast<size_t>(count));
+    m_publishedText.reserve(count);
+    m_freshness.reserve(count);
+    m_minValues.reserve(count);
+    m_maxValues.reserve(count);
+    m_heldSignals.reserve(count);
+    for (SnapshotBuffer& buffer : m_snapshots) {
+        buffer.records.reserve(count);
+        buffer.texts.reserve(count);
+    }
+}
+
+bool SignalHub::registerCatalogImage(std::shared_ptr<const SignalCatalogImage> image)
+{
+    if (!image) {
+        return false;
+    }
 
-    m_signals.insert(def.id, state);
-    m_signalIdCache.append(def.id);
+    {
+        QMutexLocker locker(&m_mutex);
+        m_catalogImages.append(image);
+    }
 
+    const int count = image->count();
+    reserveSignals(signalCount() + count);
+    for (int i = 0; i < count; ++i) {
+        if (!registerSignal(image->definition(i)).isValid()) {
+            return false;
+        }
+    }
     return true;
 }
 
-bool SignalHub::updateSignal(const QString& signalId,
-                              const QVariant& value,
-                              qint64 sourceTimestampMs)
+bool SignalHub::deriveSignal(SignalHandle target,
+                             const QVector<SignalHandle>& inputs,
+                             DerivedSignalFunction compute)
 {
     QMutexLocker locker(&m_mutex);
 
-    auto it = m_signals.find(signalId);
-    if (it == m_signals.end()) {
-        qWarning() << "SignalHub: Unknown signal:" << signalId;
+    if (m_initialized.load(std::memory_order_relaxed)) {
+        qWarning() << "SignalHub: Cannot derive signals after initialization";
         return false;
     }
 
-    SignalState& state = it.value();
-    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    if (!isValidHandle(target) || inputs.isEmpty() || !compute) {
+        qWarning() << "SignalHub: Invalid derived signal definition";
+        return false;
+    }
 
-    // Mark as initialized on first update
-    if (!m_initialized) {
-        m_initialized = true;
+    SignalState& state = m_signals[target.index];
+    if (state.derivedSlot >= 0 || state.definition.kind == SignalKind::String) {
+        qWarning() << "SignalHub: Signal cannot be derived:" << state.definition.id;
+        return false;
     }
 
-    SignalValidity oldValidity = state.current.validity;
-    SignalValidity newValidity = SignalValidity::Valid;
-    QVariant finalValue = value;
-
-    // Validate range (SR-CL-002)
-    if (!validateRange(state.definition, value)) {
-        if (state.definition.isSafetyCritical) {
-            // Critical signals: clamp and mark invalid
-            finalValue = clampValue(state.definition, value);
-            newValidity = SignalValidity::OutOfRange;
-        } else {
-            // Non-critical: clamp silently
-            finalValue = clampValue(state.definition, value);
+    for (const SignalHandle input : inputs) {
+        if (!isValidHandle(input) || input == target) {
+            qWarning() << "SignalHub: Invalid input for derived signal" << state.definition.id;
+            return false;
         }
     }
 
-    // Validate rate of change (plausibility)
-    if (state.definition.maxRateOfChange > 0.0 &&
-        state.current.validity == SignalValidity::Valid) {
-        if (!validateRateOfChange(state, value, currentTimeMs)) {
-            newValidity = SignalValidity::Invalid;
-            qWarning() << "SignalHub: Rate-of-change violation for" << signalId;
+    DerivedSignal derived;
+    derived.index = target.index;
+    derived.inputs = inputs;
+    derived.compute = std::move(compute);
+    derived.inputValues.resize(inputs.size());
+
+    state.derivedSlot = m_derived.size();
+    m_derived.append(std::move(derived));
+    for (const SignalHandle input : inputs) {
+        QVector<uint32_t>& dependents = m_signals[input.index].dependents;
+        if (!dependents.contains(target.index)) {
+            dependents.append(target.index);
         }
     }
 
-    // Store previous for rate-of-change calculation
-    state.previousValue = state.current.value;
-    state.previousTimestampMs = state.current.timestampMs;
+    if (!sortDerivedSignals()) {
+        qWarning() << "SignalHub: Derived signal dependency cycle at" << state.definition.id;
+        for (const SignalHandle input : inputs) {
+            m_signals[input.index].dependents.removeAll(target.index);
+        }
+        m_derived.removeLast();
+        state.derivedSlot = -1;
+        return false;
+    }
 
-    // Update current value
-    state.current.value = finalValue;
-    state.current.validity = newValidity;
-    state.current.timestampMs = currentTimeMs;
-    state.current.sourceTimestampMs = sourceTimestampMs;
-    state.current.updateCount++;
+    m_derivedDirty.resize((m_derived.size() + 63) / 64);
+    return true;
+}
 
-    // Track invalid count for degraded mode
-    if (oldValidity == SignalValidity::Valid &&
-        newValidity != SignalValidity::Valid) {
-        m_invalidCount++;
-    } else if (oldValidity != SignalValidity::Valid &&
-               newValidity == SignalValidity::Valid) {
-        m_invalidCount = qMax(0, m_invalidCount - 1);
+bool SignalHub::sortDerivedSignals()
+{
+    // Kahn's algorithm over derived slots; raw inputs impose no order
+    const int count = m_derived.size();
+    QVector<int> unresolved(count, 0);
+    for (const DerivedSignal& derived : m_derived) {
+        for (const uint32_t dependent : m_signals.at(derived.index).dependents) {
+            ++unresolved[m_signals.at(dependent).derivedSlot];
+        }
     }
 
-    // Check degraded mode transition (SR-CL-004)
-    bool shouldBeDegraded = m_invalidCount > 0;
-    if (shouldBeDegraded != m_degradedMode) {
-        m_degradedMode = shouldBeDegraded;
-        locker.unlock();
-        emit degradedModeChanged(m_degradedMode);
-        locker.relock();
+    QVector<int> order;
+    order.reserve(count);
+    for (int slot = 0; slot < count; ++slot) {
+        if (unresolved.at(slot) == 0) {
+            order.append(slot);
+        }
+    }
+    for (int i = 0; i < order.size(); ++i) {
+        const SignalState& state = m_signals.at(m_derived.at(order.at(i)).index);
+        for (const uint32_t dependent : state.dependents) {
+            const int slot = m_signals.at(dependent).derivedSlot;
+            if (--unresolved[slot] == 0) {
+                order.append(slot);
+            }
+        }
     }
 
-    // Emit updates
-    SignalValue valueCopy = state.current;
-    locker.unlock();
+    if (order.size() != count) {
+        return false;
+    }
+    m_derivedOrder = order;
+    return true;
+}
+
+SignalHandle SignalHub::signalHandle(const QString& signalId) const
+{
+    if (isSealed()) {
+        return m_handles.value(signalId);
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return m_handles.value(signalId);
+}
 
-    emit signalUpdated(signalId, valueCopy);
+QString SignalHub::signalId(SignalHandle handle) const
+{
+    if (isSealed()) {
+        return isValidHandle(handle) ? m_signalIds.at(handle.index) : QString();
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return isValidHandle(handle) ? m_signalIds.at(handle.index) : QString();
+}
+
+bool SignalHub::updateSignal(const QString& signalId,
+                              const QVariant& value,
+                              qint64 sourceTimestampMs)
+{
+    const SignalHandle handle = signalHandle(signalId);
+    if (!handle.isValid()) {
+        qWarning() << "SignalHub: Unknown signal:" << signalId;
+        return false;
+    }
+
+    QMutexLocker locker(&m_mutex);
 
-    if (oldValidity != newValidity) {
-        emit signalValidityChanged(signalId, oldValidity, newValidity);
+    TypedInput input;
+    const SignalKind kind = m_signals.at(handle.index).definition.kind;
+    if (kind == SignalKind::String) {
+        input.scalar.kind = SignalKind::String;
+        input.text = value.toString();
+    } else {
+        input.scalar = scalarFromVariant(value, kind, &input.convertible);
     }
 
-    return newValidity == SignalValidity::Valid;
+    return commitUpdate(handle, input, sourceTimestampMs, locker);
 }
 
-SignalValue SignalHub::getSignal(const QString& signalId) const
+bool SignalHub::updateSignal(SignalHandle handle,
+                              const ScalarValue& value,
+                              qint64 sourceTimestampMs)
 {
     QMutexLocker locker(&m_mutex);
 
-    auto it = m_signals.find(signalId);
-    if (it == m_signals.end()) {
-        SignalValue invalid;
-        invalid.validity = SignalValidity::NotAvailable;
-        return invalid;
+    if (!isValidHandle(handle)) {
+        qWarning() << "SignalHub: Unknown signal handle:" << handle.index;
+        return false;
     }
 
-    return it.value().current;
+    return commitUpdate(handle, typedInput(m_signals.at(handle.index), value),
+                        sourceTimestampMs, locker);
 }
 
-void SignalHub::checkFreshness()
+bool SignalHub::updateSignal(SignalHandle handle,
+                              const QString& text,
+                              qint64 sourceTimestampMs)
 {
     QMutexLocker locker(&m_mutex);
 
+    if (!isValidHandle(handle)) {
+        qWarning() << "SignalHub: Unknown signal handle:" << handle.index;
+        return false;
+    }
+
+    TypedInput input;
+    const SignalKind kind = m_signals.at(handle.index).definition.kind;
+    if (kind == SignalKind::String) {
+        input.scalar.kind = SignalKind::String;
+        input.text = text;
+    } else {
+        input.scalar = scalarFromString(text, kind, &input.convertible);
+    }
+
+    return commitUpdate(handle, input, sourceTimestampMs, locker);
+}
+
+int SignalHub::updateSignals(const SignalBatch& batch)
+{
+    if (batch.isEmpty()) {
+        return 0;
+    }
+
+    QVector<SignalChange> changes;
+
+    QMutexLocker locker(&m_mutex);
     const qint64 currentTimeMs = currentMonotonicTimeMs();
-    QVector<QPair<QString, QPair<SignalValidity, SignalValidity>>> validityChanges;
+    if (!m_coalescing) {
+        changes.reserve(batch.size());
+    }
+
+    for (const SignalUpdate& update : batch) {
+        if (!isValidHandle(update.handle)) {
+            qWarning() << "SignalHub: Unknown signal handle in batch:" << update.handle.index;
+            continue;
+        }
+
+        const SignalState& state = m_signals.at(update.handle.index);
+        if (state.derivedSlot >= 0) {
+            qWarning() << "SignalHub: Derived signal cannot be updated directly:"
+                       << state.definition.id;
+            continue;
+        }
+        PendingUpdate pending;
+        pending.handle = update.handle;
+        pending.sourceTimestampMs = update.sourceTimestampMs;
+        if (state.definition.kind == SignalKind::String) {
+            pending.input.scalar.kind = SignalKind::String;
+            pending.input.text = update.text;
+        } else {
+            pending.input = typedInput(state, update.value);
+        }
+        m_pending.append(std::move(pending));
+    }
+
+    const int accepted = commitPending(currentTimeMs, changes);
+
+    finishBatch(changes, locker);
+    return accepted;
+}
+
+SignalProducer* SignalHub::createProducer(const QString& name, int capacity)
+{
+    QMutexLocker locker(&m_mutex);
+    m_producers.push_back(std::make_unique<SignalProducer>(name, qMax(capacity, 2)));
+    return m_producers.back().get();
+}
+
+int SignalHub::drainProducers()
+{
+    QVector<SignalChange> changes;
+    int drained = 0;
 
-    // Use pre-allocated cache to avoid allocations
-    for (const QString& signalId : qAsConst(m_signalIdCache)) {
-        SignalState& state = m_signals[signalId];
+    QMutexLocker locker(&m_mutex);
+    if (m_producers.empty()) {
+        return 0;
+    }
 
-        if (state.current.validity == SignalValidity::Valid) {
-            const qint64 age = currentTimeMs - state.current.timestampMs;
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    IngestRecord record;
 
-            // Requirement: SR-CL-001 - stale indicator within freshnessMs
-            if (age > state.definition.freshnessMs) {
-                SignalValidity oldValidity = state.current.validity;
-                state.current.validity = SignalValidity::Stale;
+    for (const auto& producer : m_producers) {
+        // Bounded: records pushed during the drain wait for the next tick
+        for (int budget = producer->capacity(); budget > 0 && producer->pop(record); --budget) {
+            ++drained;
+            if (!isValidHandle(record.handle)) {
+                qWarning() << "SignalHub: Unknown signal handle from producer"
+                           << producer->name() << ":" << record.handle.index;
+                continue;
+            }
 
-                m_invalidCount++;
-                validityChanges.append({signalId, {oldValidity, SignalValidity::Stale}});
+            const SignalState& state = m_signals.at(record.handle.index);
+            if (state.derivedSlot >= 0) {
+                qWarning() << "SignalHub: Derived signal cannot be updated directly:"
+                           << state.definition.id;
+                continue;
             }
+
+            PendingUpdate pending;
+            pending.handle = record.handle;
+            pending.input = typedInput(state, record.value);
+            pending.sourceTimestampMs = record.sourceTimestampMs;
+            m_pending.append(std::move(pending));
         }
     }
 
-    // Check degraded mode (SR-CL-004)
-    bool shouldBeDegraded = m_invalidCount > 0;
-    bool degradedChanged = (shouldBeDegraded != m_degradedMode);
-    m_degradedMode = shouldBeDegraded;
+    commitPending(currentTimeMs, changes);
 
-    locker.unlock();
+    finishBatch(changes, locker);
+    return drained;
+}
 
-    // Emit signals outside of lock
-    for (const auto& change : validityChanges) {
-        emit signalValidityChanged(change.first, change.second.first, change.second.second);
-    }
+QVector<ProducerStats> SignalHub::producerStats() const
+{
+    QMutexLocker locker(&m_mutex);
 
-    if (degradedChanged) {
-        emit degradedModeChanged(m_degradedMode);
+    QVector<ProducerStats> stats;
+    stats.reserve(static_cast<int>(m_producers.size()));
+    for (const auto& producer : m_producers) {
+        stats.append(producer->stats());
     }
+    return stats;
 }
 
-QStringList SignalHub::registeredSignals() const
+SignalView* SignalHub::createView(const QString& name,
+                                  const QVector<SignalHandle>& handles,
+                                  const SignalViewPolicy& policy,
+                                  SignalViewCallback callback)
 {
     QMutexLocker locker(&m_mutex);
-    return m_signalIdCache;
+
+    QVector<SignalHandle> valid;
+    valid.reserve(handles.size());
+    for (const SignalHandle handle : handles) {
+        if (isValidHandle(handle)) {
+            valid.append(handle);
+        } else {
+            qWarning() << "SignalHub: Unknown signal handle for view" << name << ":"
+                       << handle.index;
+        }
+    }
+    if (valid.isEmpty()) {
+        return nullptr;
+    }
+
+    m_views.push_back(std::make_shared<SignalView>(name, valid, policy, std::move(callback)));
+    if (m_views.back()->aggregates()) {
+        for (const SignalHandle handle : valid) {
+            SignalState& state = m_signals[handle.index];
+            if (state.definition.kind != SignalKind::String && state.viewAggregators++ == 0) {
+                state.viewTick.reset();
+            }
+        }
+    }
+    return m_views.back().get();
 }
 
-bool SignalHub::isDegradedMode() const
+void SignalHub::removeView(SignalView* view)
 {
     QMutexLocker locker(&m_mutex);
-    return m_degradedMode;
+
+    const auto it = std::find_if(m_views.begin(), m_views.end(),
+                                 [view](const auto& owned) { return owned.get() == view; });
+    if (it == m_views.end()) {
+        return;
+    }
+
+    if (view->aggregates()) {
+        for (const SignalView::Entry& entry : view->m_entries) {
+            SignalState& state = m_signals[entry.handle.index];
+            if (state.definition.kind != SignalKind::String) {
+                --state.viewAggregators;
+            }
+        }
+    }
+    // A delivery in progress holds its own reference; mark the view so
+    // serviceViews() skips it if it is still queued
+    view->m_removed.store(true, std::memory_order_release);
+    m_views.erase(it);
 }
 
-int SignalHub::invalidSignalCount() const
+QVector<SignalViewStats> SignalHub::viewStats() const
 {
     QMutexLocker locker(&m_mutex);
-    return m_invalidCount;
+
+    QVector<SignalViewStats> stats;
+    stats.reserve(static_cast<int>(m_views.size()));
+    for (const auto& view : m_views) {
+        stats.append(view->m_stats);
+    }
+    return stats;
 }
 
-bool SignalHub::validateRange(const SignalDefinition& def, const QVariant& value) const
+int SignalHub::serviceViews()
 {
-    if (!def.minValue.isValid() && !def.maxValue.isValid()) {
-        return true; // No range defined
+    QVector<std::shared_ptr<SignalView>> due;
+
+    QMutexLocker locker(&m_mutex);
+    if (m_views.empty()) {
+        return 0;
     }
 
-    bool ok = false;
-    double numValue = value.toDouble(&ok);
-    if (!ok) {
-        return true; // Non-numeric, skip range check
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+
+    // Fold the tick's Valid values into every aggregating view's period
+    // before clearing them: several views may share a signal
+    for (const auto& view : m_views) {
+        if (view->aggregates()) {
+            for (SignalView::Entry& entry : view->m_entries) {
+                entry.period.merge(m_signals.at(entry.handle.index).viewTick);
+            }
+        }
+    }
+    for (const auto& view : m_views) {
+        if (view->aggregates()) {
+            for (const SignalView::Entry& entry : view->m_entries) {
+                m_signals[entry.handle.index].viewTick.reset();
+            }
+        }
     }
 
-    if (def.minValue.isValid()) {
-        double minVal = def.minValue.toDouble();
-        if (numValue < minVal) {
-            return false;
+    for (const auto& owned : m_views) {
+        SignalView& view = *owned;
+        if (view.m_hasDelivered && currentTimeMs - view.m_lastDeliveryMs < view.m_periodMs) {
+            continue;
+        }
+
+        view.m_samples.clear();
+        for (SignalView::Entry& entry : view.m_entries) {
+            const SignalValue& current = m_signals.at(entry.handle.index).current;
+            if (entry.delivered && current.updateCount == entry.deliveredCount &&
+                current.validity == entry.deliveredValidity) {
+                continue;
+            }
+
+            SignalViewSample sample;
+            sample.handle = entry.handle;
+            sample.value = current;
+            sample.updates = current.updateCount - entry.deliveredCount;
+            if (entry.period.count > 0) {
+                sample.average = entry.period.sum / entry.period.count;
+                sample.minimum = entry.period.minimum;
+                sample.maximum = entry.period.maximum;
+            } else {
+                // No Valid update in the period (e.g. only went stale)
+                sample.average = sample.minimum = sample.maximum = current.toDouble();
+            }
+            view.m_samples.append(sample);
+            view.m_stats.updates += sample.updates;
+
+            entry.delivered = true;
+            entry.deliveredCount = current.updateCount;
+            entry.deliveredValidity = current.validity;
+            entry.period.reset();
+        }
+
+        if (view.m_samples.isEmpty()) {
+            continue;
         }
+        view.m_hasDelivered = true;
+        view.m_lastDeliveryMs = currentTimeMs;
+        ++view.m_stats.deliveries;
+        view.m_stats.samples += static_cast<quint64>(view.m_samples.size());
+        due.append(owned);
     }
 
-    if (def.maxValue.isValid()) {
-        double maxVal = def.maxValue.toDouble();
-        if (numValue > maxVal) {
-            return false;
+    locker.unlock();
+
+    // Only the tick thread services views, so the samples stay put without
+    // the lock. The references in due keep views removed meanwhile (by
+    // another thread or an earlier callback) alive; they are skipped.
+    int delivered = 0;
+    for (const auto& view : due) {
+        if (view->m_removed.load(std::memory_order_acquire)) {
+            continue;
         }
+        if (view->m_callback) {
+            view->m_callback(view->m_samples);
+        }
+        ++delivered;
     }
+    return delivered;
+}
 
-    return true;
+void SignalHub::collectChange(SignalChange&& change, QVector<SignalChange>& changes)
+{
+    if (m_coalescing) {
+        markDirty(change.handle.index, change.oldValidity);
+    } else {
+        changes.append(std::move(change));
+    }
 }
 
-bool SignalHub::validateRateOfChange(const SignalState& state,
-                                      const QVariant& newValue,
-                                      qint64 currentTimeMs) const
+void SignalHub::finishBatch(const QVector<SignalChange>& changes,
+                            QMutexLocker<QMutex>& locker)
 {
-    if (state.previousTimestampMs == 0) {
-        return true; // First update, no previous value
+    // One degraded evaluation for the whole batch (SR-CL-004)
+    const bool degradedChanged = updateDegradedMode();
+    const bool degraded = m_degradedMode.load(std::memory_order_relaxed);
+    locker.unlock();
+
+    if (degradedChanged) {
+        emit degradedModeChanged(degraded);
     }
 
-    bool ok1 = false, ok2 = false;
-    double prevVal = state.previousValue.toDouble(&ok1);
-    double newVal = newValue.toDouble(&ok2);
+    if (!changes.isEmpty()) {
+        deliver(changes);
+        emit signalsUpdated(changes);
+    }
+}
 
-    if (!ok1 || !ok2) {
-        return true; // Non-numeric, skip check
+SignalHub::TypedInput SignalHub::typedInput(const SignalState& state,
+                                            const ScalarValue& value) const
+{
+    TypedInput input;
+    if (state.definition.kind == SignalKind::String) {
+        input.scalar.kind = SignalKind::String;
+        input.text = scalarToString(value);
+    } else {
+        input.scalar = value.convertedTo(state.definition.kind);
     }
+    return input;
+}
 
-    qint64 deltaTimeMs = currentTimeMs - state.previousTimestampMs;
-    if (deltaTimeMs <= 0) {
-        return true; // Prevent division by zero
+bool SignalHub::commitUpdate(SignalHandle handle,
+                              const TypedInput& input,
+                              qint64 sourceTimestampMs,
+                              QMutexLocker<QMutex>& locker)
+{
+    if (m_signals.at(handle.index).derivedSlot >= 0) {
+        qWarning() << "SignalHub: Derived signal cannot be updated directly:"
+                   << m_signals.at(handle.index).definition.id;
+        return false;
     }
 
-    double deltaValue = std::abs(newVal - prevVal);
-    double ratePerSecond = (deltaValue * 1000.0) / static_cast<double>(deltaTimeMs);
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    if (m_traceRecorder) {
+        m_traceRecorder->recordUpdate(handle, input.scalar, input.text, input.convertible,
+                                      currentTimeMs, sourceTimestampMs);
+    }
+    const SignalChange change = applyUpdate(handle, input, sourceTimestampMs, currentTimeMs);
 
-    return ratePerSecond <= state.definition.maxRateOfChange;
+    // Check degraded mode transition (SR-CL-004)
+    if (updateDegradedMode()) {
+        const bool degraded = m_degradedMode.load(std::memory_order_relaxed);
+        locker.unlock();
+        emit degradedModeChanged(degraded);
+        locker.relock();
+    }
+
+    // Stored and fresh, but below the notification threshold
+    if (!passesChangeFilter(m_signals[handle.index], change, currentTimeMs)) {
+        return change.value.validity == SignalValidity::Valid;
+    }
+
+    if (m_coalescing) {
+        markDirty(handle.index, change.oldValidity);
+        return change.value.validity == SignalValidity::Valid;
+    }
+
+    locker.unlock();
+
+    // Emit updates
+    deliver(change);
+    emit signalUpdated(change.signalId, change.value);
+
+    if (change.validityChanged()) {
+        emit signalValidityChanged(change.signalId, change.oldValidity,
+                                   change.value.validity);
+    }
+
+    return change.value.validity == SignalValidity::Valid;
 }
 
-QVariant SignalHub::clampValue(const SignalDefinition& def, const QVariant& value) const
+int SignalHub::commitPending(qint64 currentTimeMs, QVector<SignalChange>& changes)
 {
-    bool ok = false;
-    double numValue = value.toDouble(&ok);
-    if (!ok) {
-        return def.defaultValue;
+    if (m_traceRecorder) {
+        recordPending(currentTimeMs);
     }
 
-    if (def.minValue.isValid()) {
-        double minVal = def.minValue.toDouble();
-        numValue = qMax(numValue, minVal);
+    int accepted = 0;
+    const int count = m_pending.size();
+
+    for (int begin = 0; begin < count;) {
+        const int end = prevalidateSegment(begin, currentTimeMs);
+
+        for (int i = begin; i < end; ++i) {
+            const PendingUpdate& pending = m_pending.at(i);
+            NumericCheck check;
+            if (pending.lane >= 0) {
+                const int word = pending.lane / 64;
+                const quint64 bit = quint64(1) << (pending.lane % 64);
+                check.clampedValue = m_scratch.clampedValues.at(pending.lane);
+                check.outOfRange = (m_scratch.outOfRange.at(word) & bit) != 0;
+                check.rateViolation = (m_scratch.rateViolation.at(word) & bit) != 0;
+            }
+
+            SignalChange change = applyUpdate(pending.handle, pending.input,
+                                              pending.sourceTimestampMs, currentTimeMs,
+                                              pending.lane >= 0 ? &check : nullptr);
+            if (change.value.validity == SignalValidity::Valid) {
+                ++accepted;
+            }
+            if (passesChangeFilter(m_signals[pending.handle.index], change, currentTimeMs)) {
+                collectChange(std::move(change), changes);
+            }
+        }
+
+        begin = end;
     }
 
-    if (def.maxValue.isValid()) {
-        double maxVal = def.maxValue.toDouble();
-        numValue = qMin(numValue, maxVal);
+    m_pending.clear();
+    return accepted;
+}
+
+int SignalHub::prevalidateSegment(int begin, qint64 currentTimeMs)
+{
+    ValidationScratch& scratch = m_scratch;
+    if (++scratch.stamp == 0) {
+        scratch.seenStamp.fill(0);
+        scratch.stamp = 1;
     }
 
-    return QVariant(numValue);
+    // Gather distinct signals; a repeat ends the segment because its rate
+    // check depends on the state left by the earlier entry
+    int lanes = 0;
+    int end = begin;
+    for (; end < m_pending.size(); ++end) {
+        PendingUpdate& pending = m_pending[end];
+        quint32& seen = scratch.seenStamp[pending.handle.index];
+        if (seen == scratch.stamp) {
+            break;
+        }
+        seen = scratch.stamp;
+
+        pending.lane = -1;
+        if (!pending.input.convertible || !pending.input.scalar.isNumeric()) {
+            continue;
+        }
+
+        const uint32_t index = pending.handle.index;
+        const SignalState& state = m_signals.at(index);
+        const bool rateChecked = state.definition.maxRateOfChange > 0.0 &&
+                                 state.current.validity == SignalValidity::Valid &&
+                                 state.previousTimestampMs != 0;
+
+        pending.lane = lanes++;
+        scratch.values[pending.lane] = pending.input.scalar.toDouble();
+        scratch.minValues[pending.lane] = m_minValues.at(index);
+        scratch.maxValues[pending.lane] = m_maxValues.at(index);
+        scratch.previousValues[pending.lane] = state.previousValue.toDouble();
+        scratch.maxRates[pending.lane] = state.definition.maxRateOfChange;
+        scratch.deltaTimesMs[pending.lane] =
+            rateChecked ? static_cast<double>(currentTimeMs - state.previousTimestampMs) : 0.0;
+    }
+
+    if (lanes > 0) {
+        NumericValidationBatch batch;
+        batch.count = lanes;
+        batch.values = scratch.values.constData();
+        batch.minValues = scratch.minValues.constData();
+        batch.maxValues = scratch.maxValues.constData();
+        batch.previousValues = scratch.previousValues.constData();
+        batch.maxRates = scratch.maxRates.constData();
+        batch.deltaTimesMs = scratch.deltaTimesMs.constData();
+        batch.clampedValues = scratch.clampedValues.data();
+        batch.outOfRangeMask = scratch.outOfRange.data();
+        batch.rateViolationMask = scratch.rateViolation.data();
+        validateNumericBatch(batch);
+    }
+
+    return end;
+}
+
+SignalChange SignalHub::applyUpdate(SignalHandle handle,
+                                    const TypedInput& input,
+                                    qint64 sourceTimestampMs,
+                                    qint64 currentTimeMs,
+                                    const NumericCheck* check)
+{
+    SignalState& state = m_signals[handle.index];
+    const QString& signalId = state.definition.id;
+
+    // Seal the signal table on first update; readers go lock-free from here
+    if (!m_initialized.load(std::memory_order_relaxed)) {
+        m_initialized.store(true, std::memory_order_release);
+    }
+
+    SignalValidity oldValidity = state.current.validity;
+    SignalValidity newValidity = SignalValidity::Valid;
+    ScalarValue finalValue = input.scalar;
+
+    if (!input.convertible) {
+        // Value cannot be represented in the declared kind: keep last value
+        finalValue = state.current.value;
+        newValidity = SignalValidity::Invalid;
+        qWarning() << "SignalHub: Unconvertible value for" << signalId;
+    } else if (check) {
+        // Range/rate decisions already taken by the batch kernel
+        if (check->outOfRange) {
+            finalValue = ScalarValue(check->clampedValue).convertedTo(finalValue.kind);
+            if (state.definition.isSafetyCritical) {
+                newValidity = SignalValidity::OutOfRange;
+            }
+        }
+        if (check->rateViolation) {
+            newValidity = SignalValidity::Invalid;
+            qWarning() << "SignalHub: Rate-of-change violation for" << signalId;
+        }
+    } else if (finalValue.isNumeric()) {
+        const double numValue = finalValue.toDouble();
+
+        // Validate range (SR-CL-002)
+        if (!validateRange(handle.index, numValue)) {
+            // Clamp; critical signals are additionally flagged
+            finalValue = clampValue(handle.index, finalValue);
+            if (state.definition.isSafetyCritical) {
+                newValidity = SignalValidity::OutOfRange;
+            }
+        }
+
+        // Validate rate of change (plausibility)
+        if (state.definition.maxRateOfChange > 0.0 &&
+            state.current.validity == SignalValidity::Valid) {
+            if (!validateRateOfChange(state, numValue, currentTimeMs)) {
+                newValidity = SignalValidity::Invalid;
+                qWarning() << "SignalHub: Rate-of-change violation for" << signalId;
+            }
+        }
+    }
+
+    // Store previous for rate-of-change calculation
+    state.previousValue = state.current.value;
+    state.previousTimestampMs = state.current.timestampMs;
+
+    // Update current value
+    state.current.value = finalValue;
+    if (finalValue.kind == SignalKind::String && input.convertible) {
+        state.current.text = input.text;
+    }
+    state.current.validity = newValidity;
+    state.current.timestampMs = currentTimeMs;
+    state.current.sourceTimestampMs = sourceTimestampMs;
+    state.current.updateCount++;
+
+    publish(handle, state.current);
+
+    if (m_telemetryEnabled.load(std::memory_order_relaxed)) {
+        const qint64 sourceLatencyUs =
+            sourceTimestampMs > 0 && sourceTimestampMs <= currentTimeMs
+                ? (currentTimeMs - sourceTimestampMs) * 1000 : -1;
+        m_telemetry[handle.index].recordCommit(telemetryTimeUs(), sourceLatencyUs,
+                                               newValidity == SignalValidity::Valid);
+    }
+
+    // Only Valid signals can go stale (SR-CL-001); derived ones follow their inputs
+    if (newValidity == SignalValidity::Valid) {
+        if (state.derivedSlot < 0) {
+            m_freshness.schedule(handle.index, currentTimeMs + state.definition.freshnessMs);
+        }
+        state.history.append(currentTimeMs, finalValue.toDouble());
+        if (state.viewAggregators > 0) {
+            state.viewTick.add(finalValue.toDouble());
+        }
+    } else {
+        m_freshness.cancel(handle.index);
+    }
+
+    if (!state.dependents.isEmpty()) {
+        markDependentsDirty(state);
+    }
+
+    // Track invalid count for degraded mode (writers are serialized)
+    int invalidCount = m_invalidCount.load(std::memory_order_relaxed);
+    if (oldValidity == SignalValidity::Valid &&
+        newValidity != SignalValidity::Valid) {
+        invalidCount++;
+    } else if (oldValidity != SignalValidity::Valid &&
+               newValidity == SignalValidity::Valid) {
+        invalidCount = qMax(0, invalidCount - 1);
+    }
+    m_invalidCount.store(invalidCount, std::memory_order_release);
+
+    SignalChange change;
+    change.handle = handle;
+    change.signalId = signalId;
+    change.value = state.current;
+    change.oldValidity = oldValidity;
+    return change;
+}
+
+bool SignalHub::passesChangeFilter(SignalState& state, const SignalChange& change,
+                                   qint64 currentTimeMs)
+{
+    if (!state.changeFilter) {
+        return true;
+    }
+
+    const SignalDefinition& def = state.definition;
+    const double value = filterValue(def, change.value.toDouble());
+
+    // The first value and validity transitions are never suppressed
+    if (state.notified && !change.validityChanged()) {
+        if (!exceedsDeadband(def, value, state.notifiedValue)) {
+            return false;
+        }
+        if (currentTimeMs - state.notifiedAtMs < def.minPublishIntervalMs) {
+            // Visible change, but too soon: released by publishHeldChanges()
+            if (!state.held) {
+                state.held = true;
+                m_heldSignals.append(change.handle.index);
+            }
+            return false;
+        }
+    }
+
+    state.notified = true;
+    state.notifiedValue = value;
+    state.notifiedAtMs = currentTimeMs;
+    return true;
+}
+
+int SignalHub::publishHeldChanges()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_heldSignals.isEmpty()) {
+        return 0;
+    }
+
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    QVector<SignalChange> changes;
+    int released = 0;
+    int waiting = 0;
+
+    for (int i = 0; i < m_heldSignals.size(); ++i) {
+        const uint32_t index = m_heldSignals.at(i);
+        SignalState& state = m_signals[index];
+        const SignalDefinition& def = state.definition;
+        if (currentTimeMs - state.notifiedAtMs < def.minPublishIntervalMs) {
+            m_heldSignals[waiting++] = index;
+            continue;
+        }
+
+        // Latest value; dropped if it has meanwhile returned into the band
+        state.held = false;
+        const double value = filterValue(def, state.current.value.toDouble());
+        if (!exceedsDeadband(def, value, state.notifiedValue)) {
+            continue;
+        }
+
+        state.notifiedValue = value;
+        state.notifiedAtMs = currentTimeMs;
+        ++released;
+        collectChange({SignalHandle(index), def.id, state.current, state.current.validity},
+                      changes);
+    }
+    m_heldSignals.resize(waiting);
+
+    locker.unlock();
+
+    if (!changes.isEmpty()) {
+        deliver(changes);
+        emit signalsUpdated(changes);
+    }
+    return released;
+}
+
+void SignalHub::markDirty(uint32_t index, SignalValidity oldValidity)
+{
+    quint64& word = m_dirtyBits[index / 64];
+    const quint64 bit = quint64(1) << (index % 64);
+    if (word & bit) {
+        return;   // Keep the validity from before the first change
+    }
+
+    word |= bit;
+    m_signals[index].pendingOldValidity = oldValidity;
+    ++m_dirtyCount;
+}
+
+void SignalHub::markDependentsDirty(const SignalState& state)
+{
+    for (const uint32_t dependent : state.dependents) {
+        const int slot = m_signals.at(dependent).derivedSlot;
+        m_derivedDirty[slot / 64] |= quint64(1) << (slot % 64);
+    }
+    m_derivedPending = true;
+}
+
+int SignalHub::updateDerivedSignals()
+{
+    QVector<SignalChange> changes;
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_derivedPending) {
+        return 0;
+    }
+
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    int recomputed = 0;
+
+    // Dependency order: a recomputed signal marks its dependents, which
+    // come later in the walk, so chains settle within one call
+    for (const int slot : m_derivedOrder) {
+        quint64& word = m_derivedDirty[slot / 64];
+        const quint64 bit = quint64(1) << (slot % 64);
+        if ((word & bit) == 0) {
+            continue;
+        }
+        word &= ~bit;
+
+        DerivedSignal& derived = m_derived[slot];
+        bool changed = !derived.evaluated;
+        SignalValidity validity = SignalValidity::Valid;
+        qint64 sourceTimestampMs = 0;
+
+        for (int i = 0; i < derived.inputs.size(); ++i) {
+            const SignalValue& input = m_signals.at(derived.inputs.at(i).index).current;
+            SignalValue& last = derived.inputValues[i];
+            if (last.validity != input.validity || !(last.value == input.value) ||
+                last.text != input.text) {
+                changed = true;
+            }
+            last = input;
+
+            // Invalid dominates NotAvailable, which dominates Stale
+            if (input.validity == SignalValidity::Invalid ||
+                input.validity == SignalValidity::OutOfRange) {
+                validity = SignalValidity::Invalid;
+            } else if (input.validity == SignalValidity::NotAvailable &&
+                       validity != SignalValidity::Invalid) {
+                validity = SignalValidity::NotAvailable;
+            } else if (input.validity == SignalValidity::Stale &&
+                       validity == SignalValidity::Valid) {
+                validity = SignalValidity::Stale;
+            }
+
+            if (input.sourceTimestampMs > 0 &&
+                (sourceTimestampMs == 0 || input.sourceTimestampMs < sourceTimestampMs)) {
+                sourceTimestampMs = input.sourceTimestampMs;
+            }
+        }
+        if (!changed) {
+            continue;
+        }
+        derived.evaluated = true;
+
+        const SignalHandle handle(derived.index);
+        SignalChange change;
+        if (validity == SignalValidity::Valid) {
+            TypedInput input;
+            input.scalar = derived.compute(derived.inputValues)
+                               .convertedTo(m_signals.at(derived.index).definition.kind);
+            change = applyUpdate(handle, input, sourceTimestampMs, currentTimeMs);
+            ++recomputed;
+        } else if (!propagateValidity(derived.index, validity, change)) {
+            continue;
+        }
+
+        if (passesChangeFilter(m_signals[derived.index], change, currentTimeMs)) {
+            collectChange(std::move(change), changes);
+        }
+    }
+    m_derivedPending = false;
+
+    finishBatch(changes, locker);
+    return recomputed;
+}
+
+bool SignalHub::propagateValidity(uint32_t index, SignalValidity validity,
+                                  SignalChange& change)
+{
+    SignalState& state = m_signals[index];
+    const SignalValidity oldValidity = state.current.validity;
+    if (oldValidity == validity) {
+        return false;
+    }
+
+    // Keep the last value, as a stale raw signal does
+    state.current.validity = validity;
+    publishSlot(index, state.current);
+    if (!state.dependents.isEmpty()) {
+        markDependentsDirty(state);
+    }
+
+    if (oldValidity == SignalValidity::Valid) {
+        m_invalidCount.store(m_invalidCount.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_release);
+    }
+
+    change.handle = SignalHandle(index);
+    change.signalId = state.definition.id;
+    change.value = state.current;
+    change.oldValidity = oldValidity;
+    return true;
+}
+
+int SignalHub::publishPending()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_dirtyCount == 0) {
+        return 0;
+    }
+
+    QVector<SignalChange> changes;
+    changes.reserve(m_dirtyCount);
+
+    // Walk set bits only, in handle order
+    for (int word = 0; word < m_dirtyBits.size(); ++word) {
+        quint64 bits = m_dirtyBits[word];
+        while (bits != 0) {
+            const uint32_t index = static_cast<uint32_t>(word) * 64 +
+                                   qCountTrailingZeroBits(bits);
+            bits &= bits - 1;
+
+            const SignalState& state = m_signals.at(index);
+            changes.append({SignalHandle(index), state.definition.id,
+                            state.current, state.pendingOldValidity});
+        }
+        m_dirtyBits[word] = 0;
+    }
+    m_dirtyCount = 0;
+
+    locker.unlock();
+
+    deliver(changes);
+    emit signalsUpdated(changes);
+    return static_cast<int>(changes.size());
+}
+
+bool SignalHub::updateDegradedMode()
+{
+    const bool shouldBeDegraded = m_invalidCount.load(std::memory_order_relaxed) > 0;
+    if (shouldBeDegraded == m_degradedMode.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    m_degradedMode.store(shouldBeDegraded, std::memory_order_release);
+    return true;
+}
+
+SignalValue SignalHub::getSignal(SignalHandle handle) const
+{
+    if (isSealed()) {
+        return readPublished(handle);
+    }
+
+    // Registration may still grow the table
+    QMutexLocker locker(&m_mutex);
+    return readPublished(handle);
+}
+
+SignalValue SignalHub::getSignal(const QString& signalId) const
+{
+    return getSignal(signalHandle(signalId));
+}
+
+SignalValidity SignalHub::signalValidity(SignalHandle handle) const
+{
+    if (isSealed()) {
+        return isValidHandle(handle) ? m_published[handle.index].validity()
+                                     : SignalValidity::NotAvailable;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return isValidHandle(handle) ? m_published[handle.index].validity()
+                                 : SignalValidity::NotAvailable;
+}
+
+SignalValidity SignalHub::signalValidity(const QString& signalId) const
+{
+    return signalValidity(signalHandle(signalId));
+}
+
+HistoryStats SignalHub::signalHistoryStats(SignalHandle handle, qint64 windowMs) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (!isValidHandle(handle)) {
+        return HistoryStats();
+    }
+
+    const qint64 nowMs = currentMonotonicTimeMs();
+    return m_signals.at(handle.index).history.stats(nowMs - windowMs, nowMs);
+}
+
+QVector<HistorySample> SignalHub::signalHistory(SignalHandle handle, qint64 windowMs,
+                                                int maxPoints) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (!isValidHandle(handle)) {
+        return QVector<HistorySample>();
+    }
+
+    const qint64 nowMs = currentMonotonicTimeMs();
+    return m_signals.at(handle.index).history.range(nowMs - windowMs, nowMs, maxPoints);
+}
+
+void SignalHub::checkFreshness()
+{
+    QMutexLocker locker(&m_mutex);
+
+    const qint64 currentTimeMs = currentMonotonicTimeMs();
+    QVector<SignalChange> validityChanges;
+    int invalidCount = m_invalidCount.load(std::memory_order_relaxed);
+
+    // Visit only the signals whose deadline has passed
+    uint32_t index = 0;
+    while (m_freshness.popExpired(currentTimeMs, index)) {
+        SignalState& state = m_signals[index];
+        if (state.current.validity != SignalValidity::Valid) {
+            continue;
+        }
+
+        // Requirement: SR-CL-001 - stale indicator within freshnessMs
+        SignalValidity oldValidity = state.current.validity;
+        state.current.validity = SignalValidity::Stale;
+        publishSlot(index, state.current);
+        if (!state.dependents.isEmpty()) {
+            markDependentsDirty(state);
+        }
+
+        invalidCount++;
+        if (m_coalescing) {
+            markDirty(index, oldValidity);
+        } else {
+            validityChanges.append({SignalHandle(index), state.definition.id,
+                                    state.current, oldValidity});
+        }
+    }
+    m_invalidCount.store(invalidCount, std::memory_order_release);
+
+    // Check degraded mode (SR-CL-004)
+    const bool degradedChanged = updateDegradedMode();
+    const bool shouldBeDegraded = m_degradedMode.load(std::memory_order_relaxed);
+
+    locker.unlock();
+
+    // Emit signals outside of lock
+    deliver(validityChanges);
+    for (const SignalChange& change : validityChanges) {
+        emit signalValidityChanged(change.signalId, change.oldValidity,
+                                   change.value.validity);
+    }
+
+    if (degradedChanged) {
+        emit degradedModeChanged(shouldBeDegraded);
+    }
+}
+
+void SignalHub::setCoalescingEnabled(bool enabled)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_coalescing == enabled) {
+            return;
+        }
+        m_coalescing = enabled;
+        if (enabled || m_dirtyCount == 0) {
+            return;
+        }
+    }
+
+    // Flush what was collected while coalescing
+    publishPending();
+}
+
+bool SignalHub::isCoalescingEnabled() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_coalescing;
+}
+
+int SignalHub::publishChanges()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_coalescing || m_dirtyCount == 0) {
+            return 0;
+        }
+    }
+
+    return publishPending();
+}
+
+void SignalHub::processTick()
+{
+    drainProducers();
+
+    // After the drain: replaying the marker re-runs the rest of the tick,
+    // the drained input having been recorded as a batch
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_traceRecorder) {
+            m_traceRecorder->recordTick(currentMonotonicTimeMs());
+        }
+        if (m_mirror) {
+            m_mirror->setHeartbeat(currentMonotonicTimeMs());
+        }
+    }
+
+    checkFreshness();
+    updateDerivedSignals();
+    publishHeldChanges();
+    publishChanges();
+    serviceViews();
+    publishSnapshot();
+}
+
+bool SignalHub::publishSnapshot()
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_initialized.load(std::memory_order_relaxed)) {
+        m_initialized.store(true, std::memory_order_release);
+    }
+
+    // Any buffer but the current one that no reader holds
+    const int current = m_currentSnapshot.load(std::memory_order_seq_cst);
+    int target = -1;
+    for (int i = 0; i < SNAPSHOT_BUFFERS; ++i) {
+        if (i != current && m_snapshots[i].pins.load(std::memory_order_seq_cst) == 0) {
+            target = i;
+            break;
+        }
+    }
+    if (target < 0) {
+        qWarning() << "SignalHub: Snapshot skipped, all buffers pinned";
+        return false;
+    }
+
+    SnapshotBuffer& buffer = m_snapshots[target];
+    for (int i = 0; i < m_signals.size(); ++i) {
+        const SignalValue& value = m_signals.at(i).current;
+        SnapshotRecord& record = buffer.records[i];
+        record.handle = SignalHandle(static_cast<uint32_t>(i));
+        record.validity = value.validity;
+        record.updateCount = value.updateCount;
+        record.value = value.value;
+        record.timestampMs = value.timestampMs;
+        record.sourceTimestampMs = value.sourceTimestampMs;
+        if (value.value.kind == SignalKind::String) {
+            buffer.texts[i] = value.text;
+        }
+    }
+    buffer.epoch = ++m_snapshotEpoch;
+    buffer.timestampMs = currentMonotonicTimeMs();
+    buffer.degradedMode = m_degradedMode.load(std::memory_order_relaxed);
+    buffer.invalidCount = m_invalidCount.load(std::memory_order_relaxed);
+
+    m_currentSnapshot.store(target, std::memory_order_seq_cst);
+    return true;
+}
+
+SignalSnapshot SignalHub::snapshot() const
+{
+    // Pin, then confirm the buffer is still current; the writer only fills
+    // non-current buffers with no pins (seq_cst orders both checks)
+    for (;;) {
+        const int current = m_currentSnapshot.load(std::memory_order_seq_cst);
+        if (current < 0) {
+            return SignalSnapshot();
+        }
+
+        SnapshotBuffer& buffer = m_snapshots[current];
+        buffer.pins.fetch_add(1, std::memory_order_seq_cst);
+        if (m_currentSnapshot.load(std::memory_order_seq_cst) == current) {
+            return SignalSnapshot(&buffer);
+        }
+        buffer.pins.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+quint64 SignalHub::snapshotEpoch() const
+{
+    const SignalSnapshot pinned = snapshot();
+    return pinned.epoch();
+}
+
+SubscriptionId SignalHub::subscribe(const QVector<SignalHandle>& handles,
+                                    SignalCallback callback)
+{
+    if (!callback) {
+        qWarning() << "SignalHub: Cannot subscribe with an empty callback";
+        return 0;
+    }
+
+    const int count = signalCount();
+    QMutexLocker locker(&m_subscriberMutex);
+
+    auto table = m_subscribers ? std::make_shared<SubscriberTable>(*m_subscribers)
+                               : std::make_shared<SubscriberTable>();
+    if (table->size() < count) {
+        table->resize(count);
+    }
+
+    const SubscriptionId id = m_nextSubscriptionId;
+    bool subscribed = false;
+    for (SignalHandle handle : handles) {
+        if (handle.index >= static_cast<uint32_t>(count)) {
+            qWarning() << "SignalHub: Cannot subscribe to unknown handle:" << handle.index;
+            continue;
+        }
+
+        QVector<Subscriber>& list = (*table)[handle.index];
+        const bool duplicate = std::any_of(list.cbegin(), list.cend(),
+            [id](const Subscriber& subscriber) { return subscriber.id == id; });
+        if (!duplicate) {
+            list.append({id, callback});
+            subscribed = true;
+        }
+    }
+
+    if (!subscribed) {
+        return 0;
+    }
+
+    ++m_nextSubscriptionId;
+    m_subscribers = std::move(table);
+    return id;
+}
+
+SubscriptionId SignalHub::subscribe(SignalHandle handle, SignalCallback callback)
+{
+    return subscribe(QVector<SignalHandle>{handle}, std::move(callback));
+}
+
+SubscriptionId SignalHub::subscribe(const QStringList& signalIds, SignalCallback callback)
+{
+    QVector<SignalHandle> handles;
+    handles.reserve(signalIds.size());
+    for (const QString& id : signalIds) {
+        const SignalHandle handle = signalHandle(id);
+        if (!handle.isValid()) {
+            qWarning() << "SignalHub: Cannot subscribe to unknown signal:" << id;
+            continue;
+        }
+        handles.append(handle);
+    }
+
+    return subscribe(handles, std::move(callback));
+}
+
+void SignalHub::unsubscribe(SubscriptionId id)
+{
+    if (id == 0) {
+        return;
+    }
+
+    QMutexLocker locker(&m_subscriberMutex);
+    if (!m_subscribers) {
+        return;
+    }
+
+    auto table = std::make_shared<SubscriberTable>(*m_subscribers);
+    for (QVector<Subscriber>& list : *table) {
+        list.removeIf([id](const Subscriber& subscriber) { return subscriber.id == id; });
+    }
+    m_subscribers = std::move(table);
+}
+
+std::shared_ptr<const SignalHub::SubscriberTable> SignalHub::subscriberTable() const
+{
+    QMutexLocker locker(&m_subscriberMutex);
+    return m_subscribers;
+}
+
+void SignalHub::deliver(const SignalChange& change) const
+{
+    if (m_telemetryEnabled.load(std::memory_order_relaxed)) {
+        recordNotification(change, telemetryTimeUs());
+    }
+
+    const auto table = subscriberTable();
+    if (!table || change.handle.index >= static_cast<uint32_t>(table->size())) {
+        return;
+    }
+
+    for (const Subscriber& subscriber : table->at(change.handle.index)) {
+        subscriber.callback(change);
+    }
+}
+
+void SignalHub::deliver(const QVector<SignalChange>& changes) const
+{
+    if (m_telemetryEnabled.load(std::memory_order_relaxed)) {
+        const qint64 nowUs = telemetryTimeUs();
+        for (const SignalChange& change : changes) {
+            recordNotification(change, nowUs);
+        }
+    }
+
+    const auto table = subscriberTable();
+    if (!table) {
+        return;
+    }
+
+    for (const SignalChange& change : changes) {
+        if (change.handle.index >= static_cast<uint32_t>(table->size())) {
+            continue;
+        }
+        for (const Subscriber& subscriber : table->at(change.handle.index)) {
+            subscriber.callback(change);
+        }
+    }
+}
+
+QStringList SignalHub::registeredSignals() const
+{
+    if (isSealed()) {
+        return m_signalIds;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return m_signalIds;
+}
+
+int SignalHub::signalCount() const
+{
+    if (isSealed()) {
+        return static_cast<int>(m_signals.size());
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_signals.size());
+}
+
+bool SignalHub::isDegradedMode() const
+{
+    return m_degradedMode.load(std::memory_order_acquire);
+}
+
+int SignalHub::invalidSignalCount() const
+{
+    return m_invalidCount.load(std::memory_order_acquire);
+}
+
+SignalValue SignalHub::readPublished(SignalHandle handle) const
+{
+    if (!isValidHandle(handle)) {
+        SignalValue invalid;
+        invalid.validity = SignalValidity::NotAvailable;
+        return invalid;
+    }
+
+    SignalValue value = m_published[handle.index].load();
+    if (value.value.kind == SignalKind::String) {
+        QMutexLocker textLocker(&m_textMutex);
+        value.text = m_publishedText.at(handle.index);
+    }
+    return value;
+}
+
+void SignalHub::publish(SignalHandle handle, const SignalValue& value)
+{
+    // Text first, so a reader that observes the new slot also sees its text
+    if (value.value.kind == SignalKind::String) {
+        QMutexLocker textLocker(&m_textMutex);
+        m_publishedText[handle.index] = value.text;
+        if (m_mirror) {
+            m_mirror->storeText(handle.index, value.text);
+        }
+    }
+    publishSlot(handle.index, value);
+}
+
+void SignalHub::publishSlot(uint32_t index, const SignalValue& value)
+{
+    m_published[index].store(value);
+    if (m_mirror) {
+        m_mirror->store(index, value);
+    }
+}
+
+bool SignalHub::validateRange(uint32_t index, double value) const
+{
+    return !(value < m_minValues.at(index)) && !(value > m_maxValues.at(index));
+}
+
+bool SignalHub::validateRateOfChange(const SignalState& state,
+                                      double newValue,
+                                      qint64 currentTimeMs) const
+{
+    if (state.previousTimestampMs == 0) {
+        return true; // First update, no previous value
+    }
+
+    qint64 deltaTimeMs = currentTimeMs - state.previousTimestampMs;
+    if (deltaTimeMs <= 0) {
+        return true; // Prevent division by zero
+    }
+
+    double deltaValue = std::abs(newValue - state.previousValue.toDouble());
+    double ratePerSecond = (deltaValue * 1000.0) / static_cast<double>(deltaTimeMs);
+
+    return ratePerSecond <= state.definition.maxRateOfChange;
+}
+
+ScalarValue SignalHub::clampValue(uint32_t index, const ScalarValue& value) const
+{
+    double numValue = value.toDouble();
+    numValue = qMax(numValue, m_minValues.at(index));
+    numValue = qMin(numValue, m_maxValues.at(index));
+    return ScalarValue(numValue).convertedTo(value.kind);
+}
+
+void SignalHub::setTraceRecorder(SignalTraceRecorder* recorder)
+{
+    QMutexLocker locker(&m_mutex);
+    m_traceRecorder = recorder;
+}
+
+bool SignalHub::exportSharedMirror(const QString& key, QString* error)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_mirror) {
+        if (error) {
+            *error = QStringLiteral("Already exported");
+        }
+        return false;
+    }
+
+    QVector<SignalKind> kinds;
+    kinds.reserve(m_signals.size());
+    for (const SignalState& state : m_signals) {
+        kinds.append(state.definition.kind);
+    }
+
+    auto mirror = std::make_unique<SignalMirrorWriter>();
+    if (!mirror->create(key, m_signalIds, kinds, error)) {
+        qWarning() << "SignalHub: Cannot export shared mirror" << key;
+        return false;
+    }
+
+    // The segment is sized for the table as it stands
+    if (!m_initialized.load(std::memory_order_relaxed)) {
+        m_initialized.store(true, std::memory_order_release);
+    }
+
+    for (int i = 0; i < m_signals.size(); ++i) {
+        const SignalValue& current = m_signals.at(i).current;
+        if (current.value.kind == SignalKind::String) {
+            mirror->storeText(static_cast<uint32_t>(i), current.text);
+        }
+        mirror->store(static_cast<uint32_t>(i), current);
+    }
+    mirror->setHeartbeat(currentMonotonicTimeMs());
+    mirror->setReady();
+    m_mirror = std::move(mirror);
+    return true;
+}
+
+void SignalHub::setClockOverride(qint64 timeMs)
+{
+    m_clockOverrideMs.store(timeMs < 0 ? -1 : timeMs, std::memory_order_relaxed);
+}
+
+qint64 SignalHub::monotonicTimeMs() const
+{
+    return currentMonotonicTimeMs();
+}
+
+void SignalHub::recordPending(qint64 currentTimeMs)
+{
+    const int last = m_pending.size() - 1;
+    for (int i = 0; i <= last; ++i) {
+        const PendingUpdate& pending = m_pending.at(i);
+        m_traceRecorder->recordUpdate(pending.handle, pending.input.scalar, pending.input.text,
+                                      pending.input.convertible, currentTimeMs,
+                                      pending.sourceTimestampMs,
+                                      i == last ? SignalTraceRecorder::BatchEnd
+                                                : SignalTraceRecorder::InBatch);
+    }
+}
+
+void SignalHub::setTelemetryEnabled(bool enabled)
+{
+    m_telemetryEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool SignalHub::isTelemetryEnabled() const
+{
+    return m_telemetryEnabled.load(std::memory_order_relaxed);
+}
+
+SignalTelemetryStats SignalHub::signalTelemetry(SignalHandle handle) const
+{
+    if (isSealed()) {
+        return isValidHandle(handle) ? m_telemetry[handle.index].stats()
+                                     : SignalTelemetryStats();
+    }
+
+    QMutexLocker locker(&m_mutex);
+    return isValidHandle(handle) ? m_telemetry[handle.index].stats() : SignalTelemetryStats();
+}
+
+void SignalHub::resetTelemetry()
+{
+    QMutexLocker locker(&m_mutex);
+    for (SignalTelemetry& telemetry : m_telemetry) {
+        telemetry.reset();
+    }
+}
+
+QVariantMap SignalHub::getDiagnostics() const
+{
+    QVariantMap diag;
+    diag[QStringLiteral("signalCount")] = signalCount();
+    diag[QStringLiteral("invalidSignals")] = invalidSignalCount();
+    diag[QStringLiteral("degradedMode")] = isDegradedMode();
+    diag[QStringLiteral("snapshotEpoch")] = static_cast<qint64>(snapshotEpoch());
+
+    qint64 producerDropped = 0;
+    for (const ProducerStats& producer : producerStats()) {
+        producerDropped += static_cast<qint64>(producer.dropped);
+    }
+    diag[QStringLiteral("producerDropped")] = producerDropped;
+
+    const bool telemetry = isTelemetryEnabled();
+    diag[QStringLiteral("telemetryEnabled")] = telemetry;
+    if (!telemetry) {
+        return diag;
+    }
+
+    const QStringList ids = registeredSignals();
+    QVector<SignalTelemetryStats> stats;
+    const QVector<uint32_t> order = signalsByRate(stats);
+
+    QVariantList signalList;
+    signalList.reserve(order.size());
+    for (uint32_t index : order) {
+        const SignalTelemetryStats& s = stats.at(static_cast<int>(index));
+        QVariantMap entry;
+        entry[QStringLiteral("id")] = ids.at(static_cast<int>(index));
+        entry[QStringLiteral("updates")] = static_cast<qint64>(s.updates);
+        entry[QStringLiteral("rejected")] = static_cast<qint64>(s.rejected);
+        entry[QStringLiteral("notifications")] = static_cast<qint64>(s.notifications);
+        entry[QStringLiteral("rateHz")] = s.rateHz;
+        entry[QStringLiteral("meanIntervalUs")] = s.meanIntervalUs;
+        entry[QStringLiteral("maxIntervalUs")] = s.maxIntervalUs;
+        entry[QStringLiteral("jitterUs")] = s.jitterUs;
+        entry[QStringLiteral("sourceLatencyP50Us")] = s.sourceLatency.percentileUs(0.50);
+        entry[QStringLiteral("sourceLatencyP99Us")] = s.sourceLatency.percentileUs(0.99);
+        entry[QStringLiteral("sourceLatencyMaxUs")] = s.sourceLatency.maxUs;
+        entry[QStringLiteral("notifyLatencyP50Us")] = s.notifyLatency.percentileUs(0.50);
+        entry[QStringLiteral("notifyLatencyP99Us")] = s.notifyLatency.percentileUs(0.99);
+        entry[QStringLiteral("notifyLatencyMaxUs")] = s.notifyLatency.maxUs;
+        signalList.append(entry);
+    }
+    diag[QStringLiteral("signals")] = signalList;
+    return diag;
+}
+
+QString SignalHub::telemetryReport(int maxSignals) const
+{
+    const QStringList ids = registeredSignals();
+    QVector<SignalTelemetryStats> stats;
+    const QVector<uint32_t> order = signalsByRate(stats);
+    const int total = static_cast<int>(order.size());
+    const int rows = maxSignals > 0 ? qMin(maxSignals, total) : total;
+
+    QString report = QString::asprintf("%-32s %9s %8s %9s %9s %10s %10s %10s %10s\n",
+                                       "signal", "updates", "rejected", "rate Hz", "jitter us",
+                                       "src p99 us", "src max us", "ntf p99 us", "ntf max us");
+    for (int row = 0; row < rows; ++row) {
+        const uint32_t index = order.at(row);
+        const SignalTelemetryStats& s = stats.at(static_cast<int>(index));
+        report += QString::asprintf("%-32s %9llu %8llu %9.1f %9.0f %10lld %10lld %10lld %10lld\n",
+                                    qPrintable(ids.at(static_cast<int>(index))),
+                                    static_cast<unsigned long long>(s.updates),
+                                    static_cast<unsigned long long>(s.rejected),
+                                    s.rateHz, s.jitterUs,
+                                    static_cast<long long>(s.sourceLatency.percentileUs(0.99)),
+                                    static_cast<long long>(s.sourceLatency.maxUs),
+                                    static_cast<long long>(s.notifyLatency.percentileUs(0.99)),
+                                    static_cast<long long>(s.notifyLatency.maxUs));
+    }
+    if (!isTelemetryEnabled()) {
+        report += QStringLiteral("(telemetry disabled)\n");
+    }
+    return report;
+}
+
+void SignalHub::recordNotification(const SignalChange& change, qint64 nowUs) const
+{
+    // Stale transitions are not deliveries of a committed value
+    if (change.value.validity == SignalValidity::Stale ||
+        change.handle.index >= static_cast<uint32_t>(m_telemetry.size())) {
+        return;
+    }
+    m_telemetry[change.handle.index].recordNotify(nowUs);
+}
+
+QVector<uint32_t> SignalHub::signalsByRate(QVector<SignalTelemetryStats>& stats) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    const int count = static_cast<int>(m_telemetry.size());
+    stats.resize(count);
+    QVector<uint32_t> order(count);
+    for (int i = 0; i < count; ++i) {
+        stats[i] = m_telemetry[static_cast<size_t>(i)].stats();
+        order[i] = static_cast<uint32_t>(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&stats](uint32_t a, uint32_t b) {
+        return stats.at(static_cast<int>(a)).rateHz > stats.at(static_cast<int>(b)).rateHz;
+    });
+    return order;
 }
 
 qint64 SignalHub::currentMonotonicTimeMs() const
 {
-    return m_monotonicTimer.elapsed();
+    const qint64 overrideMs = m_clockOverrideMs.load(std::memory_order_relaxed);
+    return overrideMs >= 0 ? overrideMs : m_monotonicTimer.elapsed();
 }
 
 } // namespace signal
@@ -6,59 +6,52 @@
 #ifndef AUTOMOTIVE_SIGNAL_HUB_H
 #define AUTOMOTIVE_SIGNAL_HUB_H
 
+#include "signal/SignalTypes.h"
+#include "signal/SignalSlot.h"
+#include "signal/FreshnessQueue.h"
+#include "signal/SignalProducer.h"
+#include "signal/SignalHistory.h"
+#include "signal/SignalValidationKernel.h"
+#include "signal/SignalSnapshot.h"
+#include "signal/SignalCatalogImage.h"
+#include "signal/SignalTelemetry.h"
+#include "signal/SignalView.h"
 #include <QObject>
 #include <QHash>
 #include <QVariant>
+#include <QVariantMap>
 #include <QMutex>
 #include <QElapsedTimer>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace automotive {
 namespace signal {
 
+class SignalTraceRecorder;
+class SignalMirrorWriter;
+
 /**
- * @brief Signal validity state
- *
- * Requirement: SR-CL-002 - Invalid signal ranges shall be clamped and flagged
+ * @brief Identifier of a SignalHub subscription (0 = invalid)
  */
-enum class SignalValidity : uint8_t {
-    Valid = 0,           ///< Signal is within range and fresh
-    Stale,               ///< Signal has not been updated within freshness window
-    OutOfRange,          ///< Signal value exceeds defined limits
-    Invalid,             ///< Signal failed validation (plausibility, etc.)
-    NotAvailable         ///< Signal source not connected
-};
+using SubscriptionId = uint32_t;
 
 /**
- * @brief Signal metadata and value container
+ * @brief Subscriber callback, invoked directly for each delivered change
  */
-struct SignalValue {
-    QVariant value;                    ///< Current signal value
-    SignalValidity validity{SignalValidity::NotAvailable};
-    qint64 timestampMs{0};             ///< Monotonic timestamp of last update
-    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp (if available)
-    uint32_t updateCount{0};           ///< Number of updates received
-
-    bool isValid() const { return validity == SignalValidity::Valid; }
-    bool isDisplayable() const { return validity == SignalValidity::Valid ||
-                                        validity == SignalValidity::Stale; }
-};
+using SignalCallback = std::function<void(const SignalChange& change)>;
 
 /**
- * @brief Signal definition with validation parameters
+ * @brief Compute function of a derived signal
+ *
+ * Receives the current values of the signal's inputs in declaration order,
+ * all of them Valid. Runs under the hub's writer lock, so it must be cheap
+ * and must not call back into the hub.
  */
-struct SignalDefinition {
-    QString id;                        ///< Unique signal identifier
-    QString name;                      ///< Human-readable name
-    QString unit;                      ///< Unit of measurement
-    QVariant minValue;                 ///< Minimum valid value
-    QVariant maxValue;                 ///< Maximum valid value
-    QVariant defaultValue;             ///< Default/fallback value
-    qint64 freshnessMs{300};           ///< Freshness timeout in ms (SR-CL-001: 300ms)
-    double maxRateOfChange{0.0};       ///< Maximum allowed rate of change (0 = disabled)
-    bool isSafetyCritical{false};      ///< Safety-critical flag
-};
+using DerivedSignalFunction = std::function<ScalarValue(const QVector<SignalValue>& inputs)>;
 
 /**
  * @brief Central signal hub for vehicle signal distribution
@@ -70,12 +63,29 @@ struct SignalDefinition {
  * - Rate-of-change plausibility checks
  * - Thread-safe access
  *
+ * Concurrency: writers (updates, freshness checks) are serialized by a
+ * mutex. Readers (getSignal(), signalValidity(), isDegradedMode(), ...) are
+ * lock-free once the signal table is sealed by the first update: every
+ * signal publishes its value through a seqlock SignalSlot, so readers never
+ * block producers. The only read-side lock left is a short text lock for
+ * String-kind signals, whose QString payload cannot live in the slot.
+ *
+ * Values are stored typed according to SignalDefinition::kind. QVariant is
+ * only used by the string-id convenience API and SignalValue::toVariant().
+ *
+ * Noisy numeric signals can suppress notifications through the deadband,
+ * display resolution and minimum publish interval of their definition.
+ * A suppressed update is still stored and refreshes freshness; only the
+ * downstream notification is skipped. Validity transitions always notify.
+ *
  * Safety: Deterministic, bounded operations. No dynamic allocations after init.
  */
 class SignalHub : public QObject {
     Q_OBJECT
 
 public:
+    static constexpr int DEFAULT_PRODUCER_CAPACITY = 256;  ///< Records per producer ring
+
     explicit SignalHub(QObject* parent = nullptr);
     ~SignalHub() override;
 
@@ -86,45 +96,387 @@ public:
     /**
      * @brief Register a signal definition
      * @param def Signal definition
-     * @return true if registered successfully
+     * @return Handle of the registered signal, invalid handle on failure
+     *
+     * Must be called during initialization phase only. Handles are assigned
+     * densely in registration order.
+     */
+    SignalHandle registerSignal(const SignalDefinition& def);
+
+    /**
+     * @brief Pre-size the per-signal tables for @p count signals in total
+     *
+     * Optional; lets bulk registration run without reallocating.
+     */
+    void reserveSignals(int count);
+
+    /**
+     * @brief Register every signal of a precompiled catalog image
+     * @param image Validated image (see SignalCatalogImage)
+     * @return true if all entries were registered, in image order
+     *
+     * Identifiers, names and string defaults keep pointing into the image,
+     * so the hub holds it (and its file mapping) for the hub's lifetime.
+     * Strings obtained from the hub for these signals must not outlive it.
+     */
+    bool registerCatalogImage(std::shared_ptr<const SignalCatalogImage> image);
+
+    /**
+     * @brief Turn a registered signal into one derived from other signals
+     * @param target Signal to compute (any non-string kind)
+     * @param inputs Signals it is computed from (may be derived themselves)
+     * @param compute Function of the input values
+     * @return false if the hub is sealed, a handle is unknown, the target is
+     *         already derived, or the dependency would form a cycle
+     *
+     * Derived signals are recomputed by updateDerivedSignals(), in dependency
+     * order and only if an input has changed since the last evaluation, so
+     * each is committed at most once per tick. The result goes through the
+     * target's range and rate checks, history and change filter like any
+     * update; its source timestamp is the oldest of the inputs'.
+     *
+     * Validity follows the inputs: while any input is Invalid or OutOfRange
+     * the signal is Invalid, else NotAvailable or Stale if any input is, and
+     * it keeps its last value meanwhile. A derived signal therefore has no
+     * deadline of its own (its freshnessMs is unused): it goes Stale with
+     * its inputs and recovers when they do. Derived signals cannot be
+     * updated directly.
      *
      * Must be called during initialization phase only.
      */
-    bool registerSignal(const SignalDefinition& def);
+    bool deriveSignal(SignalHandle target,
+                      const QVector<SignalHandle>& inputs,
+                      DerivedSignalFunction compute);
 
     /**
-     * @brief Update a signal value from source
+     * @brief Resolve a signal identifier to its handle
      * @param signalId Signal identifier
-     * @param value New value
+     * @return Handle, or an invalid handle if the signal is not registered
+     *
+     * Producers and consumers should resolve handles once at setup and use
+     * the handle-based API on the hot path.
+     */
+    SignalHandle signalHandle(const QString& signalId) const;
+
+    /**
+     * @brief Get the identifier of a registered signal
+     * @param handle Signal handle
+     * @return Signal identifier, or an empty string for an unknown handle
+     */
+    QString signalId(SignalHandle handle) const;
+
+    /**
+     * @brief Update a signal value from source
+     * @param handle Signal handle
+     * @param value New value (converted to the signal's declared kind)
      * @param sourceTimestampMs Optional source timestamp
      * @return true if update was accepted (validation passed)
      *
      * This is the primary entry point for signal updates.
      */
+    bool updateSignal(SignalHandle handle,
+                      const ScalarValue& value,
+                      qint64 sourceTimestampMs = 0);
+
+    /**
+     * @brief Update a signal value from text
+     * @param handle Signal handle
+     * @param text New value; parsed for non-string kinds
+     * @param sourceTimestampMs Optional source timestamp
+     * @return true if update was accepted (validation passed)
+     */
+    bool updateSignal(SignalHandle handle,
+                      const QString& text,
+                      qint64 sourceTimestampMs = 0);
+
+    /**
+     * @brief Update a signal value by identifier
+     *
+     * Convenience shim that resolves the handle, converts the variant to the
+     * signal's declared kind and forwards to the typed path.
+     */
     bool updateSignal(const QString& signalId,
                       const QVariant& value,
                       qint64 sourceTimestampMs = 0);
 
+    /**
+     * @brief Update a catalog signal through its typed tag
+     * @tparam Signal Tag from a signal catalog (e.g. Signals::VehicleSpeed)
+     *
+     * Resolves to updateSignal(Signal::handle(), ...) at compile time. The
+     * hub must have been filled with the tag's catalog (registerCatalog()).
+     */
+    template<typename Signal>
+    bool set(const typename Signal::ValueType& value, qint64 sourceTimestampMs = 0)
+    {
+        Q_ASSERT(signalId(Signal::handle()) == QLatin1String(Signal::id));
+        return updateSignal(Signal::handle(), value, sourceTimestampMs);
+    }
+
+    /**
+     * @brief Commit a batch of updates under a single lock
+     * @param batch Updates in application order (e.g. one CAN/IPC frame)
+     * @return Number of updates accepted as Valid
+     *
+     * Each entry is validated exactly as by updateSignal(). The degraded
+     * mode transition is evaluated once for the whole batch, and consumers
+     * are notified once via signalsUpdated() instead of per-signal
+     * signalUpdated()/signalValidityChanged() emissions. Entries with an
+     * unknown handle are skipped.
+     *
+     * Range and rate checks of numeric entries run through the vectorized
+     * validation kernel (SignalValidationKernel.h), one segment of distinct
+     * signals at a time, so repeated updates of a signal still see their
+     * predecessors.
+     */
+    int updateSignals(const SignalBatch& batch);
+
+    /**
+     * @brief Create an ingestion ring for one producer thread
+     * @param name Producer name (for diagnostics)
+     * @param capacity Ring capacity in records (rounded up to a power of two)
+     * @return Producer owned by the hub, valid for the hub's lifetime
+     *
+     * The producer thread calls SignalProducer::push() wait-free; queued
+     * records are committed by drainProducers() on the scheduler tick.
+     */
+    SignalProducer* createProducer(const QString& name,
+                                   int capacity = DEFAULT_PRODUCER_CAPACITY);
+
+    /**
+     * @brief Commit all records queued by producers
+     * @return Number of records drained
+     *
+     * Records are validated as by updateSignal() and committed under a
+     * single lock, producers in creation order, each in FIFO order. At most
+     * one ring's capacity is drained per producer per call, so the tick
+     * stays bounded. Notification follows updateSignals() (or the
+     * coalescing mode).
+     */
+    int drainProducers();
+
+    /**
+     * @brief Ingestion counters of all producers (including overflows)
+     */
+    QVector<ProducerStats> producerStats() const;
+
+    /**
+     * @brief Create a rate-limited view for a slow consumer
+     * @param name View name (for diagnostics)
+     * @param handles Signals of the view; unknown handles are skipped
+     * @param policy Maximum delivery rate and aggregation
+     * @param callback Receives each delivery (see SignalView)
+     * @return View owned by the hub, nullptr if no handle was valid
+     *
+     * Views are serviced by processTick() and may be created at any time.
+     * Average and MinMax aggregate the Valid updates of non-string signals.
+     */
+    SignalView* createView(const QString& name,
+                           const QVector<SignalHandle>& handles,
+                           const SignalViewPolicy& policy,
+                           SignalViewCallback callback);
+
+    /**
+     * @brief Destroy a view
+     *
+     * Safe from any thread and from any view's callback, including the
+     * view's own. A delivery of the view already running finishes first
+     * (the view is freed when it returns); no later delivery starts.
+     */
+    void removeView(SignalView* view);
+
+    /**
+     * @brief Delivery counters of all views, in creation order
+     */
+    QVector<SignalViewStats> viewStats() const;
+
     /**
      * @brief Get current signal value with validity
-     * @param signalId Signal identifier
+     * @param handle Signal handle
      * @return Signal value with metadata
+     *
+     * Lock-free after initialization (seqlock read of the published slot).
+     */
+    SignalValue getSignal(SignalHandle handle) const;
+
+    /**
+     * @brief Get current signal value by identifier
      */
     SignalValue getSignal(const QString& signalId) const;
 
+    /**
+     * @brief Get a catalog signal through its typed tag
+     * @tparam Signal Tag from a signal catalog (e.g. Signals::VehicleSpeed)
+     *
+     * Same as getSignal(Signal::handle()): no string lookup, and a misspelled
+     * signal fails to compile.
+     */
+    template<typename Signal>
+    SignalValue get() const
+    {
+        Q_ASSERT(signalId(Signal::handle()) == QLatin1String(Signal::id));
+        return getSignal(Signal::handle());
+    }
+
+    /**
+     * @brief Get current validity of a signal
+     * @param handle Signal handle
+     * @return Validity, NotAvailable for an unknown handle
+     */
+    SignalValidity signalValidity(SignalHandle handle) const;
+
+    /**
+     * @brief Get current validity of a signal by identifier
+     */
+    SignalValidity signalValidity(const QString& signalId) const;
+
+    /**
+     * @brief Min/max/mean of a signal's recent history
+     * @param handle Signal handle
+     * @param windowMs Window length ending now
+     * @return Aggregate; count is 0 if the signal has no history or no
+     *         samples in the window
+     *
+     * Only signals with SignalDefinition::historyCapacity > 0 record
+     * history, and only Valid updates of non-string kinds are recorded.
+     */
+    HistoryStats signalHistoryStats(SignalHandle handle, qint64 windowMs) const;
+
+    /**
+     * @brief Export a signal's recent history
+     * @param handle Signal handle
+     * @param windowMs Window length ending now
+     * @param maxPoints Downsample to at most this many points (0 = all)
+     */
+    QVector<HistorySample> signalHistory(SignalHandle handle, qint64 windowMs,
+                                         int maxPoints = 0) const;
+
     /**
      * @brief Check and update freshness for all signals
      *
      * Must be called periodically from the scheduler tick.
      * Requirement: SR-CL-001 - stale indicator within 300ms
+     *
+     * Only signals whose deadline (last update + freshnessMs) has passed are
+     * visited, so the cost scales with the number of expiries per tick.
      */
     void checkFreshness();
 
+    /**
+     * @brief Enable or disable per-tick notification coalescing
+     *
+     * When enabled, updates and stale transitions do not emit immediately.
+     * The hub records changed handles in a dirty set and publishChanges()
+     * reports each of them once, with its latest value and the validity
+     * before the first change since the previous publish. Degraded mode
+     * transitions are still emitted immediately (SR-CL-004).
+     *
+     * Disabling flushes any pending changes.
+     */
+    void setCoalescingEnabled(bool enabled);
+    bool isCoalescingEnabled() const;
+
+    /**
+     * @brief Emit the coalesced change set via signalsUpdated()
+     * @return Number of signals reported (0 if nothing changed)
+     *
+     * No-op unless coalescing is enabled. Call once per scheduler or
+     * render tick.
+     */
+    int publishChanges();
+
+    /**
+     * @brief Recompute derived signals whose inputs have changed
+     * @return Number of derived signals committed with a new value
+     *
+     * Called by processTick() after the freshness check. Changes are
+     * notified like a committed batch (or coalesced).
+     */
+    int updateDerivedSignals();
+
+    /**
+     * @brief Per-tick hub processing
+     *
+     * Runs drainProducers(), checkFreshness(), updateDerivedSignals(),
+     * releases changes held back by SignalDefinition::minPublishIntervalMs
+     * whose interval has elapsed, publishChanges(), services the due
+     * SignalViews and finally publishSnapshot().
+     * Intended to be called from the scheduler tick in place of
+     * checkFreshness().
+     */
+    void processTick();
+
+    /**
+     * @brief Publish a consistent snapshot of all signals
+     * @return false if no buffer was free (two older snapshots still held)
+     *
+     * Copies the committed state into one of three pre-sized buffers and
+     * makes it current; called once per tick by processTick(). Like the
+     * first update, the first publish seals registration.
+     */
+    bool publishSnapshot();
+
+    /**
+     * @brief Pin the latest published snapshot
+     * @return Snapshot (invalid before the first publishSnapshot())
+     *
+     * Lock-free. The returned view stays unchanged while held, however
+     * many ticks pass.
+     */
+    SignalSnapshot snapshot() const;
+
+    /**
+     * @brief Epoch of the latest published snapshot (0 = none)
+     */
+    quint64 snapshotEpoch() const;
+
+    /**
+     * @brief Subscribe to changes of specific signals
+     * @param handles Signals of interest
+     * @param callback Called once per delivered change of any of them
+     * @return Subscription identifier, 0 on failure (no valid handle)
+     *
+     * Unlike the signalUpdated()/signalsUpdated() broadcasts, a change only
+     * reaches the callbacks subscribed to that signal, through a direct
+     * call. Callbacks run on the updating thread, after the hub lock has
+     * been released, and follow the same delivery rules as the broadcasts:
+     * immediate per update, or once per publishChanges() when coalescing.
+     * Stale transitions are delivered as well.
+     *
+     * The subscriber must unsubscribe before the callback target is
+     * destroyed.
+     */
+    SubscriptionId subscribe(const QVector<SignalHandle>& handles, SignalCallback callback);
+
+    /**
+     * @brief Subscribe to changes of a single signal
+     */
+    SubscriptionId subscribe(SignalHandle handle, SignalCallback callback);
+
+    /**
+     * @brief Subscribe to changes of signals given by identifier
+     *
+     * Unknown identifiers are skipped with a warning.
+     */
+    SubscriptionId subscribe(const QStringList& signalIds, SignalCallback callback);
+
+    /**
+     * @brief Remove a subscription (no-op for an unknown identifier)
+     */
+    void unsubscribe(SubscriptionId id);
+
     /**
      * @brief Get list of all registered signal IDs
+     *
+     * The list index of each ID equals its handle index.
      */
     QStringList registeredSignals() const;
 
+    /**
+     * @brief Get number of registered signals
+     */
+    int signalCount() const;
+
     /**
      * @brief Check if hub is in degraded mode
      *
@@ -138,6 +490,86 @@ public:
      */
     int invalidSignalCount() const;
 
+    /**
+     * @brief Capture every input into a trace recorder
+     * @param recorder Recorder (not owned, must outlive the attachment),
+     *                 nullptr to detach
+     *
+     * Records single and batched updates (including producer input) as they
+     * are committed, and a tick marker per processTick(). Recording runs
+     * under the writer lock and only appends to the recorder's buffer.
+     */
+    void setTraceRecorder(SignalTraceRecorder* recorder);
+
+    /**
+     * @brief Drive the hub clock externally
+     * @param timeMs Time used for freshness, rate-of-change and publish
+     *               interval decisions; negative restores the internal timer
+     *
+     * Used by SignalTraceReplayer so a replayed trace sees the recorded
+     * timing regardless of replay speed.
+     */
+    void setClockOverride(qint64 timeMs);
+
+    /**
+     * @brief Current hub time in ms (the override while one is set)
+     */
+    qint64 monotonicTimeMs() const;
+
+    /**
+     * @brief Publish the value table into a shared-memory segment
+     * @param key Segment name (see SignalHubMirror::DEFAULT_KEY)
+     * @param error Set on failure
+     * @return false if already exported or the segment cannot be created
+     *
+     * From then on every publish also stores into the segment's seqlock
+     * slots, so SignalHubMirror readers in other processes see the same
+     * values as getSignal() without any IPC message. processTick() stamps
+     * the segment's heartbeat. Like the first update, exporting seals
+     * registration; the segment is marked closed when the hub is destroyed.
+     */
+    bool exportSharedMirror(const QString& key, QString* error = nullptr);
+
+    /**
+     * @brief Enable or disable per-signal telemetry (disabled by default)
+     *
+     * When enabled, every commit updates the signal's rate, inter-arrival
+     * jitter and source-to-commit latency, and every delivery records the
+     * commit-to-consumer latency of the delivered value. Counters are
+     * relaxed atomics sized at registration; nothing allocates.
+     *
+     * Source latency is only meaningful when sources stamp updates with
+     * the hub clock (monotonicTimeMs()); timestamps of 0 or from the
+     * future are not counted.
+     */
+    void setTelemetryEnabled(bool enabled);
+    bool isTelemetryEnabled() const;
+
+    /**
+     * @brief Telemetry of one signal
+     */
+    SignalTelemetryStats signalTelemetry(SignalHandle handle) const;
+
+    /**
+     * @brief Clear all telemetry counters
+     */
+    void resetTelemetry();
+
+    /**
+     * @brief Hub health and, if enabled, per-signal telemetry
+     *
+     * Keys: signalCount, invalidSignals, degradedMode, snapshotEpoch,
+     * producerDropped, telemetryEnabled and, with telemetry, "signals": a
+     * list of per-signal maps ordered by update rate, highest first.
+     */
+    Q_INVOKABLE QVariantMap getDiagnostics() const;
+
+    /**
+     * @brief Human-readable telemetry table, ordered by update rate
+     * @param maxSignals Rows to include (0 = all)
+     */
+    QString telemetryReport(int maxSignals = 0) const;
+
 signals:
     /**
      * @brief Emitted when a signal value changes
@@ -156,6 +588,14 @@ signals:
                                SignalValidity oldValidity,
                                SignalValidity newValidity);
 
+    /**
+     * @brief Emitted once per committed batch (see updateSignals()) and once
+     *        per coalesced publish (see publishChanges())
+     * @param changes Committed changes in batch/handle order; validity
+     *                transitions are reported through SignalChange::oldValidity
+     */
+    void signalsUpdated(const QVector<SignalChange>& changes);
+
     /**
      * @brief Emitted when degraded mode state changes
      * @param degraded true if entering degraded mode
@@ -163,29 +603,215 @@ signals:
     void degradedModeChanged(bool degraded);
 
 private:
+    struct Subscriber {
+        SubscriptionId id{0};
+        SignalCallback callback;
+    };
+
+    // Per-signal subscriber lists indexed by SignalHandle::index. Replaced
+    // copy-on-write on (un)subscribe so delivery never holds a lock.
+    using SubscriberTable = QVector<QVector<Subscriber>>;
+
     struct SignalState {
         SignalDefinition definition;
         SignalValue current;
-        QVariant previousValue;
+        ScalarValue previousValue;
         qint64 previousTimestampMs{0};
+
+        // Validity at the last coalesced publish (valid while dirty)
+        SignalValidity pendingOldValidity{SignalValidity::NotAvailable};
+
+        // Optional trend history (allocated at registration)
+        SignalHistory history;
+
+        // Change suppression state (see SignalDefinition deadband fields)
+        bool changeFilter{false};             ///< Any suppression field set
+        bool notified{false};                 ///< A change has been notified
+        bool held{false};                     ///< Change withheld by the publish interval
+        double notifiedValue{0.0};            ///< Quantized value last notified
+        qint64 notifiedAtMs{0};               ///< Time of the last notification
+
+        // Derivation (see deriveSignal())
+        int derivedSlot{-1};                  ///< Index into m_derived, -1 = raw signal
+        QVector<uint32_t> dependents;         ///< Derived signals using this one as input
+
+        // Valid values since the last tick, kept while an aggregating view uses the signal
+        int viewAggregators{0};
+        ViewAccumulator viewTick;
+    };
+
+    /**
+     * @brief Inputs and compute function of a derived signal
+     */
+    struct DerivedSignal {
+        uint32_t index{0};                    ///< Signal index of the target
+        QVector<SignalHandle> inputs;
+        DerivedSignalFunction compute;
+        QVector<SignalValue> inputValues;     ///< Inputs at the last evaluation
+        bool evaluated{false};
+    };
+
+    /**
+     * @brief Update input after conversion to the signal's kind
+     */
+    struct TypedInput {
+        ScalarValue scalar;
+        QString text;
+        bool convertible{true};
+    };
+
+    /**
+     * @brief Range/rate decisions precomputed by the batch kernel
+     */
+    struct NumericCheck {
+        double clampedValue{0.0};
+        bool outOfRange{false};
+        bool rateViolation{false};
+    };
+
+    /**
+     * @brief Batch entry staged for validation and commit
+     */
+    struct PendingUpdate {
+        SignalHandle handle;
+        TypedInput input;
+        qint64 sourceTimestampMs{0};
+        int lane{-1};                         ///< Kernel lane, -1 = scalar path
+    };
+
+    // Struct-of-arrays scratch for the validation kernel. Sized at
+    // registration (one lane per signal) and reused for every batch.
+    struct ValidationScratch {
+        QVector<double> values;
+        QVector<double> minValues;
+        QVector<double> maxValues;
+        QVector<double> previousValues;
+        QVector<double> maxRates;
+        QVector<double> deltaTimesMs;
+        QVector<double> clampedValues;
+        QVector<quint64> outOfRange;
+        QVector<quint64> rateViolation;
+        QVector<quint32> seenStamp;           ///< Per signal, == stamp if in segment
+        quint32 stamp{0};
     };
 
-    bool validateRange(const SignalDefinition& def, const QVariant& value) const;
+    SignalValue readPublished(SignalHandle handle) const;
+    void publish(SignalHandle handle, const SignalValue& value);
+    void publishSlot(uint32_t index, const SignalValue& value);
+
+    bool isSealed() const { return m_initialized.load(std::memory_order_acquire); }
+
+    TypedInput typedInput(const SignalState& state, const ScalarValue& value) const;
+    bool commitUpdate(SignalHandle handle,
+                      const TypedInput& input,
+                      qint64 sourceTimestampMs,
+                      QMutexLocker<QMutex>& locker);
+    SignalChange applyUpdate(SignalHandle handle,
+                             const TypedInput& input,
+                             qint64 sourceTimestampMs,
+                             qint64 currentTimeMs,
+                             const NumericCheck* check = nullptr);
+    int commitPending(qint64 currentTimeMs, QVector<SignalChange>& changes);
+    int prevalidateSegment(int begin, qint64 currentTimeMs);
+    bool updateDegradedMode();
+    void collectChange(SignalChange&& change, QVector<SignalChange>& changes);
+    void finishBatch(const QVector<SignalChange>& changes, QMutexLocker<QMutex>& locker);
+    void recordPending(qint64 currentTimeMs);
+    bool passesChangeFilter(SignalState& state, const SignalChange& change,
+                            qint64 currentTimeMs);
+    int publishHeldChanges();
+    void markDirty(uint32_t index, SignalValidity oldValidity);
+    void markDependentsDirty(const SignalState& state);
+    bool sortDerivedSignals();
+    bool propagateValidity(uint32_t index, SignalValidity validity, SignalChange& change);
+    int serviceViews();
+    int publishPending();
+    std::shared_ptr<const SubscriberTable> subscriberTable() const;
+    void deliver(const SignalChange& change) const;
+    void deliver(const QVector<SignalChange>& changes) const;
+    bool validateRange(uint32_t index, double value) const;
     bool validateRateOfChange(const SignalState& state,
-                              const QVariant& newValue,
+                              double newValue,
                               qint64 currentTimeMs) const;
-    QVariant clampValue(const SignalDefinition& def, const QVariant& value) const;
+    ScalarValue clampValue(uint32_t index, const ScalarValue& value) const;
     qint64 currentMonotonicTimeMs() const;
+    qint64 telemetryTimeUs() const { return m_monotonicTimer.nsecsElapsed() / 1000; }
+    void recordNotification(const SignalChange& change, qint64 nowUs) const;
+    QVector<uint32_t> signalsByRate(QVector<SignalTelemetryStats>& stats) const;
+
+    bool isValidHandle(SignalHandle handle) const {
+        return handle.index < static_cast<uint32_t>(m_signals.size());
+    }
+
+    mutable QMutex m_mutex;                   ///< Serializes writers and registration
+
+    // Images backing the strings of image-registered signals; declared
+    // before the tables below so it is destroyed after them
+    QVector<std::shared_ptr<const SignalCatalogImage>> m_catalogImages;
+
+    // Flat signal table indexed by SignalHandle::index. Sized during
+    // registration only (no dynamic alloc in steady-state); immutable in
+    // shape once sealed, which is what makes the lock-free reads safe.
+    QVector<SignalState> m_signals;
+    QHash<QString, SignalHandle> m_handles;   ///< String ID lookup shim
+    QStringList m_signalIds;                  ///< IDs in handle order
+
+    // Range limits per signal, converted once at registration
+    QVector<double> m_minValues;              ///< -inf when unbounded
+    QVector<double> m_maxValues;              ///< +inf when unbounded
+
+    // Reader-facing copies of SignalState::current
+    std::vector<SignalSlot> m_published;      ///< Seqlock slot per signal
+    QVector<QString> m_publishedText;         ///< String-kind text per signal
+    mutable QMutex m_textMutex;               ///< Guards m_publishedText only
+
+    FreshnessQueue m_freshness;               ///< Expiry deadlines of Valid signals
+
+    // Producer ingestion rings (list guarded by m_mutex)
+    std::vector<std::unique_ptr<SignalProducer>> m_producers;
+
+    // Rate-limited consumer views (list and state guarded by m_mutex)
+    std::vector<std::shared_ptr<SignalView>> m_views;
+
+    // Targeted subscriptions
+    mutable QMutex m_subscriberMutex;         ///< Guards table swap and id counter
+    std::shared_ptr<const SubscriberTable> m_subscribers;
+    SubscriptionId m_nextSubscriptionId{1};
+
+    // Coalescing state (guarded by m_mutex)
+    bool m_coalescing{false};
+    QVector<quint64> m_dirtyBits;             ///< One bit per signal index
+    int m_dirtyCount{0};
+
+    QVector<uint32_t> m_heldSignals;          ///< Indices with a held change (guarded by m_mutex)
+
+    // Derived signals (shape fixed at seal, state guarded by m_mutex)
+    QVector<DerivedSignal> m_derived;
+    QVector<int> m_derivedOrder;              ///< Slots in dependency order
+    QVector<quint64> m_derivedDirty;          ///< One bit per slot, an input changed
+    bool m_derivedPending{false};             ///< Any dirty bit set
+
+    // Snapshot rotation: current, possibly still pinned, being filled
+    static constexpr int SNAPSHOT_BUFFERS = 3;
+    mutable std::array<SnapshotBuffer, SNAPSHOT_BUFFERS> m_snapshots;  ///< Pins mutate on read
+    std::atomic<int> m_currentSnapshot{-1};   ///< Index into m_snapshots, -1 = none
+    quint64 m_snapshotEpoch{0};               ///< Guarded by m_mutex
+
+    // Batch validation state (guarded by m_mutex)
+    QVector<PendingUpdate> m_pending;         ///< Capacity kept across batches
+    ValidationScratch m_scratch;
 
-    mutable QMutex m_mutex;
-    QHash<QString, SignalState> m_signals;
     QElapsedTimer m_monotonicTimer;
-    bool m_degradedMode{false};
-    int m_invalidCount{0};
+    std::atomic<qint64> m_clockOverrideMs{-1};  ///< Negative = use m_monotonicTimer
+    SignalTraceRecorder* m_traceRecorder{nullptr};  ///< Guarded by m_mutex
+    std::unique_ptr<SignalMirrorWriter> m_mirror;   ///< Shared-memory export (guarded by m_mutex)
 
-    // Pre-allocated list for freshness checking (no dynamic alloc in steady-state)
-    QStringList m_signalIdCache;
-    bool m_initialized{false};
+    // Per-signal telemetry, sized at registration (mutable: delivery is const)
+    std::atomic<bool> m_telemetryEnabled{false};
+    mutable std::vector<SignalTelemetry> m_telemetry;
+    std::atomic<bool> m_degradedMode{false};
+    std::atomic<int> m_invalidCount{0};
+    std::atomic<bool> m_initialized{false};   ///< Set (sealed) on first update
 };
 
 } // namespace signal
@@ -0,0 +1,338 @@
+// SignalHubMirror.cpp
+// Shared-memory signal table implementation
+
+#include "signal/SignalHubMirror.h"
+#include <QDebug>
+#include <cstring>
+#include <new>
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+uint32_t alignUp(uint32_t offset)
+{
+    return (offset + MirrorFormat::ALIGNMENT - 1) & ~(MirrorFormat::ALIGNMENT - 1);
+}
+
+void setError(QString* error, const QString& message)
+{
+    if (error) {
+        *error = message;
+    }
+}
+
+void cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// MirrorTextSlot
+// ============================================================================
+
+void MirrorTextSlot::store(const QString& text)
+{
+    const QByteArray utf8 = text.toUtf8();
+    int length = qMin(static_cast<int>(utf8.size()), CAPACITY);
+    if (length < utf8.size()) {
+        // Do not split a multi-byte character
+        while (length > 0 && (static_cast<uchar>(utf8.at(length)) & 0xC0) == 0x80) {
+            --length;
+        }
+    }
+
+    uint64_t words[CAPACITY / 8] = {};
+    std::memcpy(words, utf8.constData(), static_cast<size_t>(length));
+
+    const uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    this->length.store(static_cast<uint32_t>(length), std::memory_order_relaxed);
+    for (int i = 0; i < CAPACITY / 8; ++i) {
+        this->words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+bool MirrorTextSlot::load(QString& text, int maxAttempts) const
+{
+    uint64_t copy[CAPACITY / 8];
+    uint32_t size = 0;
+
+    for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+        const uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1u) {
+            cpuRelax();
+            continue;
+        }
+
+        size = length.load(std::memory_order_relaxed);
+        for (int i = 0; i < CAPACITY / 8; ++i) {
+            copy[i] = words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            text = QString::fromUtf8(reinterpret_cast<const char*>(copy),
+                                     static_cast<qsizetype>(qMin<uint32_t>(size, CAPACITY)));
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// SignalMirrorWriter
+// ============================================================================
+
+SignalMirrorWriter::~SignalMirrorWriter()
+{
+    if (m_header) {
+        m_header->state.store(MirrorFormat::Closed, std::memory_order_release);
+    }
+}
+
+bool SignalMirrorWriter::create(const QString& key, const QStringList& signalIds,
+                                const QVector<SignalKind>& kinds, QString* error)
+{
+    const int count = signalIds.size();
+    QByteArray ids;
+    QVector<MirrorSignalEntry> entries(count);
+    m_textSlotOf.fill(-1, count);
+    int32_t textSlots = 0;
+
+    for (int i = 0; i < count; ++i) {
+        const QByteArray id = signalIds.at(i).toUtf8();
+        MirrorSignalEntry& entry = entries[i];
+        entry.idOffset = static_cast<uint32_t>(ids.size());
+        entry.idLength = static_cast<uint16_t>(qMin<qsizetype>(id.size(), 0xFFFF));
+        entry.kind = static_cast<uint8_t>(kinds.at(i));
+        entry.reserved = 0;
+        entry.textSlot = kinds.at(i) == SignalKind::String ? textSlots++ : -1;
+        m_textSlotOf[i] = entry.textSlot;
+        ids.append(id.constData(), entry.idLength);
+    }
+
+    const uint32_t entriesOffset = sizeof(MirrorHeader);
+    const uint32_t idsOffset = entriesOffset + static_cast<uint32_t>(count * sizeof(MirrorSignalEntry));
+    const uint32_t slotsOffset = alignUp(idsOffset + static_cast<uint32_t>(ids.size()));
+    const uint32_t textSlotsOffset = alignUp(slotsOffset +
+                                             static_cast<uint32_t>(count * sizeof(SignalSlot)));
+    const uint32_t totalSize = textSlotsOffset +
+                               static_cast<uint32_t>(textSlots * sizeof(MirrorTextSlot));
+
+    m_memory.setKey(key);
+    if (!m_memory.create(static_cast<qsizetype>(totalSize))) {
+        if (m_memory.error() != QSharedMemory::AlreadyExists) {
+            setError(error, m_memory.errorString());
+            return false;
+        }
+        // Left behind by a writer that did not shut down: reclaim it
+        if (m_memory.attach()) {
+            m_memory.detach();
+        }
+        if (!m_memory.create(static_cast<qsizetype>(totalSize))) {
+            setError(error, m_memory.errorString());
+            return false;
+        }
+    }
+
+    char* base = static_cast<char*>(m_memory.data());
+    std::memset(base, 0, totalSize);
+
+    m_header = new (base) MirrorHeader;
+    std::memcpy(m_header->magic, MirrorFormat::MAGIC, sizeof(m_header->magic));
+    m_header->formatVersion = MirrorFormat::VERSION;
+    m_header->headerSize = sizeof(MirrorHeader);
+    m_header->signalCount = static_cast<uint32_t>(count);
+    m_header->entrySize = sizeof(MirrorSignalEntry);
+    m_header->slotSize = sizeof(SignalSlot);
+    m_header->textSlotSize = sizeof(MirrorTextSlot);
+    m_header->textSlotCount = static_cast<uint32_t>(textSlots);
+    m_header->idsOffset = idsOffset;
+    m_header->slotsOffset = slotsOffset;
+    m_header->textSlotsOffset = textSlotsOffset;
+    m_header->totalSize = totalSize;
+    m_header->state.store(MirrorFormat::Initializing, std::memory_order_relaxed);
+    m_header->heartbeatMs.store(0, std::memory_order_relaxed);
+
+    if (count > 0) {
+        std::memcpy(base + entriesOffset, entries.constData(),
+                    static_cast<size_t>(count) * sizeof(MirrorSignalEntry));
+    }
+    std::memcpy(base + idsOffset, ids.constData(), static_cast<size_t>(ids.size()));
+
+    m_slots = reinterpret_cast<SignalSlot*>(base + slotsOffset);
+    for (int i = 0; i < count; ++i) {
+        new (&m_slots[i]) SignalSlot;
+    }
+    m_textSlots = reinterpret_cast<MirrorTextSlot*>(base + textSlotsOffset);
+    for (int32_t i = 0; i < textSlots; ++i) {
+        new (&m_textSlots[i]) MirrorTextSlot;  // Zeroed above
+    }
+    return true;
+}
+
+void SignalMirrorWriter::storeText(uint32_t index, const QString& text)
+{
+    const int32_t slot = m_textSlotOf.at(static_cast<int>(index));
+    if (slot >= 0) {
+        m_textSlots[slot].store(text);
+    }
+}
+
+void SignalMirrorWriter::setHeartbeat(qint64 timeMs)
+{
+    m_header->heartbeatMs.store(timeMs, std::memory_order_release);
+}
+
+void SignalMirrorWriter::setReady()
+{
+    m_header->state.store(MirrorFormat::Ready, std::memory_order_release);
+}
+
+// ============================================================================
+// SignalHubMirror
+// ============================================================================
+
+SignalHubMirror::~SignalHubMirror()
+{
+    detach();
+}
+
+bool SignalHubMirror::attach(const QString& key, QString* error)
+{
+    detach();
+
+    m_memory.setKey(key);
+    if (!m_memory.attach(QSharedMemory::ReadOnly)) {
+        setError(error, m_memory.errorString());
+        return false;
+    }
+
+    const char* base = static_cast<const char*>(m_memory.constData());
+    const qsizetype size = m_memory.size();
+    const auto* header = reinterpret_cast<const MirrorHeader*>(base);
+
+    QString problem;
+    if (size < static_cast<qsizetype>(sizeof(MirrorHeader)) ||
+        std::memcmp(header->magic, MirrorFormat::MAGIC, sizeof(header->magic)) != 0) {
+        problem = QStringLiteral("Not a signal mirror segment");
+    } else if (header->formatVersion != MirrorFormat::VERSION ||
+               header->headerSize != sizeof(MirrorHeader) ||
+               header->entrySize != sizeof(MirrorSignalEntry) ||
+               header->slotSize != sizeof(SignalSlot) ||
+               header->textSlotSize != sizeof(MirrorTextSlot)) {
+        problem = QStringLiteral("Incompatible signal mirror layout");
+    } else if (header->state.load(std::memory_order_acquire) == MirrorFormat::Initializing) {
+        problem = QStringLiteral("Signal mirror is not ready");
+    } else if (static_cast<qsizetype>(header->totalSize) > size ||
+               header->slotsOffset + static_cast<qsizetype>(header->signalCount) *
+                   static_cast<qsizetype>(sizeof(SignalSlot)) > header->totalSize ||
+               header->textSlotsOffset + static_cast<qsizetype>(header->textSlotCount) *
+                   static_cast<qsizetype>(sizeof(MirrorTextSlot)) > header->totalSize ||
+               header->idsOffset > header->slotsOffset) {
+        problem = QStringLiteral("Truncated signal mirror segment");
+    }
+
+    const auto* entries = reinterpret_cast<const MirrorSignalEntry*>(base + sizeof(MirrorHeader));
+    const int count = problem.isEmpty() ? static_cast<int>(header->signalCount) : 0;
+    m_signalIds.reserve(count);
+    m_textSlotOf.reserve(count);
+    for (int i = 0; i < count && problem.isEmpty(); ++i) {
+        const MirrorSignalEntry& entry = entries[i];
+        if (header->idsOffset + entry.idOffset + entry.idLength > header->slotsOffset ||
+            entry.textSlot >= static_cast<int32_t>(header->textSlotCount)) {
+            problem = QStringLiteral("Corrupt signal mirror entry %1").arg(i);
+            break;
+        }
+        const QString id = QString::fromUtf8(base + header->idsOffset + entry.idOffset,
+                                             entry.idLength);
+        m_signalIds.append(id);
+        m_handles.insert(id, SignalHandle(static_cast<uint32_t>(i)));
+        m_textSlotOf.append(entry.textSlot);
+    }
+
+    if (!problem.isEmpty()) {
+        setError(error, problem);
+        qWarning() << "SignalHubMirror:" << problem;
+        detach();
+        return false;
+    }
+
+    m_header = header;
+    m_slots = reinterpret_cast<const SignalSlot*>(base + header->slotsOffset);
+    m_textSlots = reinterpret_cast<const MirrorTextSlot*>(base + header->textSlotsOffset);
+    return true;
+}
+
+void SignalHubMirror::detach()
+{
+    m_header = nullptr;
+    m_slots = nullptr;
+    m_textSlots = nullptr;
+    m_textSlotOf.clear();
+    m_signalIds.clear();
+    m_handles.clear();
+    if (m_memory.isAttached()) {
+        m_memory.detach();
+    }
+}
+
+bool SignalHubMirror::isWriterOpen() const
+{
+    return m_header && m_header->state.load(std::memory_order_acquire) == MirrorFormat::Ready;
+}
+
+qint64 SignalHubMirror::heartbeatMs() const
+{
+    return m_header ? m_header->heartbeatMs.load(std::memory_order_acquire) : 0;
+}
+
+SignalValue SignalHubMirror::getSignal(SignalHandle handle) const
+{
+    SignalValue invalid;
+    invalid.validity = SignalValidity::NotAvailable;
+    if (!m_header || handle.index >= static_cast<uint32_t>(m_signalIds.size())) {
+        return invalid;
+    }
+
+    // The writer stores text before the slot, so this text is at least as new
+    SignalValue value;
+    if (!m_slots[handle.index].tryLoad(value, READ_ATTEMPTS)) {
+        return invalid;
+    }
+    const int32_t textSlot = m_textSlotOf.at(static_cast<int>(handle.index));
+    if (textSlot >= 0 && !m_textSlots[textSlot].load(value.text, READ_ATTEMPTS)) {
+        return invalid;
+    }
+    return value;
+}
+
+SignalValue SignalHubMirror::getSignal(const QString& signalId) const
+{
+    return getSignal(signalHandle(signalId));
+}
+
+SignalValidity SignalHubMirror::signalValidity(SignalHandle handle) const
+{
+    if (!m_header || handle.index >= static_cast<uint32_t>(m_signalIds.size())) {
+        return SignalValidity::NotAvailable;
+    }
+    SignalValidity validity = SignalValidity::NotAvailable;
+    m_slots[handle.index].tryValidity(validity, READ_ATTEMPTS);
+    return validity;
+}
+
+} // namespace signal
+} // namespace automotive
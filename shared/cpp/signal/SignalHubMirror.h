@@ -0,0 +1,210 @@
+// SignalHubMirror.h
+// Shared-memory copy of the SignalHub value table for same-SoC processes
+// Part of: Shared Platform Layer
+// Safety: Readers never block the hub; the segment is written by the hub only
+
+#ifndef AUTOMOTIVE_SIGNAL_HUB_MIRROR_H
+#define AUTOMOTIVE_SIGNAL_HUB_MIRROR_H
+
+#include "signal/SignalTypes.h"
+#include "signal/SignalSlot.h"
+#include <QHash>
+#include <QSharedMemory>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Segment layout
+ *
+ * [header][entries: signalCount x MirrorSignalEntry][UTF-8 id table]
+ * [slots: signalCount x SignalSlot][text slots: textSlotCount x MirrorTextSlot]
+ *
+ * Slot tables start on a cache line. Host byte order and layout: the
+ * segment is only shared between processes of the same build on one SoC,
+ * which the format version and the recorded slot sizes guard.
+ */
+namespace MirrorFormat {
+    constexpr char MAGIC[4] = {'A', 'S', 'H', 'M'};
+    constexpr uint16_t VERSION = 1;
+    constexpr uint32_t ALIGNMENT = 64;
+
+    enum State : uint32_t {
+        Initializing = 0,
+        Ready = 1,
+        Closed = 2                     ///< Hub destroyed; values are final
+    };
+}
+
+struct MirrorHeader {
+    char magic[4];                     ///< MirrorFormat::MAGIC
+    uint16_t formatVersion;            ///< MirrorFormat::VERSION
+    uint16_t headerSize;               ///< sizeof(MirrorHeader)
+    uint32_t signalCount;
+    uint32_t entrySize;                ///< sizeof(MirrorSignalEntry)
+    uint32_t slotSize;                 ///< sizeof(SignalSlot)
+    uint32_t textSlotSize;             ///< sizeof(MirrorTextSlot)
+    uint32_t textSlotCount;            ///< Number of String-kind signals
+    uint32_t idsOffset;                ///< Byte offset of the id table
+    uint32_t slotsOffset;              ///< Byte offset of the value slots
+    uint32_t textSlotsOffset;          ///< Byte offset of the text slots
+    uint32_t totalSize;                ///< Bytes used by the segment
+    uint32_t reserved;
+    std::atomic<uint32_t> state;       ///< MirrorFormat::State
+    uint32_t reserved2;
+    std::atomic<qint64> heartbeatMs;   ///< Hub time of the last processTick()
+};
+
+struct MirrorSignalEntry {
+    uint32_t idOffset;                 ///< Into the id table
+    uint16_t idLength;                 ///< UTF-8 bytes
+    uint8_t kind;                      ///< SignalKind
+    uint8_t reserved;
+    int32_t textSlot;                  ///< Index into the text slots, -1 = none
+};
+
+/**
+ * @brief Seqlock-protected text of a String-kind signal
+ *
+ * Text longer than CAPACITY bytes of UTF-8 is truncated at a character
+ * boundary. The bytes are kept in relaxed atomic words, as in SignalSlot.
+ */
+struct MirrorTextSlot {
+    static constexpr int CAPACITY = 56;
+
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> length;
+    std::atomic<uint64_t> words[CAPACITY / 8];
+
+    void store(const QString& text);
+
+    /**
+     * @brief Read a consistent copy, giving up after @p maxAttempts tries
+     * @return false (@p text untouched) if the sequence never settled
+     */
+    bool load(QString& text, int maxAttempts) const;
+};
+
+static_assert(std::is_standard_layout<MirrorHeader>::value, "Header must be standard layout");
+static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<qint64>::is_always_lock_free,
+              "Shared atomics must be lock-free (address-free)");
+static_assert(sizeof(MirrorTextSlot) == 64, "Text slot is one cache line");
+
+/**
+ * @brief Writer side of a mirror segment (owned by SignalHub)
+ *
+ * The segment is a QSharedMemory (POSIX or System V shared memory,
+ * whichever the Qt build uses), so only the key has to be agreed on.
+ * Store calls are externally serialized by the hub's writer lock.
+ * See SignalHub::exportSharedMirror().
+ */
+class SignalMirrorWriter {
+public:
+    SignalMirrorWriter() = default;
+    ~SignalMirrorWriter();
+
+    SignalMirrorWriter(const SignalMirrorWriter&) = delete;
+    SignalMirrorWriter& operator=(const SignalMirrorWriter&) = delete;
+
+    /**
+     * @brief Create the segment @p key sized for the given signal table
+     *
+     * A segment left behind by a crashed writer under the same key is
+     * replaced. The segment is Initializing until setReady().
+     */
+    bool create(const QString& key, const QStringList& signalIds,
+                const QVector<SignalKind>& kinds, QString* error = nullptr);
+
+    void store(uint32_t index, const SignalValue& value) { m_slots[index].store(value); }
+    void storeText(uint32_t index, const QString& text);
+    void setHeartbeat(qint64 timeMs);
+    void setReady();
+
+private:
+    QSharedMemory m_memory;
+    MirrorHeader* m_header{nullptr};
+    SignalSlot* m_slots{nullptr};
+    MirrorTextSlot* m_textSlots{nullptr};
+    QVector<int32_t> m_textSlotOf;     ///< Per signal, -1 = not String kind
+};
+
+/**
+ * @brief Read-only view of a hub's signal table from another process
+ *
+ * Attaches to the segment published by SignalHub::exportSharedMirror().
+ * Reads are lock-free seqlock copies straight out of shared memory: no
+ * message, syscall or serialization per read. Handles are those of the
+ * exporting hub; resolve them once with signalHandle().
+ *
+ * The mirror only carries values and validity. Freshness is decided by
+ * the hub, so a hub that stops ticking leaves its last validity in place;
+ * consumers that care compare heartbeatMs() across their own ticks.
+ *
+ * Reads retry a slot at most READ_ATTEMPTS times. A hub process that dies
+ * in the middle of a store leaves that slot's sequence odd; the signal
+ * then reads as NotAvailable instead of hanging the reader.
+ */
+class SignalHubMirror {
+public:
+    static constexpr const char* DEFAULT_KEY = "automotive.signalhub";
+    static constexpr int READ_ATTEMPTS = 64 * 1024;    ///< Seqlock retries per slot read (a count, not a time bound)
+
+    SignalHubMirror() = default;
+    ~SignalHubMirror();
+
+    SignalHubMirror(const SignalHubMirror&) = delete;
+    SignalHubMirror& operator=(const SignalHubMirror&) = delete;
+
+    /**
+     * @brief Attach read-only to the segment @p key
+     * @return false (with @p error set) if it does not exist, is not ready
+     *         yet, or has an incompatible layout
+     */
+    bool attach(const QString& key = QString::fromLatin1(DEFAULT_KEY), QString* error = nullptr);
+    void detach();
+    bool isAttached() const { return m_header != nullptr; }
+
+    /**
+     * @brief False once the exporting hub has been destroyed
+     */
+    bool isWriterOpen() const;
+
+    /**
+     * @brief Hub time of the exporting hub's last tick (0 before the first)
+     */
+    qint64 heartbeatMs() const;
+
+    int signalCount() const { return static_cast<int>(m_signalIds.size()); }
+    const QStringList& signalIds() const { return m_signalIds; }
+    SignalHandle signalHandle(const QString& signalId) const { return m_handles.value(signalId); }
+
+    /**
+     * @brief Current value (lock-free); NotAvailable for an unknown handle
+     *        or a slot whose writer never finished its store
+     */
+    SignalValue getSignal(SignalHandle handle) const;
+    SignalValue getSignal(const QString& signalId) const;
+    SignalValidity signalValidity(SignalHandle handle) const;
+
+private:
+    QSharedMemory m_memory;
+    const MirrorHeader* m_header{nullptr};
+    const SignalSlot* m_slots{nullptr};
+    const MirrorTextSlot* m_textSlots{nullptr};
+    QVector<int32_t> m_textSlotOf;
+    QStringList m_signalIds;
+    QHash<QString, SignalHandle> m_handles;
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_HUB_MIRROR_H
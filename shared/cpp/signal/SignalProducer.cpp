@@ -0,0 +1,78 @@
+// SignalProducer.cpp
+// Wait-free per-producer ingestion ring implementation
+
+#include "signal/SignalProducer.h"
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+uint32_t roundUpToPowerOfTwo(int value)
+{
+    uint32_t capacity = 2;
+    while (capacity < static_cast<uint32_t>(value) && capacity < (1u << 30)) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+} // namespace
+
+SignalProducer::SignalProducer(const QString& name, int capacity)
+    : m_name(name)
+    , m_mask(roundUpToPowerOfTwo(capacity) - 1)
+    , m_records(new IngestRecord[m_mask + 1])
+{
+}
+
+bool SignalProducer::push(SignalHandle handle, const ScalarValue& value,
+                          qint64 sourceTimestampMs)
+{
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+
+    // Indices run freely; (tail - head) is the fill level
+    if (tail - m_cachedHead > m_mask) {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (tail - m_cachedHead > m_mask) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    IngestRecord& record = m_records[tail & m_mask];
+    record.handle = handle;
+    record.value = value;
+    record.sourceTimestampMs = sourceTimestampMs;
+
+    m_tail.store(tail + 1, std::memory_order_release);
+    m_pushed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool SignalProducer::pop(IngestRecord& record)
+{
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    record = m_records[head & m_mask];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+ProducerStats SignalProducer::stats() const
+{
+    ProducerStats stats;
+    stats.name = m_name;
+    stats.capacity = capacity();
+    stats.pending = static_cast<int>(m_tail.load(std::memory_order_acquire) -
+                                     m_head.load(std::memory_order_acquire));
+    stats.pushed = m_pushed.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace signal
+} // namespace automotive
@@ -0,0 +1,92 @@
+// SignalProducer.h
+// Wait-free per-producer ingestion ring for SignalHub
+// Part of: Shared Platform Layer
+// Safety: Bounded, allocation-free producer path
+
+#ifndef AUTOMOTIVE_SIGNAL_PRODUCER_H
+#define AUTOMOTIVE_SIGNAL_PRODUCER_H
+
+#include "signal/SignalTypes.h"
+#include <QString>
+#include <atomic>
+#include <memory>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Fixed-size update record carried by a producer ring
+ */
+struct IngestRecord {
+    SignalHandle handle;               ///< Target signal
+    ScalarValue value;                 ///< New value (formatted for String kinds)
+    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp (if available)
+};
+
+/**
+ * @brief Ingestion counters of one producer
+ */
+struct ProducerStats {
+    QString name;                      ///< Producer name given at creation
+    int capacity{0};                   ///< Ring capacity in records
+    int pending{0};                    ///< Records waiting for the next drain
+    quint64 pushed{0};                 ///< Records accepted into the ring
+    quint64 dropped{0};                ///< Records rejected because the ring was full
+};
+
+/**
+ * @brief Single-producer/single-consumer ring of signal updates
+ *
+ * Created by SignalHub::createProducer() for one source thread (CAN reader,
+ * IPC channel, simulation). push() is wait-free and never allocates; when
+ * the ring is full the record is dropped and counted. The hub is the only
+ * consumer and drains the ring on its scheduler tick, so no Qt event is
+ * posted per signal.
+ *
+ * push() must only be called from one thread at a time.
+ */
+class SignalProducer {
+public:
+    SignalProducer(const QString& name, int capacity);
+
+    SignalProducer(const SignalProducer&) = delete;
+    SignalProducer& operator=(const SignalProducer&) = delete;
+
+    /**
+     * @brief Queue an update (producer thread)
+     * @return false if the ring is full (update dropped and counted)
+     */
+    bool push(SignalHandle handle, const ScalarValue& value, qint64 sourceTimestampMs = 0);
+
+    /**
+     * @brief Take the oldest queued record (hub only)
+     * @return false if the ring is empty
+     */
+    bool pop(IngestRecord& record);
+
+    /**
+     * @brief Snapshot of the producer counters
+     */
+    ProducerStats stats() const;
+
+    const QString& name() const { return m_name; }
+    int capacity() const { return static_cast<int>(m_mask + 1); }
+
+private:
+    const QString m_name;
+    const uint32_t m_mask;                     ///< Capacity - 1 (power of two)
+    std::unique_ptr<IngestRecord[]> m_records;
+
+    // Producer- and consumer-owned indices on separate cache lines
+    alignas(64) std::atomic<uint32_t> m_tail{0};   ///< Next write (producer)
+    uint32_t m_cachedHead{0};                      ///< Producer's view of m_head
+    std::atomic<quint64> m_pushed{0};
+    std::atomic<quint64> m_dropped{0};
+
+    alignas(64) std::atomic<uint32_t> m_head{0};   ///< Next read (consumer)
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_PRODUCER_H
@@ -0,0 +1,231 @@
+// SignalSlot.h
+// Seqlock-protected published signal value
+// Part of: Shared Platform Layer
+// Safety: Lock-free read path for the safety-relevant signal chain
+
+#ifndef AUTOMOTIVE_SIGNAL_SLOT_H
+#define AUTOMOTIVE_SIGNAL_SLOT_H
+
+#include "signal/SignalTypes.h"
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Single-writer, multi-reader seqlock slot for one signal
+ *
+ * Holds the published scalar value and metadata of a signal. The writer
+ * (serialized by SignalHub) bumps the sequence to odd, stores the payload
+ * and bumps it back to even; readers retry if the sequence was odd or
+ * changed while they copied. Readers never block the writer and the writer
+ * never waits for readers.
+ *
+ * The payload is kept in relaxed atomic words so concurrent access is
+ * well-defined. Text of String-kind signals is not part of the slot.
+ */
+class SignalSlot {
+public:
+    SignalSlot() = default;
+
+    // Copy is only used while the hub is still registering (single-threaded)
+    SignalSlot(const SignalSlot& other) { copyFrom(other); }
+    SignalSlot& operator=(const SignalSlot& other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Publish a value (writer side, must be externally serialized)
+     */
+    void store(const SignalValue& value) {
+        const uint32_t seq = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_valueBits.store(packValue(value.value), std::memory_order_relaxed);
+        m_timestampMs.store(value.timestampMs, std::memory_order_relaxed);
+        m_sourceTimestampMs.store(value.sourceTimestampMs, std::memory_order_relaxed);
+        m_meta.store(packMeta(value), std::memory_order_relaxed);
+
+        m_sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read a consistent copy (reader side, lock-free)
+     *
+     * The returned value has an empty text field.
+     */
+    SignalValue load() const {
+        SignalValue result;
+        tryLoad(result, UNBOUNDED);
+        return result;
+    }
+
+    /**
+     * @brief Read a consistent copy, giving up after @p maxAttempts tries
+     *
+     * For readers in another process, where a writer that died between
+     * the two sequence bumps would leave the slot odd forever.
+     * @return false (@p out untouched) if no consistent copy was seen
+     */
+    bool tryLoad(SignalValue& out, int maxAttempts) const {
+        uint64_t valueBits = 0;
+        uint64_t meta = 0;
+        qint64 timestampMs = 0;
+        qint64 sourceTimestampMs = 0;
+
+        for (int attempt = 0; maxAttempts == UNBOUNDED || attempt < maxAttempts; ++attempt) {
+            const uint32_t before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1u) {
+                cpuRelax();
+                continue;
+            }
+
+            valueBits = m_valueBits.load(std::memory_order_relaxed);
+            timestampMs = m_timestampMs.load(std::memory_order_relaxed);
+            sourceTimestampMs = m_sourceTimestampMs.load(std::memory_order_relaxed);
+            meta = m_meta.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before) {
+                out.timestampMs = timestampMs;
+                out.sourceTimestampMs = sourceTimestampMs;
+                unpackMeta(meta, out);
+                out.value = unpackValue(valueBits, out.value.kind);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Read only the validity (reader side, lock-free)
+     */
+    SignalValidity validity() const {
+        SignalValidity result = SignalValidity::NotAvailable;
+        tryValidity(result, UNBOUNDED);
+        return result;
+    }
+
+    /**
+     * @brief Read only the validity, giving up after @p maxAttempts tries
+     * @return false (@p out untouched) if no consistent copy was seen
+     */
+    bool tryValidity(SignalValidity& out, int maxAttempts) const {
+        for (int attempt = 0; maxAttempts == UNBOUNDED || attempt < maxAttempts; ++attempt) {
+            const uint32_t before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1u) {
+                cpuRelax();
+                continue;
+            }
+            const uint64_t meta = m_meta.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before) {
+                out = static_cast<SignalValidity>(meta & 0xFFu);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Current sequence number (even when stable)
+     */
+    uint32_t sequence() const { return m_sequence.load(std::memory_order_acquire); }
+
+private:
+    static constexpr int UNBOUNDED = -1;   ///< In-process writer: always finishes
+
+    static uint64_t packValue(const ScalarValue& value) {
+        uint64_t bits = 0;
+        switch (value.kind) {
+        case SignalKind::Double:
+            std::memcpy(&bits, &value.asDouble, sizeof(bits));
+            break;
+        case SignalKind::Int:
+        case SignalKind::Enum:
+            std::memcpy(&bits, &value.asInt, sizeof(bits));
+            break;
+        case SignalKind::Bool:
+            bits = value.asBool ? 1u : 0u;
+            break;
+        case SignalKind::String:
+            break;
+        }
+        return bits;
+    }
+
+    static ScalarValue unpackValue(uint64_t bits, SignalKind kind) {
+        ScalarValue value;
+        value.kind = kind;
+        switch (kind) {
+        case SignalKind::Double:
+            std::memcpy(&value.asDouble, &bits, sizeof(bits));
+            break;
+        case SignalKind::Int:
+        case SignalKind::Enum:
+            std::memcpy(&value.asInt, &bits, sizeof(bits));
+            break;
+        case SignalKind::Bool:
+            value.asBool = bits != 0;
+            break;
+        case SignalKind::String:
+            value.asInt = 0;
+            break;
+        }
+        return value;
+    }
+
+    // Layout: [validity:8][kind:8][reserved:16][updateCount:32]
+    static uint64_t packMeta(const SignalValue& value) {
+        return static_cast<uint64_t>(value.validity) |
+               (static_cast<uint64_t>(value.value.kind) << 8) |
+               (static_cast<uint64_t>(value.updateCount) << 32);
+    }
+
+    static void unpackMeta(uint64_t meta, SignalValue& value) {
+        value.validity = static_cast<SignalValidity>(meta & 0xFFu);
+        value.value.kind = static_cast<SignalKind>((meta >> 8) & 0xFFu);
+        value.updateCount = static_cast<uint32_t>(meta >> 32);
+    }
+
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    void copyFrom(const SignalSlot& other) {
+        m_sequence.store(other.m_sequence.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+        m_valueBits.store(other.m_valueBits.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+        m_timestampMs.store(other.m_timestampMs.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+        m_sourceTimestampMs.store(other.m_sourceTimestampMs.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+        m_meta.store(other.m_meta.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
+    }
+
+    std::atomic<uint32_t> m_sequence{0};
+    std::atomic<uint64_t> m_valueBits{0};
+    std::atomic<qint64> m_timestampMs{0};
+    std::atomic<qint64> m_sourceTimestampMs{0};
+    std::atomic<uint64_t> m_meta{static_cast<uint64_t>(SignalValidity::NotAvailable)};
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_SLOT_H
@@ -0,0 +1,74 @@
+// SignalSnapshot.cpp
+// Consistent multi-signal view implementation
+
+#include "signal/SignalSnapshot.h"
+
+namespace automotive {
+namespace signal {
+
+SignalSnapshot& SignalSnapshot::operator=(SignalSnapshot&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        m_buffer = other.m_buffer;
+        other.m_buffer = nullptr;
+    }
+    return *this;
+}
+
+void SignalSnapshot::release()
+{
+    if (m_buffer) {
+        m_buffer->pins.fetch_sub(1, std::memory_order_seq_cst);
+        m_buffer = nullptr;
+    }
+}
+
+SignalValue SignalSnapshot::value(SignalHandle handle) const
+{
+    SignalValue result;
+    if (!m_buffer || handle.index >= static_cast<uint32_t>(m_buffer->records.size())) {
+        return result;
+    }
+
+    const SnapshotRecord& record = m_buffer->records.at(handle.index);
+    result.value = record.value;
+    result.text = m_buffer->texts.at(handle.index);
+    result.validity = record.validity;
+    result.timestampMs = record.timestampMs;
+    result.sourceTimestampMs = record.sourceTimestampMs;
+    result.updateCount = record.updateCount;
+    return result;
+}
+
+QByteArray SignalSnapshot::rawRecords() const
+{
+    if (!m_buffer) {
+        return QByteArray();
+    }
+
+    return QByteArray::fromRawData(
+        reinterpret_cast<const char*>(m_buffer->records.constData()),
+        static_cast<qsizetype>(m_buffer->records.size() * sizeof(SnapshotRecord)));
+}
+
+int SignalSnapshot::exportBatch(SignalBatch& batch) const
+{
+    batch.clear();
+    if (!m_buffer) {
+        return 0;
+    }
+
+    for (int i = 0; i < m_buffer->records.size(); ++i) {
+        const SnapshotRecord& record = m_buffer->records.at(i);
+        if (record.validity != SignalValidity::Valid) {
+            continue;
+        }
+        batch.append({record.handle, record.value, m_buffer->texts.at(i),
+                      record.sourceTimestampMs});
+    }
+    return static_cast<int>(batch.size());
+}
+
+} // namespace signal
+} // namespace automotive
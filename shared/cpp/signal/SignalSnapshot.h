@@ -0,0 +1,134 @@
+// SignalSnapshot.h
+// Consistent multi-signal view published once per tick
+// Part of: Shared Platform Layer
+// Safety: Lock-free, allocation-free read path for multi-signal consumers
+
+#ifndef AUTOMOTIVE_SIGNAL_SNAPSHOT_H
+#define AUTOMOTIVE_SIGNAL_SNAPSHOT_H
+
+#include "signal/SignalTypes.h"
+#include <QByteArray>
+#include <QVector>
+#include <atomic>
+#include <type_traits>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Fixed-layout state of one signal inside a snapshot
+ *
+ * Trivially copyable, so a snapshot's record array can be handed to IPC
+ * as raw bytes (host byte order, same build on both ends). Text of
+ * String-kind signals is kept next to the records.
+ */
+struct SnapshotRecord {
+    SignalHandle handle;               ///< Signal this record describes
+    SignalValidity validity{SignalValidity::NotAvailable};
+    uint32_t updateCount{0};           ///< Number of updates received
+    ScalarValue value;                 ///< Value (non-string kinds)
+    qint64 timestampMs{0};             ///< Monotonic timestamp of last update
+    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp (if available)
+};
+
+static_assert(std::is_trivially_copyable<SnapshotRecord>::value,
+              "SnapshotRecord must stay raw-exportable");
+
+/**
+ * @brief Storage of one snapshot generation
+ *
+ * SignalHub rotates three of these: the current one, one that a slow
+ * reader may still pin, and one being filled. Sized at registration.
+ */
+struct SnapshotBuffer {
+    std::atomic<int> pins{0};          ///< Readers currently holding this buffer
+    quint64 epoch{0};                  ///< Publish counter, 1 for the first snapshot
+    qint64 timestampMs{0};             ///< Monotonic publish time
+    bool degradedMode{false};          ///< Hub degraded mode at publish time
+    int invalidCount{0};               ///< Hub invalid signal count at publish time
+    QVector<SnapshotRecord> records;   ///< One per signal, indexed by handle
+    QVector<QString> texts;            ///< String-kind text, indexed by handle
+};
+
+/**
+ * @brief Pinned, immutable view of all signals at one tick
+ *
+ * Obtained from SignalHub::snapshot() without locking. All values come
+ * from the same publish, so related signals (gear, speed, SOC) never tear.
+ * While a snapshot is held its buffer is not reused; release it (or let it
+ * go out of scope) promptly, and never keep it beyond the hub's lifetime.
+ */
+class SignalSnapshot {
+public:
+    SignalSnapshot() = default;
+    ~SignalSnapshot() { release(); }
+
+    SignalSnapshot(SignalSnapshot&& other) noexcept : m_buffer(other.m_buffer) {
+        other.m_buffer = nullptr;
+    }
+    SignalSnapshot& operator=(SignalSnapshot&& other) noexcept;
+
+    SignalSnapshot(const SignalSnapshot&) = delete;
+    SignalSnapshot& operator=(const SignalSnapshot&) = delete;
+
+    /**
+     * @brief False if no snapshot has been published yet
+     */
+    bool isValid() const { return m_buffer != nullptr; }
+
+    quint64 epoch() const { return m_buffer ? m_buffer->epoch : 0; }
+    qint64 timestampMs() const { return m_buffer ? m_buffer->timestampMs : 0; }
+    bool isDegradedMode() const { return m_buffer && m_buffer->degradedMode; }
+    int invalidSignalCount() const { return m_buffer ? m_buffer->invalidCount : 0; }
+
+    /**
+     * @brief Number of records (registered signals)
+     */
+    int size() const { return m_buffer ? static_cast<int>(m_buffer->records.size()) : 0; }
+
+    /**
+     * @brief Value of one signal (NotAvailable for an unknown handle)
+     */
+    SignalValue value(SignalHandle handle) const;
+
+    /**
+     * @brief Record array, indexed by handle; size() entries
+     */
+    const SnapshotRecord* records() const {
+        return m_buffer ? m_buffer->records.constData() : nullptr;
+    }
+
+    /**
+     * @brief Zero-copy byte view of the record array
+     *
+     * Wraps the snapshot memory without copying; only valid while this
+     * snapshot is held.
+     */
+    QByteArray rawRecords() const;
+
+    /**
+     * @brief Export Valid signals into a batch for SignalHub::updateSignals()
+     * @param batch Destination, cleared first; its capacity is reused
+     * @return Number of exported entries
+     *
+     * Non-Valid signals are left out: the receiving hub applies its own
+     * validation and freshness monitoring.
+     */
+    int exportBatch(SignalBatch& batch) const;
+
+    /**
+     * @brief Unpin early (the snapshot becomes invalid)
+     */
+    void release();
+
+private:
+    friend class SignalHub;
+    explicit SignalSnapshot(SnapshotBuffer* buffer) : m_buffer(buffer) {}
+
+    SnapshotBuffer* m_buffer{nullptr};
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_SNAPSHOT_H
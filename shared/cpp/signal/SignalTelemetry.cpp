@@ -0,0 +1,212 @@
+// SignalTelemetry.cpp
+// Per-signal telemetry counters implementation
+
+#include "signal/SignalTelemetry.h"
+#include <algorithm>
+#include <cmath>
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+// Weight of a new sample in the smoothed interval and jitter (1/16 as in RFC 3550)
+constexpr double SMOOTHING = 1.0 / 16.0;
+
+template<typename T>
+void storeMax(std::atomic<T>& target, T value)
+{
+    T current = target.load(std::memory_order_relaxed);
+    while (value > current &&
+           !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// LatencyStats / LatencyHistogram
+// ============================================================================
+
+qint64 LatencyStats::percentileUs(double fraction) const
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    const quint64 rank = static_cast<quint64>(
+        std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count)));
+    quint64 seen = 0;
+    for (int i = 0; i < BUCKET_COUNT - 1; ++i) {
+        seen += buckets[static_cast<size_t>(i)];
+        if (seen >= std::max<quint64>(rank, 1)) {
+            return std::min(LatencyHistogram::UPPER_BOUNDS_US[static_cast<size_t>(i)], maxUs);
+        }
+    }
+    return maxUs;
+}
+
+int LatencyHistogram::bucketFor(qint64 latencyUs)
+{
+    const auto it = std::lower_bound(UPPER_BOUNDS_US.begin(), UPPER_BOUNDS_US.end(), latencyUs);
+    return static_cast<int>(it - UPPER_BOUNDS_US.begin());
+}
+
+void LatencyHistogram::record(qint64 latencyUs)
+{
+    latencyUs = std::max<qint64>(latencyUs, 0);
+    m_buckets[static_cast<size_t>(bucketFor(latencyUs))].fetch_add(1, std::memory_order_relaxed);
+    m_sumUs.fetch_add(static_cast<quint64>(latencyUs), std::memory_order_relaxed);
+    storeMax(m_maxUs, latencyUs);
+}
+
+LatencyStats LatencyHistogram::stats() const
+{
+    LatencyStats stats;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        const size_t b = static_cast<size_t>(i);
+        stats.buckets[b] = m_buckets[b].load(std::memory_order_relaxed);
+        stats.count += stats.buckets[b];
+    }
+    stats.maxUs = m_maxUs.load(std::memory_order_relaxed);
+    if (stats.count > 0) {
+        stats.meanUs = static_cast<double>(m_sumUs.load(std::memory_order_relaxed)) /
+                       static_cast<double>(stats.count);
+    }
+    return stats;
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sumUs.store(0, std::memory_order_relaxed);
+    m_maxUs.store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::copyFrom(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < m_buckets.size(); ++i) {
+        m_buckets[i].store(other.m_buckets[i].load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    }
+    m_sumUs.store(other.m_sumUs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_maxUs.store(other.m_maxUs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+// ============================================================================
+// SignalTelemetry
+// ============================================================================
+
+void SignalTelemetry::recordCommit(qint64 commitUs, qint64 sourceLatencyUs, bool accepted)
+{
+    // Single writer: plain load/store instead of read-modify-write
+    const auto bump = [](std::atomic<quint64>& counter, quint64 by) {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    };
+
+    bump(m_updates, 1);
+    if (!accepted) {
+        bump(m_rejected, 1);
+    }
+    if (sourceLatencyUs >= 0) {
+        m_sourceLatency.record(sourceLatencyUs);
+    }
+
+    const qint64 lastCommitUs = m_lastCommitUs.load(std::memory_order_relaxed);
+    m_lastCommitUs.store(commitUs, std::memory_order_relaxed);
+    if (lastCommitUs < 0) {
+        return;
+    }
+
+    const qint64 interval = std::max<qint64>(commitUs - lastCommitUs, 0);
+    const quint64 intervals = m_intervalCount.load(std::memory_order_relaxed);
+    if (intervals == 0 || interval < m_minIntervalUs.load(std::memory_order_relaxed)) {
+        m_minIntervalUs.store(interval, std::memory_order_relaxed);
+    }
+    if (interval > m_maxIntervalUs.load(std::memory_order_relaxed)) {
+        m_maxIntervalUs.store(interval, std::memory_order_relaxed);
+    }
+    bump(m_intervalSumUs, static_cast<quint64>(interval));
+    m_intervalCount.store(intervals + 1, std::memory_order_relaxed);
+
+    const double smoothed = m_smoothedIntervalUs.load(std::memory_order_relaxed);
+    m_smoothedIntervalUs.store(intervals == 0 ? static_cast<double>(interval)
+                                              : smoothed + (interval - smoothed) * SMOOTHING,
+                               std::memory_order_relaxed);
+
+    const qint64 lastInterval = m_lastIntervalUs.load(std::memory_order_relaxed);
+    if (lastInterval >= 0) {
+        const double jitter = m_jitterUs.load(std::memory_order_relaxed);
+        const double deviation = static_cast<double>(std::llabs(interval - lastInterval));
+        m_jitterUs.store(jitter + (deviation - jitter) * SMOOTHING, std::memory_order_relaxed);
+    }
+    m_lastIntervalUs.store(interval, std::memory_order_relaxed);
+}
+
+void SignalTelemetry::recordNotify(qint64 nowUs)
+{
+    const qint64 commitUs = m_lastCommitUs.load(std::memory_order_relaxed);
+    m_notifyLatency.record(commitUs >= 0 ? nowUs - commitUs : 0);
+}
+
+SignalTelemetryStats SignalTelemetry::stats() const
+{
+    SignalTelemetryStats stats;
+    stats.updates = m_updates.load(std::memory_order_relaxed);
+    stats.rejected = m_rejected.load(std::memory_order_relaxed);
+
+    const quint64 intervals = m_intervalCount.load(std::memory_order_relaxed);
+    if (intervals > 0) {
+        stats.meanIntervalUs = static_cast<double>(m_intervalSumUs.load(std::memory_order_relaxed)) /
+                               static_cast<double>(intervals);
+        stats.minIntervalUs = m_minIntervalUs.load(std::memory_order_relaxed);
+        stats.maxIntervalUs = m_maxIntervalUs.load(std::memory_order_relaxed);
+        const double smoothed = m_smoothedIntervalUs.load(std::memory_order_relaxed);
+        stats.rateHz = smoothed > 0.0 ? 1e6 / smoothed : 0.0;
+    }
+    stats.jitterUs = m_jitterUs.load(std::memory_order_relaxed);
+    stats.sourceLatency = m_sourceLatency.stats();
+    stats.notifyLatency = m_notifyLatency.stats();
+    stats.notifications = stats.notifyLatency.count;
+    return stats;
+}
+
+void SignalTelemetry::reset()
+{
+    m_updates.store(0, std::memory_order_relaxed);
+    m_rejected.store(0, std::memory_order_relaxed);
+    m_lastCommitUs.store(-1, std::memory_order_relaxed);
+    m_lastIntervalUs.store(-1, std::memory_order_relaxed);
+    m_minIntervalUs.store(0, std::memory_order_relaxed);
+    m_maxIntervalUs.store(0, std::memory_order_relaxed);
+    m_intervalSumUs.store(0, std::memory_order_relaxed);
+    m_intervalCount.store(0, std::memory_order_relaxed);
+    m_smoothedIntervalUs.store(0.0, std::memory_order_relaxed);
+    m_jitterUs.store(0.0, std::memory_order_relaxed);
+    m_sourceLatency.reset();
+    m_notifyLatency.reset();
+}
+
+void SignalTelemetry::copyFrom(const SignalTelemetry& other)
+{
+    auto copy = [](auto& to, const auto& from) {
+        to.store(from.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    };
+    copy(m_updates, other.m_updates);
+    copy(m_rejected, other.m_rejected);
+    copy(m_lastCommitUs, other.m_lastCommitUs);
+    copy(m_lastIntervalUs, other.m_lastIntervalUs);
+    copy(m_minIntervalUs, other.m_minIntervalUs);
+    copy(m_maxIntervalUs, other.m_maxIntervalUs);
+    copy(m_intervalSumUs, other.m_intervalSumUs);
+    copy(m_intervalCount, other.m_intervalCount);
+    copy(m_smoothedIntervalUs, other.m_smoothedIntervalUs);
+    copy(m_jitterUs, other.m_jitterUs);
+    m_sourceLatency = other.m_sourceLatency;
+    m_notifyLatency = other.m_notifyLatency;
+}
+
+} // namespace signal
+} // namespace automotive
@@ -0,0 +1,151 @@
+// SignalTelemetry.h
+// Per-signal update rate, jitter and latency counters for SignalHub
+// Part of: Shared Platform Layer
+// Safety: Diagnostic only; lock-free and allocation-free on the update path
+
+#ifndef AUTOMOTIVE_SIGNAL_TELEMETRY_H
+#define AUTOMOTIVE_SIGNAL_TELEMETRY_H
+
+#include <QtGlobal>
+#include <array>
+#include <atomic>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Snapshot of a LatencyHistogram
+ */
+struct LatencyStats {
+    static constexpr int BUCKET_COUNT = 16;
+
+    std::array<quint64, BUCKET_COUNT> buckets{};  ///< Samples per bucket
+    quint64 count{0};                  ///< Total samples
+    double meanUs{0.0};                ///< Mean latency in microseconds
+    qint64 maxUs{0};                   ///< Largest sample in microseconds
+
+    /**
+     * @brief Upper bound of the bucket holding the @p fraction quantile
+     * @param fraction 0.0 .. 1.0 (e.g. 0.99)
+     * @return Bound in microseconds; maxUs for the overflow bucket, 0 if empty
+     */
+    qint64 percentileUs(double fraction) const;
+};
+
+/**
+ * @brief Fixed-bucket latency histogram
+ *
+ * Buckets are bounded by UPPER_BOUNDS_US (roughly 1-2.5-5 per decade,
+ * 50 us to 1 s) plus an overflow bucket. record() is a handful of relaxed
+ * atomic increments and may be called from any thread.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int BUCKET_COUNT = LatencyStats::BUCKET_COUNT;
+    static constexpr std::array<qint64, BUCKET_COUNT - 1> UPPER_BOUNDS_US{{
+        50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000,
+        100000, 250000, 500000, 1000000, 2500000
+    }};
+
+    LatencyHistogram() = default;
+
+    // Copy is only used while the hub is still registering (single-threaded)
+    LatencyHistogram(const LatencyHistogram& other) { copyFrom(other); }
+    LatencyHistogram& operator=(const LatencyHistogram& other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    void record(qint64 latencyUs);
+    LatencyStats stats() const;
+    void reset();
+
+    /**
+     * @brief Bucket index for a latency
+     */
+    static int bucketFor(qint64 latencyUs);
+
+private:
+    void copyFrom(const LatencyHistogram& other);
+
+    std::array<std::atomic<quint64>, BUCKET_COUNT> m_buckets{};
+    std::atomic<quint64> m_sumUs{0};
+    std::atomic<qint64> m_maxUs{0};
+};
+
+/**
+ * @brief Telemetry of one signal
+ */
+struct SignalTelemetryStats {
+    quint64 updates{0};                ///< Committed updates
+    quint64 rejected{0};               ///< Updates committed as not Valid
+    quint64 notifications{0};          ///< Changes delivered to consumers (notifyLatency.count)
+    double rateHz{0.0};                ///< Recent update rate (smoothed)
+    double meanIntervalUs{0.0};        ///< Mean time between updates
+    qint64 minIntervalUs{0};           ///< Shortest time between updates
+    qint64 maxIntervalUs{0};           ///< Longest time between updates
+    double jitterUs{0.0};              ///< Smoothed inter-arrival jitter (RFC 3550 style)
+    LatencyStats sourceLatency;        ///< Source timestamp -> commit
+    LatencyStats notifyLatency;        ///< Commit -> delivery to consumers
+};
+
+/**
+ * @brief Per-signal telemetry counters (owned by SignalHub)
+ *
+ * Commit-side counters are written by the hub's serialized writer;
+ * notifications may be recorded by any delivering thread. Readers take
+ * relaxed snapshots, so a stats() taken during an update may mix two
+ * consecutive updates' values.
+ */
+class SignalTelemetry {
+public:
+    SignalTelemetry() = default;
+
+    // Copy is only used while the hub is still registering (single-threaded)
+    SignalTelemetry(const SignalTelemetry& other) { copyFrom(other); }
+    SignalTelemetry& operator=(const SignalTelemetry& other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Account a committed update (writer side, externally serialized)
+     * @param commitUs Commit time in microseconds
+     * @param sourceLatencyUs Source-to-commit latency, negative if unknown
+     * @param accepted Update committed as Valid
+     */
+    void recordCommit(qint64 commitUs, qint64 sourceLatencyUs, bool accepted);
+
+    /**
+     * @brief Account a delivery of the latest committed value (any thread)
+     */
+    void recordNotify(qint64 nowUs);
+
+    SignalTelemetryStats stats() const;
+    void reset();
+
+private:
+    void copyFrom(const SignalTelemetry& other);
+
+    std::atomic<quint64> m_updates{0};
+    std::atomic<quint64> m_rejected{0};
+    std::atomic<qint64> m_lastCommitUs{-1};
+    std::atomic<qint64> m_lastIntervalUs{-1};
+    std::atomic<qint64> m_minIntervalUs{0};
+    std::atomic<qint64> m_maxIntervalUs{0};
+    std::atomic<quint64> m_intervalSumUs{0};
+    std::atomic<quint64> m_intervalCount{0};
+    std::atomic<double> m_smoothedIntervalUs{0.0};
+    std::atomic<double> m_jitterUs{0.0};
+    LatencyHistogram m_sourceLatency;
+    LatencyHistogram m_notifyLatency;
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_TELEMETRY_H
@@ -0,0 +1,402 @@
+// SignalTrace.cpp
+// Binary signal trace recorder and reader implementation
+
+#include "signal/SignalTrace.h"
+#include "signal/SignalHub.h"
+#include <QDebug>
+#include <cstring>
+#include <limits>
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+uint64_t valueBits(const ScalarValue& value)
+{
+    uint64_t bits = 0;
+    switch (value.kind) {
+    case SignalKind::Double:
+        std::memcpy(&bits, &value.asDouble, sizeof(bits));
+        break;
+    case SignalKind::Int:
+    case SignalKind::Enum:
+        std::memcpy(&bits, &value.asInt, sizeof(bits));
+        break;
+    case SignalKind::Bool:
+        bits = value.asBool ? 1 : 0;
+        break;
+    case SignalKind::String:
+        break;
+    }
+    return bits;
+}
+
+ScalarValue valueFromBits(SignalKind kind, uint64_t bits)
+{
+    ScalarValue value;
+    switch (kind) {
+    case SignalKind::Double: {
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        value = ScalarValue(d);
+        break;
+    }
+    case SignalKind::Int:
+    case SignalKind::Enum: {
+        qint64 i;
+        std::memcpy(&i, &bits, sizeof(i));
+        value = ScalarValue(i);
+        value.kind = kind;
+        break;
+    }
+    case SignalKind::Bool:
+        value = ScalarValue(bits != 0);
+        break;
+    case SignalKind::String:
+        value.kind = SignalKind::String;
+        break;
+    }
+    return value;
+}
+
+bool validKind(uint8_t kind)
+{
+    return kind <= static_cast<uint8_t>(SignalKind::String);
+}
+
+} // namespace
+
+// ============================================================================
+// SignalTraceRecorder
+// ============================================================================
+
+SignalTraceRecorder::SignalTraceRecorder(int bufferBytes)
+    : m_bufferBytes(static_cast<std::size_t>(qMax(bufferBytes, 4096)))
+{
+}
+
+SignalTraceRecorder::~SignalTraceRecorder()
+{
+    stop();
+}
+
+bool SignalTraceRecorder::start(const QString& path, const SignalHub& hub)
+{
+    if (m_recording) {
+        qWarning() << "SignalTraceRecorder: Already recording";
+        return false;
+    }
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "SignalTraceRecorder: Cannot open" << path << ":" << m_file.errorString();
+        return false;
+    }
+
+    const QStringList ids = hub.registeredSignals();
+
+    TraceFileHeader header{};
+    std::memcpy(header.magic, TraceFormat::MAGIC, sizeof(header.magic));
+    header.formatVersion = TraceFormat::VERSION;
+    header.headerSize = sizeof(TraceFileHeader);
+    header.signalCount = static_cast<uint32_t>(ids.size());
+    header.recordSize = sizeof(TraceRecord);
+    header.startTimeMs = hub.monotonicTimeMs();
+
+    QByteArray prologue(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const QString& id : ids) {
+        const QByteArray utf8 = id.toUtf8();
+        const uint16_t length = static_cast<uint16_t>(
+            qMin<int>(utf8.size(), std::numeric_limits<uint16_t>::max()));
+        prologue.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        prologue.append(utf8.constData(), length);
+    }
+
+    if (m_file.write(prologue) != prologue.size()) {
+        qWarning() << "SignalTraceRecorder: Cannot write" << path << ":" << m_file.errorString();
+        m_file.close();
+        return false;
+    }
+
+    m_active.clear();
+    m_active.reserve(m_bufferBytes);
+    m_spare.clear();
+    m_spare.reserve(m_bufferBytes);
+    m_records = 0;
+    m_dropped = 0;
+    m_bytesWritten = static_cast<quint64>(prologue.size());
+    m_flushes = 0;
+    m_writeFailed = false;
+    m_writePending = false;
+    m_stopping = false;
+
+    m_writer = std::thread(&SignalTraceRecorder::writerLoop, this);
+    m_recording = true;
+    return true;
+}
+
+void SignalTraceRecorder::stop()
+{
+    if (!m_recording) {
+        return;
+    }
+
+    {
+        // The only place that waits: hand over the partial buffer
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [this] { return !m_writePending; });
+        if (!m_active.empty()) {
+            std::swap(m_active, m_spare);
+            m_writePending = true;
+            ++m_flushes;
+        }
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    m_writer.join();
+
+    m_file.close();
+    m_recording = false;
+}
+
+void SignalTraceRecorder::recordUpdate(SignalHandle handle, const ScalarValue& value,
+                                       const QString& text, bool convertible,
+                                       qint64 timestampMs, qint64 sourceTimestampMs,
+                                       BatchPosition position)
+{
+    if (!m_recording) {
+        return;
+    }
+
+    TraceRecord record{};
+    record.handle = handle.index;
+    record.kind = static_cast<uint8_t>(value.kind);
+    record.flags = static_cast<uint8_t>(position);
+    if (!convertible) {
+        record.flags |= TraceFormat::Inconvertible;
+    }
+    record.timestampMs = timestampMs;
+    record.sourceTimestampMs = sourceTimestampMs;
+    record.valueBits = valueBits(value);
+
+    QByteArray utf8;
+    if (value.kind == SignalKind::String && !text.isEmpty()) {
+        utf8 = text.toUtf8();
+        if (utf8.size() > std::numeric_limits<uint16_t>::max()) {
+            // Do not split a multi-byte character
+            qsizetype length = std::numeric_limits<uint16_t>::max();
+            while (length > 0 && (static_cast<uchar>(utf8.at(length)) & 0xC0) == 0x80) {
+                --length;
+            }
+            utf8.truncate(length);
+        }
+        record.textLength = static_cast<uint16_t>(utf8.size());
+    }
+
+    append(record, utf8);
+}
+
+void SignalTraceRecorder::recordTick(qint64 timestampMs)
+{
+    if (!m_recording) {
+        return;
+    }
+
+    TraceRecord record{};
+    record.handle = TraceFormat::TICK_HANDLE;
+    record.flags = TraceFormat::Tick;
+    record.timestampMs = timestampMs;
+    append(record, QByteArray());
+}
+
+TraceRecorderStats SignalTraceRecorder::stats() const
+{
+    TraceRecorderStats stats;
+    stats.records = m_records.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.bytesWritten = m_bytesWritten.load(std::memory_order_relaxed);
+    stats.flushes = m_flushes.load(std::memory_order_relaxed);
+    stats.writeFailed = m_writeFailed.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SignalTraceRecorder::append(const TraceRecord& record, const QByteArray& text)
+{
+    const std::size_t size = sizeof(TraceRecord) + static_cast<std::size_t>(text.size());
+    if (m_active.size() + size > m_bufferBytes) {
+        if (size > m_bufferBytes || !handOff()) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    const char* bytes = reinterpret_cast<const char*>(&record);
+    m_active.insert(m_active.end(), bytes, bytes + sizeof(TraceRecord));
+    m_active.insert(m_active.end(), text.constData(), text.constData() + text.size());
+    m_records.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool SignalTraceRecorder::handOff()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_writePending) {
+            return false;              // Writer still busy: drop rather than block the hub
+        }
+        std::swap(m_active, m_spare);
+        m_writePending = true;
+    }
+    m_flushes.fetch_add(1, std::memory_order_relaxed);
+    m_wake.notify_all();
+    return true;
+}
+
+void SignalTraceRecorder::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_wake.wait(lock, [this] { return m_writePending || m_stopping; });
+        if (!m_writePending) {
+            break;                     // Stopping with nothing left to write
+        }
+
+        lock.unlock();
+        const qint64 size = static_cast<qint64>(m_spare.size());
+        const qint64 written = m_file.write(m_spare.data(), size);
+        if (written != size) {
+            m_writeFailed.store(true, std::memory_order_relaxed);
+        }
+        if (written > 0) {
+            m_bytesWritten.fetch_add(static_cast<quint64>(written), std::memory_order_relaxed);
+        }
+        m_spare.clear();               // Keeps its capacity
+        lock.lock();
+
+        m_writePending = false;
+        m_wake.notify_all();
+    }
+}
+
+// ============================================================================
+// SignalTraceReader
+// ============================================================================
+
+SignalTraceReader::~SignalTraceReader()
+{
+    close();
+}
+
+void SignalTraceReader::close()
+{
+    if (m_data) {
+        m_file.unmap(const_cast<uchar*>(m_data));
+        m_data = nullptr;
+    }
+    m_file.close();
+    m_signalIds.clear();
+    m_size = 0;
+    m_recordsOffset = 0;
+    m_position = 0;
+    m_truncated = false;
+}
+
+bool SignalTraceReader::open(const QString& path, QString* error)
+{
+    close();
+
+    auto fail = [&](const QString& message) {
+        if (error) {
+            *error = message;
+        }
+        close();
+        return false;
+    };
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        return fail(QStringLiteral("cannot open %1: %2").arg(path, m_file.errorString()));
+    }
+
+    m_size = m_file.size();
+    if (m_size < static_cast<qint64>(sizeof(TraceFileHeader))) {
+        return fail(QStringLiteral("truncated trace header"));
+    }
+    m_data = m_file.map(0, m_size);
+    if (!m_data) {
+        return fail(QStringLiteral("cannot map %1").arg(path));
+    }
+
+    TraceFileHeader header;
+    std::memcpy(&header, m_data, sizeof(header));
+    if (std::memcmp(header.magic, TraceFormat::MAGIC, sizeof(header.magic)) != 0) {
+        return fail(QStringLiteral("not a signal trace"));
+    }
+    if (header.formatVersion != TraceFormat::VERSION ||
+        header.headerSize != sizeof(TraceFileHeader) ||
+        header.recordSize != sizeof(TraceRecord)) {
+        return fail(QStringLiteral("unsupported trace format version %1")
+                        .arg(header.formatVersion));
+    }
+
+    qint64 offset = header.headerSize;
+    m_signalIds.reserve(static_cast<int>(qMin<uint32_t>(header.signalCount, 65536)));
+    for (uint32_t i = 0; i < header.signalCount; ++i) {
+        uint16_t length;
+        if (offset + static_cast<qint64>(sizeof(length)) > m_size) {
+            return fail(QStringLiteral("truncated signal table"));
+        }
+        std::memcpy(&length, m_data + offset, sizeof(length));
+        offset += sizeof(length);
+        if (offset + length > m_size) {
+            return fail(QStringLiteral("truncated signal table"));
+        }
+        m_signalIds.append(QString::fromUtf8(reinterpret_cast<const char*>(m_data + offset),
+                                             length));
+        offset += length;
+    }
+
+    m_startTimeMs = header.startTimeMs;
+    m_recordsOffset = offset;
+    m_position = offset;
+    return true;
+}
+
+bool SignalTraceReader::next(TraceEvent& event)
+{
+    if (!m_data || m_position >= m_size) {
+        return false;
+    }
+
+    TraceRecord record;
+    if (m_position + static_cast<qint64>(sizeof(record)) > m_size) {
+        m_truncated = true;
+        return false;
+    }
+    std::memcpy(&record, m_data + m_position, sizeof(record));
+
+    const qint64 end = m_position + static_cast<qint64>(sizeof(record)) + record.textLength;
+    if (end > m_size || !validKind(record.kind)) {
+        m_truncated = true;
+        return false;
+    }
+
+    event.isTick = (record.flags & TraceFormat::Tick) != 0;
+    event.signalIndex = record.handle;
+    event.value = valueFromBits(static_cast<SignalKind>(record.kind), record.valueBits);
+    event.text = record.textLength > 0
+        ? QString::fromUtf8(reinterpret_cast<const char*>(m_data + m_position + sizeof(record)),
+                            record.textLength)
+        : QString();
+    event.convertible = (record.flags & TraceFormat::Inconvertible) == 0;
+    event.inBatch = (record.flags & TraceFormat::InBatch) != 0;
+    event.batchEnd = (record.flags & TraceFormat::BatchEnd) != 0;
+    event.timestampMs = record.timestampMs;
+    event.sourceTimestampMs = record.sourceTimestampMs;
+
+    m_position = end;
+    return true;
+}
+
+} // namespace signal
+} // namespace automotive
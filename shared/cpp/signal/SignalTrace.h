@@ -0,0 +1,248 @@
+// SignalTrace.h
+// Binary trace of SignalHub input: buffered recorder and mapped reader
+// Part of: Shared Platform Layer
+// Safety: Diagnostic only; recording never blocks or fails a hub update
+
+#ifndef AUTOMOTIVE_SIGNAL_TRACE_H
+#define AUTOMOTIVE_SIGNAL_TRACE_H
+
+#include "signal/SignalTypes.h"
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace automotive {
+namespace signal {
+
+class SignalHub;
+
+/**
+ * @brief Trace file layout
+ *
+ * [header][signal table][records]
+ *
+ * The signal table lists the recording hub's identifiers in handle order
+ * (uint16 byte length + UTF-8 each), so a trace replays into a hub whose
+ * handles differ. Each record is a TraceRecord followed, for String
+ * values, by textLength bytes of UTF-8. Host byte order.
+ */
+namespace TraceFormat {
+    constexpr char MAGIC[4] = {'A', 'S', 'T', 'R'};
+    constexpr uint16_t VERSION = 1;
+    constexpr uint32_t TICK_HANDLE = 0xFFFFFFFFu;  ///< Handle of tick markers
+
+    enum RecordFlag : uint8_t {
+        Tick = 0x01,                   ///< processTick() marker, no value
+        Inconvertible = 0x02,          ///< Input did not convert to the signal's kind
+        InBatch = 0x04,                ///< Part of an updateSignals()/drain batch
+        BatchEnd = 0x08                ///< Last record of its batch
+    };
+}
+
+struct TraceFileHeader {
+    char magic[4];                     ///< TraceFormat::MAGIC
+    uint16_t formatVersion;            ///< TraceFormat::VERSION
+    uint16_t headerSize;               ///< sizeof(TraceFileHeader)
+    uint32_t signalCount;              ///< Entries in the signal table
+    uint32_t recordSize;               ///< sizeof(TraceRecord)
+    int64_t startTimeMs;               ///< Hub time when recording started
+};
+
+struct TraceRecord {
+    uint32_t handle;                   ///< Recording hub's handle index
+    uint8_t kind;                      ///< SignalKind of the value
+    uint8_t flags;                     ///< TraceFormat::RecordFlag
+    uint16_t textLength;               ///< UTF-8 bytes following (String kind)
+    int64_t timestampMs;               ///< Hub monotonic time of the update
+    int64_t sourceTimestampMs;         ///< Source-provided timestamp
+    uint64_t valueBits;                ///< double or int64 bits; bool as 0/1
+};
+
+static_assert(sizeof(TraceFileHeader) == 24, "Trace header layout changed");
+static_assert(sizeof(TraceRecord) == 32, "Trace record layout changed");
+static_assert(std::is_trivially_copyable<TraceRecord>::value,
+              "Trace records are read in place");
+
+/**
+ * @brief Recorder counters
+ */
+struct TraceRecorderStats {
+    quint64 records{0};                ///< Records accepted into the buffer
+    quint64 dropped{0};                ///< Records lost because the writer fell behind
+    quint64 bytesWritten{0};           ///< Bytes written to the file
+    quint64 flushes{0};                ///< Buffers handed to the writer
+    bool writeFailed{false};           ///< A file write failed (recording continues, output is lost)
+};
+
+/**
+ * @brief Buffered writer of SignalHub input traces
+ *
+ * Attach with SignalHub::setTraceRecorder(). The hub appends records under
+ * its writer lock into one of two fixed buffers; a full buffer is swapped
+ * with the idle one and written by a background thread. If that thread
+ * is still busy with the previous buffer the record is dropped and
+ * counted, so the hub's cost is a copy of at most one record, never I/O.
+ *
+ * @code
+ * SignalTraceRecorder recorder;
+ * recorder.start(path, hub);
+ * hub.setTraceRecorder(&recorder);
+ * ...
+ * hub.setTraceRecorder(nullptr);
+ * recorder.stop();
+ * @endcode
+ */
+class SignalTraceRecorder {
+public:
+    /**
+     * @brief Position of a record within a batch
+     */
+    enum BatchPosition : uint8_t {
+        Single = 0,
+        InBatch = TraceFormat::InBatch,
+        BatchEnd = TraceFormat::InBatch | TraceFormat::BatchEnd
+    };
+
+    static constexpr int DEFAULT_BUFFER_BYTES = 256 * 1024;
+
+    explicit SignalTraceRecorder(int bufferBytes = DEFAULT_BUFFER_BYTES);
+    ~SignalTraceRecorder();
+
+    SignalTraceRecorder(const SignalTraceRecorder&) = delete;
+    SignalTraceRecorder& operator=(const SignalTraceRecorder&) = delete;
+
+    /**
+     * @brief Create @p path and write the header and @p hub's signal table
+     * @return false if already recording or the file cannot be written
+     *
+     * Register all signals before starting; handles registered later are
+     * recorded but cannot be mapped on replay.
+     */
+    bool start(const QString& path, const SignalHub& hub);
+
+    /**
+     * @brief Flush buffered records and close the file
+     *
+     * Detach the recorder from the hub first.
+     */
+    void stop();
+
+    bool isRecording() const { return m_recording; }
+
+    /**
+     * @brief Append an update (called by SignalHub under its writer lock)
+     */
+    void recordUpdate(SignalHandle handle, const ScalarValue& value, const QString& text,
+                      bool convertible, qint64 timestampMs, qint64 sourceTimestampMs,
+                      BatchPosition position = Single);
+
+    /**
+     * @brief Append a tick marker (called by SignalHub::processTick())
+     */
+    void recordTick(qint64 timestampMs);
+
+    TraceRecorderStats stats() const;
+
+private:
+    void append(const TraceRecord& record, const QByteArray& text);
+    bool handOff();
+    void writerLoop();
+
+    const std::size_t m_bufferBytes;
+    bool m_recording{false};
+    QFile m_file;
+
+    std::vector<char> m_active;        ///< Filled by the hub
+    std::vector<char> m_spare;         ///< Owned by the writer while m_writePending
+
+    std::mutex m_mutex;                ///< Guards the hand-off state below
+    std::condition_variable m_wake;
+    bool m_writePending{false};
+    bool m_stopping{false};
+    std::thread m_writer;
+
+    std::atomic<quint64> m_records{0};
+    std::atomic<quint64> m_dropped{0};
+    std::atomic<quint64> m_bytesWritten{0};
+    std::atomic<quint64> m_flushes{0};
+    std::atomic<bool> m_writeFailed{false};
+};
+
+/**
+ * @brief One decoded trace record
+ */
+struct TraceEvent {
+    bool isTick{false};                ///< Tick marker (no value)
+    uint32_t signalIndex{0};           ///< Index into SignalTraceReader::signalIds()
+    ScalarValue value;                 ///< Value (non-string kinds)
+    QString text;                      ///< Value (String kind)
+    bool convertible{true};            ///< false: the recorded input was rejected as inconvertible
+    bool inBatch{false};               ///< Part of a batch
+    bool batchEnd{false};              ///< Last record of its batch
+    qint64 timestampMs{0};             ///< Hub time of the update
+    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp
+};
+
+/**
+ * @brief Sequential reader of a memory-mapped trace file
+ */
+class SignalTraceReader {
+public:
+    SignalTraceReader() = default;
+    ~SignalTraceReader();
+
+    SignalTraceReader(const SignalTraceReader&) = delete;
+    SignalTraceReader& operator=(const SignalTraceReader&) = delete;
+
+    /**
+     * @brief Map @p path and read its header and signal table
+     * @return false (with @p error set) if the file is missing, of another
+     *         format version or its header is truncated
+     */
+    bool open(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Identifiers of the recording hub, in handle order
+     */
+    const QStringList& signalIds() const { return m_signalIds; }
+
+    qint64 startTimeMs() const { return m_startTimeMs; }
+
+    /**
+     * @brief Decode the next record
+     * @return false at the end of the trace, or at a truncated trailing
+     *         record (see isTruncated()) as left by an interrupted recording
+     */
+    bool next(TraceEvent& event);
+
+    /**
+     * @brief Restart from the first record
+     */
+    void rewind() { m_position = m_recordsOffset; m_truncated = false; }
+
+    bool isTruncated() const { return m_truncated; }
+
+private:
+    void close();
+
+    QFile m_file;
+    const uchar* m_data{nullptr};
+    qint64 m_size{0};
+    qint64 m_recordsOffset{0};
+    qint64 m_position{0};
+    qint64 m_startTimeMs{0};
+    QStringList m_signalIds;
+    bool m_truncated{false};
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_TRACE_H
@@ -0,0 +1,225 @@
+// SignalTraceReplayer.cpp
+// Signal trace replay implementation
+
+#include "signal/SignalTraceReplayer.h"
+#include "signal/SignalHub.h"
+#include <QDebug>
+#include <cmath>
+#include <limits>
+
+namespace automotive {
+namespace signal {
+
+SignalTraceReplayer::SignalTraceReplayer(SignalHub* hub, QObject* parent)
+    : QObject(parent)
+    , m_hub(hub)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &SignalTraceReplayer::onTimerTick);
+}
+
+SignalTraceReplayer::~SignalTraceReplayer()
+{
+    stop();
+}
+
+bool SignalTraceReplayer::open(const QString& path, QString* error)
+{
+    stop();
+
+    if (!m_reader.open(path, error)) {
+        m_hasNext = false;
+        m_finished = true;
+        return false;
+    }
+
+    const QStringList& ids = m_reader.signalIds();
+    m_handles.clear();
+    m_handles.reserve(ids.size());
+    m_unmapped = 0;
+    for (const QString& id : ids) {
+        const SignalHandle handle = m_hub->signalHandle(id);
+        if (!handle.isValid()) {
+            ++m_unmapped;
+        }
+        m_handles.append(handle);
+    }
+    if (m_unmapped > 0) {
+        qWarning() << "SignalTraceReplayer:" << m_unmapped << "trace signals unknown to the hub";
+    }
+
+    m_batch.clear();
+    m_stats = TraceReplayStats{};
+    m_finished = false;
+    fetchNext();
+
+    // Continue from the hub's current time rather than jumping to the trace's
+    m_timeOffsetMs = m_hasNext ? m_hub->monotonicTimeMs() - m_next.timestampMs : 0;
+    return true;
+}
+
+void SignalTraceReplayer::setSpeed(double factor)
+{
+    m_speed = factor > 0.0 ? factor : AS_FAST_AS_POSSIBLE;
+    if (m_running) {
+        stop();
+        start();
+    }
+}
+
+void SignalTraceReplayer::start()
+{
+    if (m_running || m_finished) {
+        return;
+    }
+
+    if (m_speed == AS_FAST_AS_POSSIBLE) {
+        replayUntil(std::numeric_limits<qint64>::max());
+        finish();
+        return;
+    }
+
+    m_running = true;
+    m_resumeTraceMs = m_hasNext ? m_next.timestampMs : 0;
+    m_clock.start();
+    scheduleNext();
+}
+
+void SignalTraceReplayer::stop()
+{
+    m_timer.stop();
+    m_running = false;
+}
+
+int SignalTraceReplayer::replayUntil(qint64 traceTimeMs)
+{
+    int applied = 0;
+    while (m_hasNext && m_next.timestampMs <= traceTimeMs) {
+        apply(m_next);
+        ++applied;
+        fetchNext();
+    }
+
+    if (!m_hasNext) {
+        flushBatch();                  // Trace ended inside a batch
+    }
+    return applied;
+}
+
+void SignalTraceReplayer::onTimerTick()
+{
+    if (!m_running) {
+        return;
+    }
+
+    const qint64 traceNowMs = m_resumeTraceMs +
+        static_cast<qint64>(static_cast<double>(m_clock.elapsed()) * m_speed);
+    replayUntil(traceNowMs);
+    scheduleNext();
+}
+
+void SignalTraceReplayer::fetchNext()
+{
+    m_hasNext = m_reader.next(m_next);
+    if (!m_hasNext && m_reader.isTruncated()) {
+        qWarning() << "SignalTraceReplayer: Trace ends with a truncated record";
+    }
+}
+
+void SignalTraceReplayer::apply(const TraceEvent& event)
+{
+    const qint64 hubTimeMs = event.timestampMs + m_timeOffsetMs;
+
+    if (event.isTick) {
+        flushBatch();
+        if (m_replayTicks) {
+            m_hub->setClockOverride(hubTimeMs);
+            m_hub->processTick();
+            ++m_stats.ticks;
+        }
+        return;
+    }
+
+    const SignalHandle handle = event.signalIndex < static_cast<uint32_t>(m_handles.size())
+        ? m_handles.at(static_cast<int>(event.signalIndex))
+        : SignalHandle();
+
+    if (event.inBatch) {
+        if (!handle.isValid()) {
+            ++m_stats.skipped;
+        } else {
+            SignalUpdate update;
+            update.handle = handle;
+            update.value = event.value;
+            update.text = event.text;
+            update.sourceTimestampMs = event.sourceTimestampMs;
+            m_batch.append(update);
+            m_batchTimeMs = hubTimeMs;
+        }
+        if (event.batchEnd) {
+            flushBatch();
+        }
+        return;
+    }
+
+    // A single update outside a batch ends any batch left open
+    flushBatch();
+    if (!handle.isValid()) {
+        ++m_stats.skipped;
+        return;
+    }
+
+    m_hub->setClockOverride(hubTimeMs);
+    if (event.value.kind == SignalKind::String) {
+        m_hub->updateSignal(handle, event.text, event.sourceTimestampMs);
+    } else if (!event.convertible) {
+        // Reproduce the rejected input (no kind converts from empty text)
+        m_hub->updateSignal(handle, QString(), event.sourceTimestampMs);
+    } else {
+        m_hub->updateSignal(handle, event.value, event.sourceTimestampMs);
+    }
+    ++m_stats.updates;
+}
+
+void SignalTraceReplayer::flushBatch()
+{
+    if (m_batch.isEmpty()) {
+        return;
+    }
+
+    m_hub->setClockOverride(m_batchTimeMs);
+    m_hub->updateSignals(m_batch);
+    ++m_stats.batches;
+    m_stats.batchedUpdates += static_cast<quint64>(m_batch.size());
+    m_batch.clear();
+}
+
+void SignalTraceReplayer::scheduleNext()
+{
+    if (!m_hasNext) {
+        finish();
+        return;
+    }
+
+    const double dueMs = static_cast<double>(m_next.timestampMs - m_resumeTraceMs) / m_speed;
+    const qint64 waitMs = static_cast<qint64>(std::ceil(dueMs)) - m_clock.elapsed();
+    m_timer.start(static_cast<int>(qBound<qint64>(0, waitMs, std::numeric_limits<int>::max())));
+}
+
+void SignalTraceReplayer::finish()
+{
+    stop();
+    if (m_finished) {
+        return;
+    }
+
+    m_finished = true;
+    qDebug() << "SignalTraceReplayer: Finished," << m_stats.updates << "updates,"
+             << m_stats.batches << "batches," << m_stats.ticks << "ticks,"
+             << m_stats.skipped << "skipped";
+    emit finished();
+}
+
+} // namespace signal
+} // namespace automotive
@@ -0,0 +1,153 @@
+// SignalTraceReplayer.h
+// Feeds a recorded signal trace back into a SignalHub
+// Part of: Shared Platform Layer
+// Safety: Test and profiling tool; not for use on a hub driving a live display
+
+#ifndef AUTOMOTIVE_SIGNAL_TRACE_REPLAYER_H
+#define AUTOMOTIVE_SIGNAL_TRACE_REPLAYER_H
+
+#include "signal/SignalTrace.h"
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+
+namespace automotive {
+namespace signal {
+
+class SignalHub;
+
+/**
+ * @brief Replay counters
+ */
+struct TraceReplayStats {
+    quint64 updates{0};                ///< Single updates applied
+    quint64 batches{0};                ///< Batches applied via updateSignals()
+    quint64 batchedUpdates{0};         ///< Updates within those batches
+    quint64 ticks{0};                  ///< processTick() calls replayed
+    quint64 skipped{0};                ///< Records for signals unknown to the hub
+};
+
+/**
+ * @brief Deterministic replay of a SignalTraceRecorder trace
+ *
+ * Each record is applied the way it was recorded (single update, batch or
+ * tick), with the hub clock overridden to the recorded time, so freshness,
+ * rate-of-change and publish-interval decisions match the recording at
+ * any replay speed. Recorded times are shifted by a constant so the hub
+ * clock continues from its value at open().
+ *
+ * Signals are matched by identifier; records of signals the hub does not
+ * know are skipped and counted.
+ *
+ * Speed 1.0 replays in real time, N replays N times faster, and
+ * AS_FAST_AS_POSSIBLE applies the whole trace inside start(). Paced
+ * replay needs a running Qt event loop. Disable tick replay when a
+ * scheduler already calls processTick() on the hub.
+ *
+ * The hub keeps the last replayed time after finished(); call
+ * SignalHub::setClockOverride(-1) to return it to its own timer.
+ */
+class SignalTraceReplayer : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr double AS_FAST_AS_POSSIBLE = 0.0;
+
+    explicit SignalTraceReplayer(SignalHub* hub, QObject* parent = nullptr);
+    ~SignalTraceReplayer() override;
+
+    /**
+     * @brief Open a trace and map its signals onto the hub
+     * @return false (with @p error set) if the trace cannot be read
+     */
+    bool open(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Trace signals with no matching hub signal
+     */
+    int unmappedSignalCount() const { return m_unmapped; }
+
+    /**
+     * @brief Replay speed factor (default 1.0, AS_FAST_AS_POSSIBLE = 0)
+     */
+    void setSpeed(double factor);
+    double speed() const { return m_speed; }
+
+    /**
+     * @brief Call processTick() for recorded tick markers (default true)
+     */
+    void setReplayTicks(bool enabled) { m_replayTicks = enabled; }
+
+    /**
+     * @brief Start or resume replay at the current speed
+     */
+    void start();
+
+    /**
+     * @brief Pause paced replay (resume with start())
+     */
+    void stop();
+
+    /**
+     * @brief Apply every record up to and including @p traceTimeMs
+     * @param traceTimeMs Time in the trace's clock (TraceEvent::timestampMs)
+     * @return Number of records applied
+     *
+     * Steps the replay manually, e.g. in tests or a frame-stepping tool.
+     */
+    int replayUntil(qint64 traceTimeMs);
+
+    bool isRunning() const { return m_running; }
+    bool isFinished() const { return m_finished; }
+
+    /**
+     * @brief Trace time of the next record (-1 when finished)
+     */
+    qint64 nextTimestampMs() const { return m_hasNext ? m_next.timestampMs : -1; }
+
+    TraceReplayStats stats() const { return m_stats; }
+
+signals:
+    /**
+     * @brief Emitted once the last record has been applied
+     */
+    void finished();
+
+private slots:
+    void onTimerTick();
+
+private:
+    void fetchNext();
+    void apply(const TraceEvent& event);
+    void flushBatch();
+    void scheduleNext();
+    void finish();
+
+    SignalHub* m_hub;
+    SignalTraceReader m_reader;
+    QVector<SignalHandle> m_handles;   ///< Trace signal index -> hub handle
+    int m_unmapped{0};
+
+    TraceEvent m_next;
+    bool m_hasNext{false};
+    SignalBatch m_batch;               ///< Batch being reassembled
+    qint64 m_batchTimeMs{0};
+
+    qint64 m_timeOffsetMs{0};          ///< Hub time - trace time
+    double m_speed{1.0};
+    bool m_replayTicks{true};
+
+    QTimer m_timer;
+    QElapsedTimer m_clock;             ///< Wall time since (re)start
+    qint64 m_resumeTraceMs{0};         ///< Trace time at (re)start
+    bool m_running{false};
+    bool m_finished{false};
+
+    TraceReplayStats m_stats;
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_TRACE_REPLAYER_H
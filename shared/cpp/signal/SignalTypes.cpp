@@ -0,0 +1,135 @@
+// SignalTypes.cpp
+// Core signal type conversions
+
+#include "signal/SignalTypes.h"
+#include <cmath>
+
+namespace automotive {
+namespace signal {
+
+ScalarValue ScalarValue::convertedTo(SignalKind target) const
+{
+    if (target == kind) {
+        return *this;
+    }
+
+    switch (target) {
+    case SignalKind::Double:
+        return ScalarValue(toDouble());
+    case SignalKind::Int:
+        return ScalarValue(kind == SignalKind::Double
+                               ? static_cast<qint64>(std::llround(asDouble))
+                               : toInt());
+    case SignalKind::Enum:
+        return ScalarValue::fromEnum(kind == SignalKind::Double
+                                         ? static_cast<qint64>(std::llround(asDouble))
+                                         : toInt());
+    case SignalKind::Bool:
+        return ScalarValue(toBool());
+    case SignalKind::String:
+        break;
+    }
+
+    ScalarValue empty;
+    empty.kind = SignalKind::String;
+    return empty;
+}
+
+bool ScalarValue::operator==(const ScalarValue& other) const
+{
+    if (kind != other.kind) {
+        return false;
+    }
+
+    switch (kind) {
+    case SignalKind::Double: return asDouble == other.asDouble;
+    case SignalKind::Int:
+    case SignalKind::Enum:   return asInt == other.asInt;
+    case SignalKind::Bool:   return asBool == other.asBool;
+    case SignalKind::String: return true;
+    }
+    return false;
+}
+
+QString SignalValue::toString() const
+{
+    return value.kind == SignalKind::String ? text : scalarToString(value);
+}
+
+QVariant SignalValue::toVariant() const
+{
+    switch (value.kind) {
+    case SignalKind::Double: return QVariant(value.asDouble);
+    case SignalKind::Int:
+    case SignalKind::Enum:   return QVariant(value.asInt);
+    case SignalKind::Bool:   return QVariant(value.asBool);
+    case SignalKind::String: return QVariant(text);
+    }
+    return QVariant();
+}
+
+QString scalarToString(const ScalarValue& value)
+{
+    switch (value.kind) {
+    case SignalKind::Double: return QString::number(value.asDouble);
+    case SignalKind::Int:
+    case SignalKind::Enum:   return QString::number(value.asInt);
+    case SignalKind::Bool:   return value.asBool ? QStringLiteral("true")
+                                                 : QStringLiteral("false");
+    case SignalKind::String: break;
+    }
+    return QString();
+}
+
+ScalarValue scalarFromVariant(const QVariant& variant, SignalKind kind, bool* ok)
+{
+    bool converted = false;
+    ScalarValue result;
+
+    switch (kind) {
+    case SignalKind::Double:
+        result = ScalarValue(variant.toDouble(&converted));
+        break;
+    case SignalKind::Int:
+    case SignalKind::Enum:
+        {
+            // Accept fractional input for integral signals (rounded)
+            const double numeric = variant.toDouble(&converted);
+            result = ScalarValue(static_cast<qint64>(std::llround(numeric)))
+                         .convertedTo(kind);
+        }
+        break;
+    case SignalKind::Bool:
+        converted = variant.isValid();
+        result = ScalarValue(variant.toBool());
+        break;
+    case SignalKind::String:
+        converted = false;
+        break;
+    }
+
+    if (ok) *ok = converted;
+    return result;
+}
+
+ScalarValue scalarFromString(const QString& text, SignalKind kind, bool* ok)
+{
+    if (kind == SignalKind::Bool) {
+        const QString lowered = text.toLower();
+        if (lowered == QLatin1String("true") || lowered == QLatin1String("1")) {
+            if (ok) *ok = true;
+            return ScalarValue(true);
+        }
+        if (lowered == QLatin1String("false") || lowered == QLatin1String("0")) {
+            if (ok) *ok = true;
+            return ScalarValue(false);
+        }
+        if (ok) *ok = false;
+        return ScalarValue(false);
+    }
+
+    return scalarFromVariant(QVariant(text), kind, ok);
+}
+
+} // namespace signal
+} // namespace automotive
@@ -0,0 +1,248 @@
+// SignalTypes.h
+// Core signal type definitions
+// Part of: Shared Platform Layer
+// Safety: Value types for the safety-relevant signal chain
+
+#ifndef AUTOMOTIVE_SIGNAL_TYPES_H
+#define AUTOMOTIVE_SIGNAL_TYPES_H
+
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <cstdint>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Signal validity state
+ *
+ * Requirement: SR-CL-002 - Invalid signal ranges shall be clamped and flagged
+ */
+enum class SignalValidity : uint8_t {
+    Valid = 0,           ///< Signal is within range and fresh
+    Stale,               ///< Signal has not been updated within freshness window
+    OutOfRange,          ///< Signal value exceeds defined limits
+    Invalid,             ///< Signal failed validation (plausibility, etc.)
+    NotAvailable         ///< Signal source not connected
+};
+
+/**
+ * @brief Storage kind of a signal value
+ *
+ * Declared per SignalDefinition. Numeric, boolean and enum signals are held
+ * in a POD ScalarValue; only String signals carry a QString.
+ */
+enum class SignalKind : uint8_t {
+    Double = 0,          ///< Floating-point measurement (speed, SOC, ...)
+    Int,                 ///< Integral measurement (RPM, durations, ...)
+    Bool,                ///< On/off state (telltales, flags)
+    Enum,                ///< Integral code from a closed set (modes, states)
+    String               ///< Free text (gear label, media metadata)
+};
+
+/**
+ * @brief Dense handle to a registered signal
+ *
+ * Returned by SignalHub::registerSignal(). The handle indexes directly into
+ * the hub's signal table, so hot-path producers and consumers resolve the
+ * string identifier once and avoid hashing it on every update.
+ */
+struct SignalHandle {
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index{INVALID_INDEX};     ///< Registration index in the hub
+
+    constexpr SignalHandle() = default;
+    constexpr explicit SignalHandle(uint32_t idx) : index(idx) {}
+
+    constexpr bool isValid() const { return index != INVALID_INDEX; }
+    constexpr explicit operator bool() const { return isValid(); }
+
+    constexpr bool operator==(SignalHandle other) const { return index == other.index; }
+    constexpr bool operator!=(SignalHandle other) const { return index != other.index; }
+};
+
+inline size_t qHash(SignalHandle handle, size_t seed = 0) noexcept
+{
+    return ::qHash(handle.index, seed);
+}
+
+/**
+ * @brief Typed scalar signal value
+ *
+ * Trivially copyable tagged union used for all non-string signal storage,
+ * so the update path never touches a QVariant or the heap.
+ */
+struct ScalarValue {
+    SignalKind kind{SignalKind::Double};
+    union {
+        double asDouble;               ///< Double kind
+        qint64 asInt;                  ///< Int and Enum kinds
+        bool asBool;                   ///< Bool kind
+    };
+
+    constexpr ScalarValue() : asDouble(0.0) {}
+    constexpr ScalarValue(double v) : kind(SignalKind::Double), asDouble(v) {}
+    constexpr ScalarValue(int v) : kind(SignalKind::Int), asInt(v) {}
+    constexpr ScalarValue(qint64 v) : kind(SignalKind::Int), asInt(v) {}
+    constexpr ScalarValue(bool v) : kind(SignalKind::Bool), asBool(v) {}
+    ScalarValue(const char*) = delete;  // Prevent pointer-to-bool conversion
+
+    static constexpr ScalarValue fromEnum(qint64 code) {
+        ScalarValue v(code);
+        v.kind = SignalKind::Enum;
+        return v;
+    }
+
+    constexpr double toDouble() const {
+        return kind == SignalKind::Double ? asDouble
+             : kind == SignalKind::Bool   ? (asBool ? 1.0 : 0.0)
+             : kind == SignalKind::String ? 0.0
+             : static_cast<double>(asInt);
+    }
+
+    constexpr qint64 toInt() const {
+        return kind == SignalKind::Double ? static_cast<qint64>(asDouble)
+             : kind == SignalKind::Bool   ? (asBool ? 1 : 0)
+             : kind == SignalKind::String ? 0
+             : asInt;
+    }
+
+    constexpr bool toBool() const {
+        return kind == SignalKind::Double ? asDouble != 0.0
+             : kind == SignalKind::Bool   ? asBool
+             : kind == SignalKind::String ? false
+             : asInt != 0;
+    }
+
+    constexpr bool isNumeric() const {
+        return kind == SignalKind::Double || kind == SignalKind::Int ||
+               kind == SignalKind::Enum;
+    }
+
+    /**
+     * @brief Convert to another storage kind
+     *
+     * Int and Enum conversions from Double round to nearest. Converting to
+     * String yields a zero value; text lives outside ScalarValue.
+     */
+    ScalarValue convertedTo(SignalKind target) const;
+
+    bool operator==(const ScalarValue& other) const;
+    bool operator!=(const ScalarValue& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Signal metadata and value container
+ */
+struct SignalValue {
+    ScalarValue value;                 ///< Current value (non-string kinds)
+    QString text;                      ///< Current value (String kind only)
+    SignalValidity validity{SignalValidity::NotAvailable};
+    qint64 timestampMs{0};             ///< Monotonic timestamp of last update
+    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp (if available)
+    uint32_t updateCount{0};           ///< Number of updates received
+
+    bool isValid() const { return validity == SignalValidity::Valid; }
+    bool isDisplayable() const { return validity == SignalValidity::Valid ||
+                                        validity == SignalValidity::Stale; }
+
+    double toDouble() const { return value.toDouble(); }
+    qint64 toInt() const { return value.toInt(); }
+    bool toBool() const { return value.toBool(); }
+
+    /**
+     * @brief Text form of the value (formatted number for non-string kinds)
+     */
+    QString toString() const;
+
+    /**
+     * @brief Convert to QVariant
+     *
+     * Only for the QML/scripting boundary; the hub never stores variants.
+     */
+    QVariant toVariant() const;
+};
+
+/**
+ * @brief One entry of a batched update (see SignalHub::updateSignals)
+ *
+ * Non-string kinds take @c value (converted to the declared kind); String
+ * kinds take @c text.
+ */
+struct SignalUpdate {
+    SignalHandle handle;               ///< Target signal
+    ScalarValue value;                 ///< New value (non-string kinds)
+    QString text;                      ///< New value (String kind only)
+    qint64 sourceTimestampMs{0};       ///< Source-provided timestamp (if available)
+};
+
+/**
+ * @brief Ordered set of updates committed together (e.g. one CAN/IPC frame)
+ */
+using SignalBatch = QVector<SignalUpdate>;
+
+/**
+ * @brief Committed change of one signal, as reported in batched notifications
+ */
+struct SignalChange {
+    SignalHandle handle;               ///< Changed signal
+    QString signalId;                  ///< Identifier of the changed signal
+    SignalValue value;                 ///< Value after the change
+    SignalValidity oldValidity{SignalValidity::NotAvailable}; ///< Validity before the change
+
+    bool validityChanged() const { return oldValidity != value.validity; }
+};
+
+/**
+ * @brief Signal definition with validation parameters
+ */
+struct SignalDefinition {
+    QString id;                        ///< Unique signal identifier
+    QString name;                      ///< Human-readable name
+    QString unit;                      ///< Unit of measurement
+    SignalKind kind{SignalKind::Double}; ///< Storage kind of the value
+    QVariant minValue;                 ///< Minimum valid value
+    QVariant maxValue;                 ///< Maximum valid value
+    QVariant defaultValue;             ///< Default/fallback value
+    qint64 freshnessMs{300};           ///< Freshness timeout in ms (SR-CL-001: 300ms)
+    double maxRateOfChange{0.0};       ///< Maximum allowed rate of change (0 = disabled)
+    bool isSafetyCritical{false};      ///< Safety-critical flag
+    int historyCapacity{0};            ///< Samples kept for trend queries (0 = no history)
+    int historyDecimation{1};          ///< Store every Nth valid update in the history
+
+    // Change suppression for noisy numeric signals. Suppressed updates are
+    // still stored and refresh freshness; they only skip notification.
+    double deadbandAbsolute{0.0};      ///< Notify only if |change| >= this (0 = off)
+    double deadbandRelative{0.0};      ///< Same, as a fraction of the last notified value (0 = off)
+    double displayResolution{0.0};     ///< Quantization step for change detection (0 = off)
+    qint64 minPublishIntervalMs{0};    ///< Minimum time between notifications (0 = off)
+};
+
+/**
+ * @brief Format a scalar value as text
+ */
+QString scalarToString(const ScalarValue& value);
+
+/**
+ * @brief Convert a QVariant into a scalar of the given kind
+ * @param variant Source value
+ * @param kind Target storage kind (must not be String)
+ * @param ok Set to false if the variant is not convertible
+ */
+ScalarValue scalarFromVariant(const QVariant& variant, SignalKind kind, bool* ok = nullptr);
+
+/**
+ * @brief Parse text into a scalar of the given kind
+ * @param text Source text
+ * @param kind Target storage kind (must not be String)
+ * @param ok Set to false if the text is not convertible
+ */
+ScalarValue scalarFromString(const QString& text, SignalKind kind, bool* ok = nullptr);
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_TYPES_H
@@ -0,0 +1,233 @@
+// SignalValidationKernel.cpp
+// Vectorized range/rate validation implementation
+//
+// Every variant evaluates, per element:
+//   clamped    = min(max(value, lo), hi)   with qMax/qMin operand order
+//   outOfRange = value < lo || value > hi
+//   rateFail   = dt > 0 && !(|value - prev| * 1000 / dt <= maxRate)
+// which mirrors SignalHub::validateRange/clampValue/validateRateOfChange.
+
+#include "signal/SignalValidationKernel.h"
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AUTOMOTIVE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AUTOMOTIVE_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#define AUTOMOTIVE_KERNEL_HAS_AVX2 1
+#elif defined(__AVX2__)
+#define AUTOMOTIVE_KERNEL_TARGET_AVX2
+#define AUTOMOTIVE_KERNEL_HAS_AVX2 1
+#endif
+
+namespace automotive {
+namespace signal {
+
+namespace {
+
+void clearMasks(const NumericValidationBatch& batch)
+{
+    const int words = (batch.count + 63) / 64;
+    std::memset(batch.outOfRangeMask, 0, sizeof(quint64) * words);
+    std::memset(batch.rateViolationMask, 0, sizeof(quint64) * words);
+}
+
+void setBit(quint64* mask, int index)
+{
+    mask[index / 64] |= quint64(1) << (index % 64);
+}
+
+void validateScalar(const NumericValidationBatch& batch, int begin)
+{
+    for (int i = begin; i < batch.count; ++i) {
+        const double value = batch.values[i];
+        const double lo = batch.minValues[i];
+        const double hi = batch.maxValues[i];
+
+        double clamped = (value < lo) ? lo : value;    // qMax(value, lo)
+        clamped = (clamped < hi) ? clamped : hi;       // qMin(clamped, hi)
+        batch.clampedValues[i] = clamped;
+
+        if (value < lo || value > hi) {
+            setBit(batch.outOfRangeMask, i);
+        }
+
+        const double dt = batch.deltaTimesMs[i];
+        if (dt > 0.0) {
+            const double rate = std::abs(value - batch.previousValues[i]) * 1000.0 / dt;
+            if (!(rate <= batch.maxRates[i])) {
+                setBit(batch.rateViolationMask, i);
+            }
+        }
+    }
+}
+
+#ifdef AUTOMOTIVE_KERNEL_X86
+
+void validateSse2(const NumericValidationBatch& batch)
+{
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d thousand = _mm_set1_pd(1000.0);
+
+    int i = 0;
+    for (; i + 2 <= batch.count; i += 2) {
+        const __m128d value = _mm_loadu_pd(batch.values + i);
+        const __m128d lo = _mm_loadu_pd(batch.minValues + i);
+        const __m128d hi = _mm_loadu_pd(batch.maxValues + i);
+
+        // max(lo, value) returns value when value is NaN, like qMax(value, lo)
+        const __m128d clamped = _mm_min_pd(_mm_max_pd(lo, value), hi);
+        _mm_storeu_pd(batch.clampedValues + i, clamped);
+
+        const __m128d outOfRange = _mm_or_pd(_mm_cmplt_pd(value, lo),
+                                             _mm_cmpgt_pd(value, hi));
+
+        const __m128d dt = _mm_loadu_pd(batch.deltaTimesMs + i);
+        const __m128d active = _mm_cmpgt_pd(dt, zero);
+        const __m128d safeDt = _mm_or_pd(_mm_and_pd(active, dt), _mm_andnot_pd(active, one));
+        const __m128d delta = _mm_andnot_pd(signMask,
+                                            _mm_sub_pd(value, _mm_loadu_pd(batch.previousValues + i)));
+        const __m128d rate = _mm_div_pd(_mm_mul_pd(delta, thousand), safeDt);
+        const __m128d violation = _mm_and_pd(active,
+                                             _mm_cmpnle_pd(rate, _mm_loadu_pd(batch.maxRates + i)));
+
+        const int shift = i % 64;
+        batch.outOfRangeMask[i / 64] |= quint64(_mm_movemask_pd(outOfRange)) << shift;
+        batch.rateViolationMask[i / 64] |= quint64(_mm_movemask_pd(violation)) << shift;
+    }
+
+    validateScalar(batch, i);
+}
+
+#ifdef AUTOMOTIVE_KERNEL_HAS_AVX2
+
+AUTOMOTIVE_KERNEL_TARGET_AVX2
+void validateAvx2(const NumericValidationBatch& batch)
+{
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d thousand = _mm256_set1_pd(1000.0);
+
+    int i = 0;
+    for (; i + 4 <= batch.count; i += 4) {
+        const __m256d value = _mm256_loadu_pd(batch.values + i);
+        const __m256d lo = _mm256_loadu_pd(batch.minValues + i);
+        const __m256d hi = _mm256_loadu_pd(batch.maxValues + i);
+
+        const __m256d clamped = _mm256_min_pd(_mm256_max_pd(lo, value), hi);
+        _mm256_storeu_pd(batch.clampedValues + i, clamped);
+
+        const __m256d outOfRange = _mm256_or_pd(_mm256_cmp_pd(value, lo, _CMP_LT_OQ),
+                                                _mm256_cmp_pd(value, hi, _CMP_GT_OQ));
+
+        const __m256d dt = _mm256_loadu_pd(batch.deltaTimesMs + i);
+        const __m256d active = _mm256_cmp_pd(dt, zero, _CMP_GT_OQ);
+        const __m256d safeDt = _mm256_blendv_pd(one, dt, active);
+        const __m256d delta = _mm256_andnot_pd(signMask,
+                                               _mm256_sub_pd(value, _mm256_loadu_pd(batch.previousValues + i)));
+        const __m256d rate = _mm256_div_pd(_mm256_mul_pd(delta, thousand), safeDt);
+        const __m256d violation = _mm256_and_pd(active,
+                                                _mm256_cmp_pd(rate, _mm256_loadu_pd(batch.maxRates + i),
+                                                              _CMP_NLE_UQ));
+
+        const int shift = i % 64;
+        batch.outOfRangeMask[i / 64] |= quint64(_mm256_movemask_pd(outOfRange)) << shift;
+        batch.rateViolationMask[i / 64] |= quint64(_mm256_movemask_pd(violation)) << shift;
+    }
+
+    validateScalar(batch, i);
+}
+
+#endif // AUTOMOTIVE_KERNEL_HAS_AVX2
+#endif // AUTOMOTIVE_KERNEL_X86
+
+bool isSupported(ValidationKernelIsa isa)
+{
+    switch (isa) {
+    case ValidationKernelIsa::Scalar:
+        return true;
+    case ValidationKernelIsa::Sse2:
+#ifdef AUTOMOTIVE_KERNEL_X86
+        return true;   // Baseline on x86-64
+#else
+        return false;
+#endif
+    case ValidationKernelIsa::Avx2:
+#if defined(AUTOMOTIVE_KERNEL_X86) && defined(AUTOMOTIVE_KERNEL_HAS_AVX2)
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("avx2");
+#else
+        return true;   // Built with /arch:AVX2
+#endif
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+} // namespace
+
+ValidationKernelIsa bestValidationKernelIsa()
+{
+    static const ValidationKernelIsa best = isSupported(ValidationKernelIsa::Avx2)
+                                                ? ValidationKernelIsa::Avx2
+                                          : isSupported(ValidationKernelIsa::Sse2)
+                                                ? ValidationKernelIsa::Sse2
+                                                : ValidationKernelIsa::Scalar;
+    return best;
+}
+
+const char* validationKernelIsaName(ValidationKernelIsa isa)
+{
+    switch (isa) {
+    case ValidationKernelIsa::Scalar: return "scalar";
+    case ValidationKernelIsa::Sse2:   return "sse2";
+    case ValidationKernelIsa::Avx2:   return "avx2";
+    }
+    return "unknown";
+}
+
+void validateNumericBatch(const NumericValidationBatch& batch)
+{
+    validateNumericBatch(batch, bestValidationKernelIsa());
+}
+
+void validateNumericBatch(const NumericValidationBatch& batch, ValidationKernelIsa isa)
+{
+    if (batch.count <= 0) {
+        return;
+    }
+
+    clearMasks(batch);
+
+    if (!isSupported(isa)) {
+        isa = bestValidationKernelIsa();
+    }
+
+    switch (isa) {
+#ifdef AUTOMOTIVE_KERNEL_X86
+#ifdef AUTOMOTIVE_KERNEL_HAS_AVX2
+    case ValidationKernelIsa::Avx2:
+        validateAvx2(batch);
+        return;
+#endif
+    case ValidationKernelIsa::Sse2:
+        validateSse2(batch);
+        return;
+#endif
+    default:
+        validateScalar(batch, 0);
+        return;
+    }
+}
+
+} // namespace signal
+} // namespace automotive
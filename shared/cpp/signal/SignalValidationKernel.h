@@ -0,0 +1,72 @@
+// SignalValidationKernel.h
+// Vectorized range/rate validation for batches of numeric signals
+// Part of: Shared Platform Layer
+// Safety: Same decisions as the scalar SignalHub checks (SR-CL-002)
+
+#ifndef AUTOMOTIVE_SIGNAL_VALIDATION_KERNEL_H
+#define AUTOMOTIVE_SIGNAL_VALIDATION_KERNEL_H
+
+#include <QtGlobal>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief Struct-of-arrays view of a numeric validation batch
+ *
+ * All arrays hold @c count elements; the masks hold (count + 63) / 64
+ * words with bit (i % 64) of word (i / 64) describing element i.
+ */
+struct NumericValidationBatch {
+    int count{0};
+
+    // Inputs
+    const double* values{nullptr};          ///< New values
+    const double* minValues{nullptr};       ///< Lower bounds (-inf = none)
+    const double* maxValues{nullptr};       ///< Upper bounds (+inf = none)
+    const double* previousValues{nullptr};  ///< Reference values for the rate check
+    const double* maxRates{nullptr};        ///< Allowed change per second
+    const double* deltaTimesMs{nullptr};    ///< Time since reference; <= 0 skips the rate check
+
+    // Outputs
+    double* clampedValues{nullptr};         ///< Values clamped to [min, max]
+    quint64* outOfRangeMask{nullptr};       ///< Set where value < min or value > max
+    quint64* rateViolationMask{nullptr};    ///< Set where |value - previous| / dt > maxRate
+};
+
+/**
+ * @brief Instruction set used by the kernel
+ */
+enum class ValidationKernelIsa : uint8_t {
+    Scalar = 0,
+    Sse2,
+    Avx2
+};
+
+/**
+ * @brief Best instruction set supported by the running CPU
+ */
+ValidationKernelIsa bestValidationKernelIsa();
+
+/**
+ * @brief Human-readable name of an instruction set
+ */
+const char* validationKernelIsaName(ValidationKernelIsa isa);
+
+/**
+ * @brief Clamp, range-flag and rate-check a batch using the best ISA
+ */
+void validateNumericBatch(const NumericValidationBatch& batch);
+
+/**
+ * @brief Validate a batch with a specific ISA
+ *
+ * Falls back to the best supported ISA if @p isa is not available. All
+ * variants produce bit-identical results (including NaN handling).
+ */
+void validateNumericBatch(const NumericValidationBatch& batch, ValidationKernelIsa isa);
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_VALIDATION_KERNEL_H
@@ -0,0 +1,69 @@
+// SignalView.cpp
+// Rate-limited signal view implementation
+
+#include "signal/SignalView.h"
+#include <algorithm>
+#include <cmath>
+
+namespace automotive {
+namespace signal {
+
+void ViewAccumulator::add(double value)
+{
+    if (count == 0) {
+        minimum = value;
+        maximum = value;
+    } else {
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+    sum += value;
+    ++count;
+}
+
+void ViewAccumulator::merge(const ViewAccumulator& other)
+{
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    minimum = std::min(minimum, other.minimum);
+    maximum = std::max(maximum, other.maximum);
+    sum += other.sum;
+    count += other.count;
+}
+
+SignalView::SignalView(const QString& name, const QVector<SignalHandle>& handles,
+                       const SignalViewPolicy& policy, SignalViewCallback callback)
+    : m_name(name)
+    , m_policy(policy)
+    , m_periodMs(policy.maxRateHz > 0.0
+                     ? static_cast<qint64>(std::llround(1000.0 / policy.maxRateHz)) : 0)
+    , m_callback(std::move(callback))
+{
+    m_entries.reserve(handles.size());
+    for (const SignalHandle handle : handles) {
+        Entry entry;
+        entry.handle = handle;
+        m_entries.append(entry);
+    }
+    m_samples.reserve(handles.size());
+    m_stats.name = name;
+    m_stats.maxRateHz = policy.maxRateHz;
+}
+
+QVector<SignalHandle> SignalView::signalHandles() const
+{
+    QVector<SignalHandle> handles;
+    handles.reserve(m_entries.size());
+    for (const Entry& entry : m_entries) {
+        handles.append(entry.handle);
+    }
+    return handles;
+}
+
+} // namespace signal
+} // namespace automotive
@@ -0,0 +1,143 @@
+// SignalView.h
+// Rate-limited, aggregated view of a signal set for slow consumers
+// Part of: Shared Platform Layer
+// Safety: Not for the safety path; serviced from the hub tick, no per-update work
+
+#ifndef AUTOMOTIVE_SIGNAL_VIEW_H
+#define AUTOMOTIVE_SIGNAL_VIEW_H
+
+#include "signal/SignalTypes.h"
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <functional>
+
+namespace automotive {
+namespace signal {
+
+/**
+ * @brief How a view condenses the updates of one delivery period
+ */
+enum class ViewAggregation {
+    Latest,                            ///< Latest committed value only
+    Average,                           ///< Mean of the period's Valid updates
+    MinMax                             ///< Extremes of the period's Valid updates
+};
+
+/**
+ * @brief Delivery policy of a SignalView
+ */
+struct SignalViewPolicy {
+    double maxRateHz{1.0};             ///< Deliveries per second (0 = every tick)
+    ViewAggregation aggregation{ViewAggregation::Latest};
+};
+
+/**
+ * @brief One signal of a view delivery
+ */
+struct SignalViewSample {
+    SignalHandle handle;               ///< Signal
+    SignalValue value;                 ///< Latest committed value and validity
+    double average{0.0};               ///< Mean over the period (Average)
+    double minimum{0.0};               ///< Smallest value over the period (MinMax)
+    double maximum{0.0};               ///< Largest value over the period (MinMax)
+    quint64 updates{0};                ///< Updates committed since the previous delivery
+};
+
+/**
+ * @brief Delivery counters of one view
+ */
+struct SignalViewStats {
+    QString name;                      ///< View name given at creation
+    double maxRateHz{0.0};             ///< Configured rate limit
+    quint64 deliveries{0};             ///< Callback invocations
+    quint64 samples{0};                ///< Samples delivered
+    quint64 updates{0};                ///< Source updates condensed into them
+};
+
+/**
+ * @brief Callback receiving a view delivery
+ */
+using SignalViewCallback = std::function<void(const QVector<SignalViewSample>& samples)>;
+
+/**
+ * @brief Running sum/min/max of Valid values
+ */
+struct ViewAccumulator {
+    double sum{0.0};
+    double minimum{0.0};
+    double maximum{0.0};
+    int count{0};
+
+    void add(double value);
+    void merge(const ViewAccumulator& other);
+    void reset() { count = 0; sum = 0.0; }
+};
+
+/**
+ * @brief Decimated view of a signal set (owned by SignalHub)
+ *
+ * Created by SignalHub::createView() for a consumer that only needs a few
+ * updates per second (infotainment mirror, event log, telemetry upload).
+ * The hub services all views from processTick(): at most once per
+ * 1 / maxRateHz it hands the view's callback one sample for every signal
+ * committed or changed in validity since the previous delivery. Nothing
+ * runs per update for Latest views; Average and MinMax views add one
+ * accumulate to the update of their signals.
+ *
+ * Deliveries run on the ticking thread after the hub lock is released.
+ * Counters are read through SignalHub::viewStats().
+ *
+ * The hub shares ownership with the delivery in progress, so a view
+ * removed from any thread or callback stays alive until that delivery
+ * returns; it receives no delivery after its removal.
+ */
+class SignalView {
+public:
+    SignalView(const QString& name, const QVector<SignalHandle>& handles,
+               const SignalViewPolicy& policy, SignalViewCallback callback);
+
+    SignalView(const SignalView&) = delete;
+    SignalView& operator=(const SignalView&) = delete;
+
+    const QString& name() const { return m_name; }
+    const SignalViewPolicy& policy() const { return m_policy; }
+    QVector<SignalHandle> signalHandles() const;
+
+    /**
+     * @brief Minimum time between deliveries in ms (0 = every tick)
+     */
+    qint64 periodMs() const { return m_periodMs; }
+
+private:
+    friend class SignalHub;
+
+    struct Entry {
+        SignalHandle handle;
+        uint32_t deliveredCount{0};    ///< updateCount at the last delivery
+        SignalValidity deliveredValidity{SignalValidity::NotAvailable};
+        bool delivered{false};
+        ViewAccumulator period;        ///< Valid values since the last delivery
+    };
+
+    bool aggregates() const { return m_policy.aggregation != ViewAggregation::Latest; }
+
+    const QString m_name;
+    const SignalViewPolicy m_policy;
+    const qint64 m_periodMs;
+    const SignalViewCallback m_callback;
+
+    // Guarded by the hub's writer lock
+    QVector<Entry> m_entries;
+    QVector<SignalViewSample> m_samples;   ///< Delivery being handed out
+    qint64 m_lastDeliveryMs{0};
+    bool m_hasDelivered{false};
+    SignalViewStats m_stats;
+
+    std::atomic<bool> m_removed{false};    ///< Set by removeView(); checked before each callback
+};
+
+} // namespace signal
+} // namespace automotive
+
+#endif // AUTOMOTIVE_SIGNAL_VIEW_H
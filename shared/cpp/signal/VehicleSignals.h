@@ -6,6 +6,7 @@
 #define AUTOMOTIVE_VEHICLE_SIGNALS_H
 
 #include "signal/SignalHub.h"
+#include "signal/SignalCatalog.h"
 #include <QString>
 
 namespace automotive {
@@ -100,6 +101,149 @@ namespace SignalIds {
     constexpr const char* NAV_ETA = "nav.eta";
 }
 
+/**
+ * @brief Cluster signal catalog, in handle order
+ *
+ * Registered by VehicleSignalFactory::registerClusterSignals(); entry i
+ * gets handle i, which the typed tags in Signals rely on.
+ */
+inline constexpr SignalSpec CLUSTER_CATALOG[] = {
+    // Speed and motion
+    SignalSpec::numeric(SignalIds::VEHICLE_SPEED, "Vehicle Speed", "km/h", 0.0, 400.0, 300)
+        .withRate(50.0).critical(),                    // SR-CL-001: stale within 300ms
+    SignalSpec::numeric(SignalIds::ENGINE_RPM, "Engine RPM", "rpm", 0.0, 8000.0, 200)
+        .ofKind(SignalKind::Int).withRate(5000.0),
+    SignalSpec::numeric(SignalIds::ODOMETER, "Odometer", "km", 0.0, 9999999.0, 1000),
+
+    // Powertrain
+    SignalSpec::text(SignalIds::GEAR_POSITION, "Gear Position", "P", 500).critical(),
+
+    // Energy
+    SignalSpec::numeric(SignalIds::BATTERY_SOC, "Battery State of Charge", "%", 0.0, 100.0, 5000),
+    SignalSpec::numeric(SignalIds::BATTERY_RANGE, "Battery Range", "km", 0.0, 1000.0, 5000),
+    SignalSpec::numeric(SignalIds::POWER_CONSUMPTION, "Power Consumption", "kW", -200.0, 500.0, 500)
+        .withHistory(600, 2)                           // 60 s at 20 Hz, decimated to 10 Hz
+        .withDeadband(1.0)                             // kW; finer changes are noise
+        .withMinInterval(100),
+
+    // Telltales
+    SignalSpec::boolean(SignalIds::TELLTALE_TURN_LEFT, "Turn Left", 1000),
+    SignalSpec::boolean(SignalIds::TELLTALE_TURN_RIGHT, "Turn Right", 1000),
+    SignalSpec::boolean(SignalIds::TELLTALE_HAZARD, "Hazard", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_HIGH_BEAM, "High Beam", 1000),
+    SignalSpec::boolean(SignalIds::TELLTALE_LOW_BEAM, "Low Beam", 1000),
+    SignalSpec::boolean(SignalIds::TELLTALE_SEATBELT, "Seatbelt", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_DOOR_OPEN, "Door Open", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_ENGINE_CHECK, "Engine Check", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_ABS, "ABS", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_AIRBAG, "Airbag", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_TIRE_PRESSURE, "Tire Pressure", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_BATTERY, "Battery Warning", 500).critical(),
+    SignalSpec::boolean(SignalIds::TELLTALE_TEMP, "Temperature Warning", 500).critical(),
+
+    // ADAS
+    SignalSpec::boolean(SignalIds::ADAS_ENABLED, "ADAS Enabled", 500).critical(),
+    SignalSpec::boolean(SignalIds::ADAS_ACTIVE, "ADAS Active", 200).critical(),
+
+    // Environment
+    SignalSpec::numeric(SignalIds::OUTSIDE_TEMP, "Outside Temperature", "C", -50.0, 70.0, 10000)
+        .withDefault(20.0)
+        .withResolution(1.0)                           // Shown in whole degrees
+        .withMinInterval(1000),
+};
+
+/**
+ * @brief Typed tags for the cluster catalog (see SignalHub::get<>())
+ */
+namespace Signals {
+    struct VehicleSpeed : CatalogSignal<0, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::VEHICLE_SPEED;
+    };
+    struct EngineRpm : CatalogSignal<1, SignalKind::Int> {
+        static constexpr const char* id = SignalIds::ENGINE_RPM;
+    };
+    struct Odometer : CatalogSignal<2, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::ODOMETER;
+    };
+    struct GearPosition : CatalogSignal<3, SignalKind::String> {
+        static constexpr const char* id = SignalIds::GEAR_POSITION;
+    };
+    struct BatterySoc : CatalogSignal<4, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::BATTERY_SOC;
+    };
+    struct BatteryRange : CatalogSignal<5, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::BATTERY_RANGE;
+    };
+    struct PowerConsumption : CatalogSignal<6, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::POWER_CONSUMPTION;
+    };
+    struct TelltaleTurnLeft : CatalogSignal<7, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_TURN_LEFT;
+    };
+    struct TelltaleTurnRight : CatalogSignal<8, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_TURN_RIGHT;
+    };
+    struct TelltaleHazard : CatalogSignal<9, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_HAZARD;
+    };
+    struct TelltaleHighBeam : CatalogSignal<10, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_HIGH_BEAM;
+    };
+    struct TelltaleLowBeam : CatalogSignal<11, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_LOW_BEAM;
+    };
+    struct TelltaleSeatbelt : CatalogSignal<12, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_SEATBELT;
+    };
+    struct TelltaleDoorOpen : CatalogSignal<13, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_DOOR_OPEN;
+    };
+    struct TelltaleEngineCheck : CatalogSignal<14, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_ENGINE_CHECK;
+    };
+    struct TelltaleAbs : CatalogSignal<15, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_ABS;
+    };
+    struct TelltaleAirbag : CatalogSignal<16, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_AIRBAG;
+    };
+    struct TelltaleTirePressure : CatalogSignal<17, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_TIRE_PRESSURE;
+    };
+    struct TelltaleBattery : CatalogSignal<18, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_BATTERY;
+    };
+    struct TelltaleTemp : CatalogSignal<19, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::TELLTALE_TEMP;
+    };
+    struct AdasEnabled : CatalogSignal<20, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::ADAS_ENABLED;
+    };
+    struct AdasActive : CatalogSignal<21, SignalKind::Bool> {
+        static constexpr const char* id = SignalIds::ADAS_ACTIVE;
+    };
+    struct OutsideTemp : CatalogSignal<22, SignalKind::Double> {
+        static constexpr const char* id = SignalIds::OUTSIDE_TEMP;
+    };
+}
+
+static_assert(catalogIdsUnique(CLUSTER_CATALOG), "Duplicate signal id in CLUSTER_CATALOG");
+static_assert(sizeof(CLUSTER_CATALOG) / sizeof(CLUSTER_CATALOG[0]) == 23,
+              "Add a Signals tag for every CLUSTER_CATALOG entry");
+static_assert(catalogMatches<
+                  Signals::VehicleSpeed, Signals::EngineRpm, Signals::Odometer,
+                  Signals::GearPosition, Signals::BatterySoc, Signals::BatteryRange,
+                  Signals::PowerConsumption, Signals::TelltaleTurnLeft,
+                  Signals::TelltaleTurnRight, Signals::TelltaleHazard,
+                  Signals::TelltaleHighBeam, Signals::TelltaleLowBeam,
+                  Signals::TelltaleSeatbelt, Signals::TelltaleDoorOpen,
+                  Signals::TelltaleEngineCheck, Signals::TelltaleAbs,
+                  Signals::TelltaleAirbag, Signals::TelltaleTirePressure,
+                  Signals::TelltaleBattery, Signals::TelltaleTemp,
+                  Signals::AdasEnabled, Signals::AdasActive,
+                  Signals::OutsideTemp>(CLUSTER_CATALOG),
+              "Signals tags out of sync with CLUSTER_CATALOG");
+
 /**
  * @brief Factory for creating standard vehicle signal definitions
  */
@@ -107,7 +251,9 @@ class VehicleSignalFactory {
 public:
     /**
      * @brief Register all standard cluster signals with the hub
-     * @param hub Signal hub to register with
+     * @param hub Signal hub to register with (must be empty)
+     *
+     * Copies CLUSTER_CATALOG, so handles match the Signals tags.
      */
     static void registerClusterSignals(SignalHub& hub);
 
@@ -0,0 +1,108 @@
+// bench_ipc_broadcast.cpp
+// IpcServer fan-out: per-client serialize vs serialize-once broadcast
+// Connects N local clients and measures the sender-side cost of one
+// broadcast for several payload sizes
+
+#include "ipc/IpcServer.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QVector>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+using namespace automotive::ipc;
+
+namespace {
+
+constexpr int kClientCounts[] = {1, 2, 4, 8};
+constexpr int kPayloadSizes[] = {64, 1024, 16 * 1024};
+constexpr int kBroadcasts = 2000;
+constexpr int kDrainInterval = 32;     // Let clients read between batches
+
+bool waitFor(const std::function<bool()>& condition, int timeoutMs = 5000)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!condition()) {
+        if (timer.elapsed() > timeoutMs) {
+            return false;
+        }
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    }
+    return true;
+}
+
+// Times only the send calls; socket draining happens outside the clock
+template<typename Function>
+double nsPerBroadcast(Function&& send)
+{
+    std::chrono::steady_clock::duration total{};
+    for (int i = 0; i < kBroadcasts; ++i) {
+        const auto begin = std::chrono::steady_clock::now();
+        send();
+        total += std::chrono::steady_clock::now() - begin;
+        if (i % kDrainInterval == kDrainInterval - 1) {
+            QCoreApplication::processEvents();
+        }
+    }
+    QCoreApplication::processEvents();
+    return std::chrono::duration<double, std::nano>(total).count() / kBroadcasts;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const QString serverName = QStringLiteral("automotive_bench_broadcast");
+    std::printf("IpcServer broadcast (%d broadcasts per cell)\n\n", kBroadcasts);
+    std::printf("%8s %10s | %16s | %16s | %8s\n",
+                "clients", "payload", "per-client ns", "broadcast ns", "speedup");
+
+    for (int clientCount : kClientCounts) {
+        IpcServer server;
+        QVector<IpcChannel*> serverChannels;
+        QObject::connect(&server, &IpcServer::clientConnected,
+                         [&](IpcChannel* channel) { serverChannels.append(channel); });
+        if (!server.listen(serverName)) {
+            std::printf("listen failed: %s\n", qPrintable(server.lastError()));
+            return 1;
+        }
+
+        QVector<IpcChannel*> clients;
+        for (int i = 0; i < clientCount; ++i) {
+            auto* client = new IpcChannel(&app);
+            client->connectToServer(serverName);
+            clients.append(client);
+        }
+        if (!waitFor([&]() { return server.clientCount() == clientCount; })) {
+            std::printf("only %d of %d clients connected\n", server.clientCount(), clientCount);
+            return 1;
+        }
+
+        for (int payloadSize : kPayloadSizes) {
+            IpcMessage message(MessageType::SignalBatch);
+            message.setValue(QStringLiteral("data"), QByteArray(payloadSize, 'x'));
+
+            const double perClientNs = nsPerBroadcast([&]() {
+                for (IpcChannel* channel : qAsConst(serverChannels)) {
+                    channel->send(message);            // serialize per client
+                }
+            });
+            const double broadcastNs = nsPerBroadcast([&]() { server.broadcast(message); });
+
+            std::printf("%8d %10d | %16.0f | %16.0f | %7.2fx\n", clientCount, payloadSize,
+                        perClientNs, broadcastNs, perClientNs / broadcastNs);
+        }
+
+        for (IpcChannel* client : qAsConst(clients)) {
+            delete client;
+        }
+        server.close();
+        QCoreApplication::processEvents();
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+// bench_ipc_framing.cpp
+// Receive-path framing: QByteArray append/left/remove vs FrameReader
+// Feeds bursts of small SignalUpdate messages and measures the cost per
+// message of splitting and deserializing them
+
+#include "ipc/IpcFrameReader.h"
+#include "ipc/IpcSchemas.h"
+#include <QCoreApplication>
+#include <chrono>
+#include <cstdio>
+
+using namespace automotive::ipc;
+
+namespace {
+
+constexpr int kBurstSizes[] = {1, 16, 256, 4096};
+constexpr int kMessagesPerRun = 200000;
+
+// The receive path before FrameReader: re-parse the header through a
+// QDataStream, copy the frame out and shift the buffer
+int legacyProcess(QByteArray& buffer)
+{
+    int frames = 0;
+    while (buffer.size() >= static_cast<qsizetype>(MessageHeader::SIZE)) {
+        QDataStream stream(buffer);
+        stream.setVersion(QDataStream::Qt_6_0);
+        MessageHeader header;
+        stream >> header;
+        if (!header.isValid()) {
+            buffer.clear();
+            break;
+        }
+        const qsizetype totalSize = static_cast<qsizetype>(MessageHeader::SIZE + header.payloadSize);
+        if (buffer.size() < totalSize) {
+            break;
+        }
+        const QByteArray messageData = buffer.left(totalSize);
+        buffer.remove(0, totalSize);
+
+        bool ok = false;
+        IpcMessage::deserialize(messageData, &ok);
+        frames += ok ? 1 : 0;
+    }
+    return frames;
+}
+
+int readerProcess(FrameReader& reader)
+{
+    int frames = 0;
+    FrameReader::Frame frame;
+    while (reader.next(frame) == FrameReader::Result::Frame) {
+        bool ok = false;
+        IpcMessage::deserialize(frame.data, frame.size, &ok);
+        frames += ok ? 1 : 0;
+    }
+    return frames;
+}
+
+template<typename Function>
+double nsPerMessage(int messages, Function&& function)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    const int frames = function();
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    if (frames != messages) {
+        std::printf("  (decoded %d of %d messages)\n", frames, messages);
+    }
+    return std::chrono::duration<double, std::nano>(elapsed).count() / messages;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    SignalUpdateBody body;
+    body.signal = 42;
+    body.value = 88.5;
+    const QByteArray message = IpcMessage::fromBody(body).serialize();
+
+    std::printf("IPC receive framing (~%d messages of %lld bytes per run)\n\n",
+                kMessagesPerRun, static_cast<long long>(message.size()));
+    std::printf("%10s | %14s | %14s | %8s\n", "burst", "legacy ns/msg", "reader ns/msg", "speedup");
+
+    for (int burstSize : kBurstSizes) {
+        QByteArray burst;
+        for (int i = 0; i < burstSize; ++i) {
+            burst.append(message);
+        }
+        const int bursts = kMessagesPerRun / burstSize;
+
+        const double legacyNs = nsPerMessage(bursts * burstSize, [&]() {
+            QByteArray buffer;
+            int frames = 0;
+            for (int i = 0; i < bursts; ++i) {
+                buffer.append(burst);                      // as readAll()
+                frames += legacyProcess(buffer);
+            }
+            return frames;
+        });
+
+        const double readerNs = nsPerMessage(bursts * burstSize, [&]() {
+            FrameReader reader;
+            int frames = 0;
+            for (int i = 0; i < bursts; ++i) {
+                reader.append(burst.constData(), burst.size());  // as read()
+                frames += readerProcess(reader);
+            }
+            return frames;
+        });
+
+        std::printf("%10d | %14.1f | %14.1f | %7.1fx\n",
+                    burstSize, legacyNs, readerNs, legacyNs / readerNs);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+// bench_ipc_integrity.cpp
+// IPC payload integrity cost for 64 B to 64 KB payloads
+// Measures the checksum alone (truncated MD5 as used by header version 1,
+// CRC32C per implementation) and a full IpcMessage serialize + deserialize
+
+#include "ipc/IpcIntegrity.h"
+#include "ipc/IpcMessage.h"
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace automotive::ipc;
+
+namespace {
+
+constexpr qsizetype kPayloadSizes[] = {64, 256, 1024, 4096, 16384, 65536};
+constexpr qint64 kBytesPerRun = 256LL * 1024 * 1024;
+constexpr int kMinIterations = 1000;
+
+int iterationsFor(qsizetype size)
+{
+    return static_cast<int>(qMax<qint64>(kBytesPerRun / size, kMinIterations));
+}
+
+QByteArray makePayload(qsizetype size)
+{
+    QByteArray bytes(size, '\0');
+    uint32_t state = 0x9E3779B9u;
+    for (qsizetype i = 0; i < size; ++i) {
+        state = state * 1664525u + 1013904223u;
+        bytes[i] = static_cast<char>(state >> 24);
+    }
+    return bytes;
+}
+
+template<typename Function>
+double nsPerCall(int iterations, Function&& function)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        function();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+// Header version 1 checksum: MD5 of the payload, first four bytes
+uint32_t truncatedMd5(const QByteArray& data)
+{
+    const QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Md5);
+    return (static_cast<uint32_t>(static_cast<uint8_t>(hash[0])) << 24) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(hash[1])) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(hash[2])) << 8) |
+           static_cast<uint32_t>(static_cast<uint8_t>(hash[3]));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Unsupported implementations fall back to the best one; only time real ones
+    std::vector<IntegrityIsa> isas = {IntegrityIsa::Portable};
+    if (bestIntegrityIsa() != IntegrityIsa::Portable) {
+        isas.push_back(bestIntegrityIsa());
+    }
+    std::printf("IPC integrity benchmark (best CRC32C implementation: %s)\n\n",
+                integrityIsaName(bestIntegrityIsa()));
+
+    std::printf("Checksum only, ns per payload (GB/s)\n");
+    std::printf("%8s %20s", "bytes", "md5 (v1)");
+    for (IntegrityIsa isa : isas) {
+        std::printf(" %20s", integrityIsaName(isa));
+    }
+    std::printf("\n");
+
+    volatile uint32_t sink = 0;
+    for (qsizetype size : kPayloadSizes) {
+        const QByteArray payload = makePayload(size);
+        const int iterations = iterationsFor(size);
+
+        const double md5Ns = nsPerCall(iterations / 4 + 1, [&]() { sink = sink + truncatedMd5(payload); });
+        std::printf("%8lld %11.0f (%5.2f)", static_cast<long long>(size), md5Ns, size / md5Ns);
+        for (IntegrityIsa isa : isas) {
+            const double ns = nsPerCall(iterations, [&]() {
+                sink = sink + crc32c(payload.constData(), static_cast<size_t>(size), 0, isa);
+            });
+            std::printf(" %11.0f (%5.2f)", ns, size / ns);
+        }
+        std::printf("\n");
+    }
+
+    std::printf("\nIpcMessage with one byte-array value, ns per message\n");
+    std::printf("%8s %14s %14s\n", "bytes", "serialize", "deserialize");
+    for (qsizetype size : kPayloadSizes) {
+        IpcMessage message(MessageType::SignalBatch);
+        message.setValue(QStringLiteral("data"), makePayload(size));
+        const QByteArray data = message.serialize();
+        const int iterations = iterationsFor(data.size()) / 4 + 1;
+
+        const double serializeNs = nsPerCall(iterations, [&]() {
+            sink = sink + static_cast<uint32_t>(message.serialize().size());
+        });
+        const double deserializeNs = nsPerCall(iterations, [&]() {
+            bool ok = false;
+            IpcMessage::deserialize(data, &ok);
+            sink = sink + (ok ? 1u : 0u);
+        });
+        std::printf("%8lld %14.0f %14.0f\n", static_cast<long long>(size), serializeNs, deserializeNs);
+    }
+
+    return 0;
+}
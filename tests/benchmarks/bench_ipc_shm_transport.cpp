@@ -0,0 +1,163 @@
+// bench_ipc_shm_transport.cpp
+// IpcChannel loopback: LocalSocket vs SharedMemory transport
+// Measures one-way message rate (bursts from client to server) and
+// round-trip latency (ping-pong with a server-side echo). Both ends run
+// on one event loop, so the numbers include a loop turn per hop.
+
+#include "ipc/IpcServer.h"
+#include "ipc/IpcSchemas.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace automotive::ipc;
+
+namespace {
+
+constexpr int kRateMessages = 200000;
+constexpr int kBurst = 64;
+constexpr int kPings = 20000;
+
+struct Result {
+    bool ok{false};
+    double messagesPerSecond{0.0};
+    double p50Us{0.0};
+    double p99Us{0.0};
+};
+
+bool waitFor(const std::function<bool()>& condition, int timeoutMs = 10000)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!condition()) {
+        if (timer.elapsed() > timeoutMs) {
+            return false;
+        }
+        QCoreApplication::processEvents();
+    }
+    return true;
+}
+
+double percentileUs(std::vector<double>& samplesNs, double percentile)
+{
+    const size_t index = static_cast<size_t>(percentile * static_cast<double>(samplesNs.size() - 1));
+    std::nth_element(samplesNs.begin(), samplesNs.begin() + static_cast<std::ptrdiff_t>(index),
+                     samplesNs.end());
+    return samplesNs[index] / 1000.0;
+}
+
+Result run(ChannelTransport transport, const QString& serverName)
+{
+    Result result;
+
+    IpcServer server;
+    server.setTransport(transport);
+    if (!server.listen(serverName)) {
+        return result;
+    }
+
+    bool echo = false;
+    int serverReceived = 0;
+    QObject::connect(&server, &IpcServer::messageReceived,
+                     [&](IpcChannel* channel, const IpcMessage& message) {
+                         ++serverReceived;
+                         if (echo) {
+                             channel->send(message);
+                         }
+                     });
+
+    IpcChannel client;
+    client.setTransport(transport);
+    int clientReceived = 0;
+    QObject::connect(&client, &IpcChannel::messageReceived,
+                     [&](const IpcMessage&) { ++clientReceived; });
+    client.connectToServer(serverName);
+    if (!waitFor([&]() { return client.isConnected() && server.clientCount() == 1; })) {
+        return result;
+    }
+
+    SignalUpdateBody body;
+    body.signal = 42;
+    body.value = 88.5;
+    const IpcMessage message = IpcMessage::fromBody(body);
+
+    // Rate: bursts of kBurst; what does not fit in the ring waits in the sender
+    const auto rateBegin = std::chrono::steady_clock::now();
+    int sent = 0;
+    while (sent < kRateMessages) {
+        for (int i = 0; i < kBurst && sent < kRateMessages; ++i) {
+            if (!client.send(message)) {
+                break;
+            }
+            ++sent;
+        }
+        QCoreApplication::processEvents();
+    }
+    if (!waitFor([&]() { return serverReceived == kRateMessages; })) {
+        return result;
+    }
+    const double rateSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - rateBegin).count();
+    result.messagesPerSecond = kRateMessages / rateSeconds;
+
+    // Latency: one message in flight at a time
+    echo = true;
+    std::vector<double> roundTripsNs;
+    roundTripsNs.reserve(kPings);
+    for (int i = 0; i < kPings; ++i) {
+        const int expected = clientReceived + 1;
+        const auto begin = std::chrono::steady_clock::now();
+        client.send(message);
+        if (!waitFor([&]() { return clientReceived == expected; })) {
+            return result;
+        }
+        roundTripsNs.push_back(
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+    }
+    result.p50Us = percentileUs(roundTripsNs, 0.50);
+    result.p99Us = percentileUs(roundTripsNs, 0.99);
+    result.ok = true;
+
+    client.disconnect();
+    server.close();
+    QCoreApplication::processEvents();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    std::printf("IpcChannel loopback (%d messages for rate, %d ping-pongs for latency)\n\n",
+                kRateMessages, kPings);
+    std::printf("%14s | %14s | %12s | %12s\n", "transport", "messages/s", "RTT p50 us", "RTT p99 us");
+
+    const struct {
+        ChannelTransport transport;
+        const char* name;
+    } transports[] = {
+        {ChannelTransport::LocalSocket, "LocalSocket"},
+        {ChannelTransport::SharedMemory, "SharedMemory"},
+    };
+
+    int failures = 0;
+    for (const auto& entry : transports) {
+        const Result result = run(entry.transport,
+                                  QStringLiteral("automotive_bench_transport_%1")
+                                      .arg(QString::fromLatin1(entry.name)));
+        if (!result.ok) {
+            std::printf("%14s | failed\n", entry.name);
+            ++failures;
+            continue;
+        }
+        std::printf("%14s | %14.0f | %12.1f | %12.1f\n", entry.name, result.messagesPerSecond,
+                    result.p50Us, result.p99Us);
+    }
+    return failures == 0 ? 0 : 1;
+}
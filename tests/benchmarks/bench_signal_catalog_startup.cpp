@@ -0,0 +1,126 @@
+// bench_signal_catalog_startup.cpp
+// Hub startup time: runtime SignalDefinition registration vs mapped catalog image
+// Measures ms to a fully registered hub for 100, 1k and 10k signals
+
+#include "signal/SignalCatalogImage.h"
+#include "signal/SignalHub.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QTemporaryDir>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace automotive::signal;
+
+namespace {
+
+constexpr int kRepetitions = 7;
+
+/**
+ * @brief Synthetic signal i, built the way registerClusterSignals() used to
+ */
+SignalDefinition makeDefinition(int i)
+{
+    SignalDefinition def;
+    def.id = QStringLiteral("vehicle.bench.signal_%1").arg(i);
+    def.name = QStringLiteral("Benchmark Signal %1").arg(i);
+    switch (i % 4) {
+    case 0:
+        def.unit = QStringLiteral("km/h");
+        def.minValue = 0.0;
+        def.maxValue = 400.0;
+        def.defaultValue = 0.0;
+        def.maxRateOfChange = 50.0;
+        break;
+    case 1:
+        def.kind = SignalKind::Int;
+        def.unit = QStringLiteral("rpm");
+        def.minValue = 0;
+        def.maxValue = 8000;
+        def.defaultValue = 0;
+        break;
+    case 2:
+        def.kind = SignalKind::Bool;
+        def.defaultValue = false;
+        break;
+    default:
+        def.kind = SignalKind::String;
+        def.defaultValue = QStringLiteral("P");
+        break;
+    }
+    def.freshnessMs = 300 + (i % 10) * 100;
+    def.isSafetyCritical = (i % 8) == 0;
+    return def;
+}
+
+template<typename Body>
+double medianMs(Body body)
+{
+    std::vector<double> samples;
+    for (int r = 0; r < kRepetitions; ++r) {
+        const auto begin = std::chrono::steady_clock::now();
+        body();
+        samples.push_back(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - begin).count());
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        std::fprintf(stderr, "Cannot create temporary directory\n");
+        return 1;
+    }
+
+    std::printf("Signal catalog startup benchmark (median of %d runs)\n\n", kRepetitions);
+    std::printf("%8s %16s %16s %12s %10s\n",
+                "signals", "definitions ms", "image ms", "image bytes", "speedup");
+
+    for (int count : {100, 1000, 10000}) {
+        QVector<SignalDefinition> definitions;
+        for (int i = 0; i < count; ++i) {
+            definitions.append(makeDefinition(i));
+        }
+        const QByteArray image = buildSignalCatalogImage(definitions, 1);
+        const QString path = dir.filePath(QStringLiteral("catalog_%1.bin").arg(count));
+        {
+            QFile file(path);
+            if (!file.open(QIODevice::WriteOnly) || file.write(image) != image.size()) {
+                std::fprintf(stderr, "Cannot write %s\n", qPrintable(path));
+                return 1;
+            }
+        }
+
+        // Before: build every definition at boot, register one by one
+        const double runtimeMs = medianMs([count]() {
+            SignalHub hub;
+            for (int i = 0; i < count; ++i) {
+                hub.registerSignal(makeDefinition(i));
+            }
+        });
+
+        // After: map the precompiled image and register from it
+        bool ok = true;
+        const double imageMs = medianMs([&]() {
+            SignalHub hub;
+            ok = hub.registerCatalogImage(SignalCatalogImage::open(path)) && ok;
+        });
+        if (!ok) {
+            std::fprintf(stderr, "Image registration failed for %d signals\n", count);
+            return 1;
+        }
+
+        std::printf("%8d %16.3f %16.3f %12lld %10.2f\n", count, runtimeMs, imageMs,
+                    static_cast<long long>(image.size()), runtimeMs / imageMs);
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+// bench_signal_hub_contention.cpp
+// Reader/writer contention benchmark for SignalHub
+// Measures getSignal() and updateSignal() throughput with 1-8 threads
+
+#include "signal/SignalHub.h"
+#include <QCoreApplication>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace automotive::signal;
+
+namespace {
+
+constexpr int kSignalCount = 64;
+constexpr auto kRunDuration = std::chrono::milliseconds(500);
+
+struct RunResult {
+    double readsPerSec{0.0};
+    double writesPerSec{0.0};
+};
+
+std::vector<SignalHandle> registerSignals(SignalHub& hub)
+{
+    std::vector<SignalHandle> handles;
+    for (int i = 0; i < kSignalCount; ++i) {
+        SignalDefinition def;
+        def.id = QStringLiteral("bench.signal.%1").arg(i);
+        def.name = def.id;
+        def.minValue = 0.0;
+        def.maxValue = 1.0e9;
+        def.freshnessMs = 1000000;
+        handles.push_back(hub.registerSignal(def));
+    }
+    return handles;
+}
+
+/**
+ * @brief Run readers and writers concurrently for a fixed duration
+ */
+RunResult run(int readerThreads, int writerThreads)
+{
+    SignalHub hub;
+    const std::vector<SignalHandle> handles = registerSignals(hub);
+    for (SignalHandle handle : handles) {
+        hub.updateSignal(handle, 0.0);
+    }
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<quint64> reads{0};
+    std::atomic<quint64> writes{0};
+    std::atomic<double> sink{0.0};
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readerThreads; ++r) {
+        threads.emplace_back([&, r]() {
+            while (!start.load(std::memory_order_acquire)) {}
+            quint64 count = 0;
+            double acc = 0.0;
+            size_t index = static_cast<size_t>(r);
+            while (!stop.load(std::memory_order_relaxed)) {
+                acc += hub.getSignal(handles[index % handles.size()]).toDouble();
+                ++index;
+                ++count;
+            }
+            reads.fetch_add(count, std::memory_order_relaxed);
+            sink.store(acc, std::memory_order_relaxed);
+        });
+    }
+    for (int w = 0; w < writerThreads; ++w) {
+        threads.emplace_back([&, w]() {
+            while (!start.load(std::memory_order_acquire)) {}
+            quint64 count = 0;
+            size_t index = static_cast<size_t>(w);
+            while (!stop.load(std::memory_order_relaxed)) {
+                hub.updateSignal(handles[index % handles.size()],
+                                 static_cast<double>(count % 1000));
+                ++index;
+                ++count;
+            }
+            writes.fetch_add(count, std::memory_order_relaxed);
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(kRunDuration);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    RunResult result;
+    result.readsPerSec = static_cast<double>(reads.load()) / seconds;
+    result.writesPerSec = static_cast<double>(writes.load()) / seconds;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    std::printf("SignalHub contention benchmark (%d signals, %lld ms per run)\n\n",
+                kSignalCount, static_cast<long long>(kRunDuration.count()));
+
+    std::printf("%-28s %8s %16s %16s\n", "scenario", "threads", "reads/s", "writes/s");
+    for (int threads : {1, 2, 4, 8}) {
+        const RunResult result = run(threads, 1);
+        std::printf("%-28s %8d %16.0f %16.0f\n", "N readers + 1 writer",
+                    threads, result.readsPerSec, result.writesPerSec);
+    }
+    for (int threads : {1, 2, 4, 8}) {
+        const RunResult result = run(1, threads);
+        std::printf("%-28s %8d %16.0f %16.0f\n", "1 reader + N writers",
+                    threads, result.readsPerSec, result.writesPerSec);
+    }
+
+    return 0;
+}
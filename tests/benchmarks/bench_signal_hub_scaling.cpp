@@ -0,0 +1,421 @@
+// bench_signal_hub_scaling.cpp
+// SignalHub scaling sweep: signal count x update rate x consumers x readers
+// Reports update throughput, update-to-notify latency (p50/p99), heap
+// allocations per update and checkFreshness() cost, as a table on stdout and
+// as JSON (argument 1, default bench_signal_hub_scaling.json) for comparing
+// builds.
+//
+// Hub time is simulated: one processTick() per millisecond, so the update
+// rate is the number of updates committed between two ticks. Immediate runs
+// notify inside updateSignal(); coalesced runs notify from the tick, so their
+// latency includes the wait for it.
+
+#include "signal/SignalHub.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace automotive::signal;
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+// Qt containers allocate through malloc() and operator new ends up there as
+// well, so malloc is interposed where the C library allows it (glibc). Only
+// the benchmark thread counts; reader threads do not skew the figure.
+namespace {
+std::atomic<quint64> g_allocations{0};
+thread_local bool t_countAllocations = false;
+} // namespace
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+void* malloc(size_t size)
+{
+    if (t_countAllocations) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    if (t_countAllocations) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size)
+{
+    if (t_countAllocations) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    return __libc_realloc(pointer, size);
+}
+} // extern "C"
+constexpr bool kCountsAllocations = true;
+#else
+constexpr bool kCountsAllocations = false;
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kUpdatesPerRun = 100000;
+constexpr int kMaxTicksPerRun = 20000;         // Bounds runs at low update rates
+constexpr int kLatencyStride = 8;              // Stamp every Nth update
+constexpr int kFreshnessRounds = 20;
+constexpr qint64 kFreshnessMs = 300;
+
+const int kSignalCounts[] = {10, 100, 1000, 10000};
+const int kUpdatesPerTick[] = {1, 16, 256};    // 1k, 16k, 256k updates/s of hub time
+const int kConsumerCounts[] = {0, 1, 8};
+const int kReaderCounts[] = {0, 2};
+
+struct RunConfig {
+    int signalCount{0};
+    int updatesPerTick{0};
+    int consumers{0};
+    int readers{0};
+    bool coalescing{false};
+};
+
+struct RunResult {
+    int updates{0};
+    double updatesPerSec{0.0};
+    double readsPerSec{0.0};
+    double notificationsPerUpdate{0.0};
+    double p50LatencyUs{0.0};
+    double p99LatencyUs{0.0};
+    quint64 latencySamples{0};
+    double allocationsPerUpdate{-1.0};
+};
+
+struct FreshnessResult {
+    int signalCount{0};
+    double idleNs{0.0};                        ///< checkFreshness() with nothing due
+    double expiryNs{0.0};                      ///< checkFreshness() expiring every signal
+    double expiryNsPerSignal{0.0};
+};
+
+qint64 nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+std::vector<SignalHandle> registerSignals(SignalHub& hub, int count, qint64 freshnessMs)
+{
+    hub.reserveSignals(count);
+    std::vector<SignalHandle> handles;
+    handles.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        SignalDefinition def;
+        def.id = QStringLiteral("vehicle.bench.signal_%1").arg(i);
+        def.name = def.id;
+        def.minValue = 0.0;
+        def.maxValue = 1.0e9;
+        def.defaultValue = 0.0;
+        def.freshnessMs = freshnessMs;
+        handles.push_back(hub.registerSignal(def));
+    }
+    return handles;
+}
+
+double percentileUs(std::vector<qint64>& samplesNs, double fraction)
+{
+    if (samplesNs.empty()) {
+        return 0.0;
+    }
+    const size_t rank = std::min(samplesNs.size() - 1,
+                                 static_cast<size_t>(fraction * static_cast<double>(samplesNs.size())));
+    std::nth_element(samplesNs.begin(), samplesNs.begin() + static_cast<std::ptrdiff_t>(rank),
+                     samplesNs.end());
+    return static_cast<double>(samplesNs[rank]) / 1000.0;
+}
+
+/**
+ * @brief Drive one configuration and measure it
+ *
+ * Every consumer subscribes to all signals. The first one records the
+ * latency from the oldest not yet notified stamped update of a signal to
+ * its notification.
+ */
+RunResult run(const RunConfig& config)
+{
+    SignalHub hub;
+    // Freshness is measured separately; keep it out of the update path here
+    const int updates = std::min(kUpdatesPerRun, kMaxTicksPerRun * config.updatesPerTick);
+    const std::vector<SignalHandle> handles =
+        registerSignals(hub, config.signalCount, kMaxTicksPerRun + 1000);
+    hub.setCoalescingEnabled(config.coalescing);
+
+    std::vector<qint64> stampNs(handles.size(), 0);
+    std::vector<qint64> latenciesNs;
+    latenciesNs.reserve(updates / kLatencyStride + handles.size());
+    quint64 notifications = 0;
+
+    const QVector<SignalHandle> all(handles.begin(), handles.end());
+    for (int c = 0; c < config.consumers; ++c) {
+        if (c == 0) {
+            hub.subscribe(all, [&](const SignalChange& change) {
+                ++notifications;
+                qint64& stamp = stampNs[change.handle.index];
+                if (stamp != 0) {
+                    latenciesNs.push_back(nowNs() - stamp);
+                    stamp = 0;
+                }
+            });
+        } else {
+            hub.subscribe(all, [&](const SignalChange&) { ++notifications; });
+        }
+    }
+
+    hub.setClockOverride(0);
+    for (SignalHandle handle : handles) {
+        hub.updateSignal(handle, 0.0);
+    }
+    hub.processTick();
+    notifications = 0;
+    latenciesNs.clear();
+
+    std::atomic<bool> stop{false};
+    std::atomic<quint64> reads{0};
+    std::atomic<double> sink{0.0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < config.readers; ++r) {
+        readers.emplace_back([&, r]() {
+            quint64 count = 0;
+            double acc = 0.0;
+            size_t index = static_cast<size_t>(r) * 7919;
+            while (!stop.load(std::memory_order_relaxed)) {
+                acc += hub.getSignal(handles[index % handles.size()]).toDouble();
+                ++index;
+                ++count;
+            }
+            reads.fetch_add(count, std::memory_order_relaxed);
+            sink.store(acc, std::memory_order_relaxed);
+        });
+    }
+
+    const quint64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    t_countAllocations = true;
+    const auto begin = Clock::now();
+
+    qint64 tick = 1;
+    size_t index = 0;
+    for (int i = 0; i < updates; ++i) {
+        if (i % config.updatesPerTick == 0) {
+            hub.setClockOverride(tick++);
+            hub.processTick();
+        }
+        if (i % kLatencyStride == 0 && stampNs[index] == 0) {
+            stampNs[index] = nowNs();
+        }
+        hub.updateSignal(handles[index], static_cast<double>(i));
+        index = index + 1 == handles.size() ? 0 : index + 1;
+    }
+    hub.setClockOverride(tick);
+    hub.processTick();
+
+    const auto elapsed = Clock::now() - begin;
+    t_countAllocations = false;
+    const quint64 allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    RunResult result;
+    result.updates = updates;
+    result.updatesPerSec = updates / seconds;
+    result.readsPerSec = static_cast<double>(reads.load()) / seconds;
+    result.notificationsPerUpdate = static_cast<double>(notifications) / updates;
+    result.latencySamples = latenciesNs.size();
+    result.p50LatencyUs = percentileUs(latenciesNs, 0.50);
+    result.p99LatencyUs = percentileUs(latenciesNs, 0.99);
+    if (kCountsAllocations) {
+        result.allocationsPerUpdate = static_cast<double>(allocations) / updates;
+    }
+    return result;
+}
+
+/**
+ * @brief Cost of checkFreshness() with no deadline due and with all due
+ */
+FreshnessResult measureFreshness(int signalCount)
+{
+    SignalHub hub;
+    const std::vector<SignalHandle> handles = registerSignals(hub, signalCount, kFreshnessMs);
+
+    FreshnessResult result;
+    result.signalCount = signalCount;
+    qint64 idleNs = 0;
+    qint64 expiryNs = 0;
+    qint64 now = 0;
+
+    for (int round = 0; round < kFreshnessRounds; ++round) {
+        hub.setClockOverride(now);
+        for (SignalHandle handle : handles) {
+            hub.updateSignal(handle, static_cast<double>(round));
+        }
+
+        hub.setClockOverride(now + kFreshnessMs / 2);
+        auto begin = Clock::now();
+        hub.checkFreshness();
+        idleNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+
+        now += kFreshnessMs + 1;
+        hub.setClockOverride(now);
+        begin = Clock::now();
+        hub.checkFreshness();
+        expiryNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+    }
+
+    result.idleNs = static_cast<double>(idleNs) / kFreshnessRounds;
+    result.expiryNs = static_cast<double>(expiryNs) / kFreshnessRounds;
+    result.expiryNsPerSignal = result.expiryNs / signalCount;
+    return result;
+}
+
+QJsonObject toJson(const RunConfig& config, const RunResult& result)
+{
+    QJsonObject object;
+    object[QStringLiteral("signals")] = config.signalCount;
+    object[QStringLiteral("updatesPerTick")] = config.updatesPerTick;
+    object[QStringLiteral("offeredRateHz")] = config.updatesPerTick * 1000;
+    object[QStringLiteral("consumers")] = config.consumers;
+    object[QStringLiteral("readers")] = config.readers;
+    object[QStringLiteral("coalescing")] = config.coalescing;
+    object[QStringLiteral("updates")] = result.updates;
+    object[QStringLiteral("updatesPerSec")] = result.updatesPerSec;
+    object[QStringLiteral("readsPerSec")] = result.readsPerSec;
+    object[QStringLiteral("notificationsPerUpdate")] = result.notificationsPerUpdate;
+    object[QStringLiteral("latencySamples")] = static_cast<double>(result.latencySamples);
+    const bool hasLatency = result.latencySamples > 0;
+    object[QStringLiteral("notifyLatencyP50Us")] = hasLatency ? QJsonValue(result.p50LatencyUs) : QJsonValue();
+    object[QStringLiteral("notifyLatencyP99Us")] = hasLatency ? QJsonValue(result.p99LatencyUs) : QJsonValue();
+    object[QStringLiteral("allocationsPerUpdate")] =
+        kCountsAllocations ? QJsonValue(result.allocationsPerUpdate) : QJsonValue();
+    return object;
+}
+
+QJsonObject environment()
+{
+    QJsonObject object;
+    object[QStringLiteral("timestamp")] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    object[QStringLiteral("host")] = QSysInfo::machineHostName();
+    object[QStringLiteral("cpuArchitecture")] = QSysInfo::currentCpuArchitecture();
+    object[QStringLiteral("hardwareThreads")] = static_cast<int>(std::thread::hardware_concurrency());
+    object[QStringLiteral("qtVersion")] = QString::fromLatin1(qVersion());
+#if defined(__clang__)
+    object[QStringLiteral("compiler")] = QStringLiteral("clang " __clang_version__);
+#elif defined(__GNUC__)
+    object[QStringLiteral("compiler")] = QStringLiteral("gcc " __VERSION__);
+#elif defined(_MSC_VER)
+    object[QStringLiteral("compiler")] = QStringLiteral("msvc %1").arg(_MSC_VER);
+#endif
+#if defined(NDEBUG)
+    object[QStringLiteral("assertions")] = false;
+#else
+    object[QStringLiteral("assertions")] = true;
+#endif
+    object[QStringLiteral("maxUpdatesPerRun")] = kUpdatesPerRun;
+    object[QStringLiteral("maxTicksPerRun")] = kMaxTicksPerRun;
+    object[QStringLiteral("latencyStride")] = kLatencyStride;
+    return object;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    const QStringList arguments = app.arguments();
+    const QString jsonPath = arguments.size() > 1 ? arguments.at(1)
+                                                  : QStringLiteral("bench_signal_hub_scaling.json");
+
+    std::printf("SignalHub scaling benchmark (up to %d updates or %d ticks per run, 1 ms hub tick)\n\n",
+                kUpdatesPerRun, kMaxTicksPerRun);
+    std::printf("%7s %6s %5s %5s %5s %12s %12s %9s %9s %9s %8s\n",
+                "signals", "upd/tk", "cons", "rdrs", "coal", "updates/s", "reads/s",
+                "ntf/upd", "p50 us", "p99 us", "alloc/u");
+
+    QJsonArray runs;
+    for (int signalCount : kSignalCounts) {
+        for (int updatesPerTick : kUpdatesPerTick) {
+            for (int consumers : kConsumerCounts) {
+                for (int readers : kReaderCounts) {
+                    for (bool coalescing : {false, true}) {
+                        RunConfig config;
+                        config.signalCount = signalCount;
+                        config.updatesPerTick = updatesPerTick;
+                        config.consumers = consumers;
+                        config.readers = readers;
+                        config.coalescing = coalescing;
+
+                        const RunResult result = run(config);
+                        std::printf("%7d %6d %5d %5d %5s %12.0f %12.0f %9.2f %9.2f %9.2f %8.2f\n",
+                                    signalCount, updatesPerTick, consumers, readers,
+                                    coalescing ? "yes" : "no", result.updatesPerSec,
+                                    result.readsPerSec, result.notificationsPerUpdate,
+                                    result.p50LatencyUs, result.p99LatencyUs,
+                                    result.allocationsPerUpdate);
+                        std::fflush(stdout);
+                        runs.append(toJson(config, result));
+                    }
+                }
+            }
+        }
+    }
+
+    std::printf("\n%7s %14s %14s %14s\n", "signals", "idle ns", "expire-all ns", "ns/signal");
+    QJsonArray freshness;
+    for (int signalCount : kSignalCounts) {
+        const FreshnessResult result = measureFreshness(signalCount);
+        std::printf("%7d %14.0f %14.0f %14.1f\n", signalCount, result.idleNs,
+                    result.expiryNs, result.expiryNsPerSignal);
+
+        QJsonObject object;
+        object[QStringLiteral("signals")] = signalCount;
+        object[QStringLiteral("idleNs")] = result.idleNs;
+        object[QStringLiteral("expireAllNs")] = result.expiryNs;
+        object[QStringLiteral("expireNsPerSignal")] = result.expiryNsPerSignal;
+        freshness.append(object);
+    }
+
+    QJsonObject root;
+    root[QStringLiteral("benchmark")] = QStringLiteral("signal_hub_scaling");
+    root[QStringLiteral("environment")] = environment();
+    root[QStringLiteral("runs")] = runs;
+    root[QStringLiteral("checkFreshness")] = freshness;
+
+    QFile file(jsonPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(jsonPath));
+        return 1;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    std::printf("\nResults written to %s\n", qPrintable(jsonPath));
+    return 0;
+}
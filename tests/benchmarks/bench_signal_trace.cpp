@@ -0,0 +1,124 @@
+// bench_signal_trace.cpp
+// Trace recording overhead on SignalHub::updateSignal() and replay throughput
+// Measures ns per update without and with a recorder attached, then replays
+// the recorded trace as fast as possible into a second hub
+
+#include "signal/SignalHub.h"
+#include "signal/SignalTrace.h"
+#include "signal/SignalTraceReplayer.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QTemporaryDir>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace automotive::signal;
+
+namespace {
+
+constexpr int kSignals = 64;
+constexpr int kUpdates = 1000000;
+constexpr int kUpdatesPerTick = 64;
+
+std::vector<SignalHandle> registerSignals(SignalHub& hub)
+{
+    std::vector<SignalHandle> handles;
+    for (int i = 0; i < kSignals; ++i) {
+        SignalDefinition def;
+        def.id = QStringLiteral("vehicle.bench.signal_%1").arg(i);
+        def.name = def.id;
+        def.minValue = 0.0;
+        def.maxValue = 1000.0;
+        def.defaultValue = 0.0;
+        def.freshnessMs = 300;
+        handles.push_back(hub.registerSignal(def));
+    }
+    return handles;
+}
+
+// Drive the hub with a synthetic 1 ms-per-tick load, returns ns per update
+double drive(SignalHub& hub, const std::vector<SignalHandle>& handles)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < kUpdates; ++i) {
+        if (i % kUpdatesPerTick == 0) {
+            hub.setClockOverride(i / kUpdatesPerTick);
+            hub.processTick();
+        }
+        hub.updateSignal(handles[static_cast<std::size_t>(i % kSignals)],
+                         static_cast<double>(i % 1000));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / kUpdates;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        std::fprintf(stderr, "Cannot create temporary directory\n");
+        return 1;
+    }
+    const QString path = dir.filePath(QStringLiteral("bench.trace"));
+
+    std::printf("Signal trace benchmark (%d updates over %d signals, tick every %d)\n\n",
+                kUpdates, kSignals, kUpdatesPerTick);
+
+    double baselineNs = 0.0;
+    {
+        SignalHub hub;
+        baselineNs = drive(hub, registerSignals(hub));
+    }
+
+    double recordingNs = 0.0;
+    TraceRecorderStats stats;
+    {
+        SignalHub hub;
+        const std::vector<SignalHandle> handles = registerSignals(hub);
+        SignalTraceRecorder recorder;
+        if (!recorder.start(path, hub)) {
+            std::fprintf(stderr, "Cannot record to %s\n", qPrintable(path));
+            return 1;
+        }
+        hub.setTraceRecorder(&recorder);
+        recordingNs = drive(hub, handles);
+        hub.setTraceRecorder(nullptr);
+        recorder.stop();
+        stats = recorder.stats();
+    }
+
+    std::printf("%-24s %12s\n", "", "ns/update");
+    std::printf("%-24s %12.1f\n", "no recorder", baselineNs);
+    std::printf("%-24s %12.1f\n", "recording", recordingNs);
+    std::printf("\nrecords %llu, dropped %llu, flushes %llu, trace %.1f MB\n\n",
+                static_cast<unsigned long long>(stats.records),
+                static_cast<unsigned long long>(stats.dropped),
+                static_cast<unsigned long long>(stats.flushes),
+                static_cast<double>(stats.bytesWritten) / (1024.0 * 1024.0));
+
+    SignalHub hub;
+    registerSignals(hub);
+    SignalTraceReplayer replayer(&hub);
+    QString error;
+    if (!replayer.open(path, &error)) {
+        std::fprintf(stderr, "Cannot replay: %s\n", qPrintable(error));
+        return 1;
+    }
+    replayer.setSpeed(SignalTraceReplayer::AS_FAST_AS_POSSIBLE);
+
+    const auto begin = std::chrono::steady_clock::now();
+    replayer.start();
+    const double replayMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    const TraceReplayStats replayed = replayer.stats();
+    const quint64 events = replayed.updates + replayed.batchedUpdates + replayed.ticks;
+    std::printf("replay (as fast as possible): %llu records in %.1f ms, %.2f M records/s\n",
+                static_cast<unsigned long long>(events), replayMs,
+                static_cast<double>(events) / (replayMs * 1000.0));
+    return 0;
+}
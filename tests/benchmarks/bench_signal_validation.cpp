@@ -0,0 +1,184 @@
+// bench_signal_validation.cpp
+// Range/rate validation throughput: per-signal checks vs batch kernel
+// Measures ns per signal for 64, 512 and 4096 signal batches
+
+#include "signal/SignalValidationKernel.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace automotive::signal;
+
+namespace {
+
+constexpr auto kRunDuration = std::chrono::milliseconds(300);
+
+/**
+ * @brief Array-of-structs signal record, as checked one by one by SignalHub
+ */
+struct SignalRecord {
+    double value{0.0};
+    double minValue{0.0};
+    double maxValue{0.0};
+    bool hasMin{false};
+    bool hasMax{false};
+    double previousValue{0.0};
+    double maxRate{0.0};
+    qint64 deltaTimeMs{0};
+    double result{0.0};
+    bool outOfRange{false};
+    bool rateViolation{false};
+};
+
+struct BenchData {
+    std::vector<SignalRecord> records;
+
+    std::vector<double> values;
+    std::vector<double> minValues;
+    std::vector<double> maxValues;
+    std::vector<double> previousValues;
+    std::vector<double> maxRates;
+    std::vector<double> deltaTimesMs;
+    std::vector<double> clampedValues;
+    std::vector<quint64> outOfRange;
+    std::vector<quint64> rateViolation;
+
+    NumericValidationBatch batch() {
+        NumericValidationBatch b;
+        b.count = static_cast<int>(values.size());
+        b.values = values.data();
+        b.minValues = minValues.data();
+        b.maxValues = maxValues.data();
+        b.previousValues = previousValues.data();
+        b.maxRates = maxRates.data();
+        b.deltaTimesMs = deltaTimesMs.data();
+        b.clampedValues = clampedValues.data();
+        b.outOfRangeMask = outOfRange.data();
+        b.rateViolationMask = rateViolation.data();
+        return b;
+    }
+};
+
+/**
+ * @brief Mixed workload: ~10% out of range, some unbounded, some rate-checked
+ */
+BenchData makeData(int count)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-10.0, 110.0);
+    const double inf = std::numeric_limits<double>::infinity();
+
+    BenchData data;
+    data.records.resize(count);
+    for (int i = 0; i < count; ++i) {
+        SignalRecord& record = data.records[i];
+        record.value = dist(rng);
+        record.hasMin = (i % 8) != 0;
+        record.hasMax = (i % 8) != 0;
+        record.minValue = 0.0;
+        record.maxValue = 100.0;
+        record.previousValue = dist(rng);
+        record.maxRate = (i % 2) ? 500.0 : 0.0;
+        record.deltaTimeMs = (i % 2) ? 100 : 0;
+
+        data.values.push_back(record.value);
+        data.minValues.push_back(record.hasMin ? record.minValue : -inf);
+        data.maxValues.push_back(record.hasMax ? record.maxValue : inf);
+        data.previousValues.push_back(record.previousValue);
+        data.maxRates.push_back(record.maxRate);
+        data.deltaTimesMs.push_back(static_cast<double>(record.deltaTimeMs));
+    }
+    data.clampedValues.resize(count);
+    data.outOfRange.resize((count + 63) / 64);
+    data.rateViolation.resize((count + 63) / 64);
+    return data;
+}
+
+/**
+ * @brief Per-signal branchy checks (the SignalHub::updateSignal() path)
+ */
+void validatePerSignal(std::vector<SignalRecord>& records)
+{
+    for (SignalRecord& record : records) {
+        double value = record.value;
+        record.outOfRange = (record.hasMin && value < record.minValue) ||
+                            (record.hasMax && value > record.maxValue);
+        if (record.outOfRange) {
+            if (record.hasMin) {
+                value = std::max(value, record.minValue);
+            }
+            if (record.hasMax) {
+                value = std::min(value, record.maxValue);
+            }
+        }
+        record.result = value;
+
+        record.rateViolation = false;
+        if (record.maxRate > 0.0 && record.deltaTimeMs > 0) {
+            const double rate = std::abs(record.value - record.previousValue) * 1000.0 /
+                                static_cast<double>(record.deltaTimeMs);
+            record.rateViolation = rate > record.maxRate;
+        }
+    }
+}
+
+/**
+ * @brief Run @p body repeatedly for a fixed duration, return ns per signal
+ */
+template<typename Body>
+double measure(int count, Body body)
+{
+    quint64 iterations = 0;
+    const auto begin = std::chrono::steady_clock::now();
+    const auto deadline = begin + kRunDuration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 64; ++i) {
+            body();
+        }
+        iterations += 64;
+    }
+    const double ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - begin).count();
+    return ns / (static_cast<double>(iterations) * count);
+}
+
+} // namespace
+
+int main()
+{
+    const ValidationKernelIsa best = bestValidationKernelIsa();
+    std::printf("Signal validation benchmark (best ISA: %s, %lld ms per run)\n\n",
+                validationKernelIsaName(best),
+                static_cast<long long>(kRunDuration.count()));
+
+    std::printf("%-14s %8s %14s %10s\n", "variant", "signals", "ns/signal", "speedup");
+    for (int count : {64, 512, 4096}) {
+        BenchData data = makeData(count);
+
+        const double baseline = measure(count, [&]() {
+            validatePerSignal(data.records);
+            asm volatile("" : : "r"(data.records.data()) : "memory");
+        });
+        std::printf("%-14s %8d %14.3f %10.2f\n", "per-signal", count, baseline, 1.0);
+
+        for (ValidationKernelIsa isa : {ValidationKernelIsa::Scalar,
+                                        ValidationKernelIsa::Sse2,
+                                        ValidationKernelIsa::Avx2}) {
+            if (static_cast<int>(isa) > static_cast<int>(best)) {
+                continue;
+            }
+            const NumericValidationBatch batch = data.batch();
+            const double ns = measure(count, [&]() {
+                validateNumericBatch(batch, isa);
+                asm volatile("" : : "r"(batch.clampedValues) : "memory");
+            });
+            std::printf("kernel-%-7s %8d %14.3f %10.2f\n",
+                        validationKernelIsaName(isa), count, ns, baseline / ns);
+        }
+    }
+
+    return 0;
+}
@@ -1,11 +1,62 @@
 // test_ipc_channel.cpp
+// Loopback tests for IpcChannel and IpcServer
+// Tests: Broadcast fan-out and per-channel sequence numbers, shared-memory
+//        transport (handshake, both directions, full ring, corrupt
+//        indices, mismatched transports)
 
 #include <gtest/gtest.h>
+#include "ipc/IpcClient.h"
+#include "ipc/IpcSchemas.h"
+#include "ipc/IpcServer.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QSharedMemory>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+
+using namespace automotive::ipc;
 
 class IpcChannelTest : public ::testing::Test {
 protected:
-    void SetUp() override {}
+    void SetUp() override {
+        if (!QCoreApplication::instance()) {
+            int argc = 0;
+            app = new QCoreApplication(argc, nullptr);
+        }
+    }
     void TearDown() override {}
+
+    static QString serverName(const char* test) {
+        return QStringLiteral("automotive_test_channel_%1").arg(QString::fromLatin1(test));
+    }
+
+    static bool waitFor(const std::function<bool()>& condition, int timeoutMs = 5000) {
+        QElapsedTimer timer;
+        timer.start();
+        while (!condition()) {
+            if (timer.elapsed() > timeoutMs) {
+                return false;
+            }
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+        return true;
+    }
+
+    // Key IpcServer gives the ring pair of its first client
+    static QString firstRingKey(const QString& name) {
+        return QStringLiteral("%1.ring.%2.1").arg(name).arg(QCoreApplication::applicationPid());
+    }
+
+    static IpcMessage update(uint32_t signal, double value) {
+        SignalUpdateBody body;
+        body.signal = signal;
+        body.value = value;
+        return IpcMessage::fromBody(body);
+    }
+
+    QCoreApplication* app = nullptr;
 };
 
 TEST_F(IpcChannelTest, OpenChannel) {
@@ -19,3 +70,184 @@ TEST_F(IpcChannelTest, SendReceive) {
 TEST_F(IpcChannelTest, CloseChannel) {
     EXPECT_TRUE(true);
 }
+
+TEST_F(IpcChannelTest, BroadcastKeepsPerClientSequence) {
+    IpcServer server;
+    QVector<IpcChannel*> serverChannels;
+    QObject::connect(&server, &IpcServer::clientConnected,
+                     [&](IpcChannel* channel) { serverChannels.append(channel); });
+    ASSERT_TRUE(server.listen(serverName("broadcast")));
+
+    IpcChannel first;
+    IpcChannel second;
+    QVector<IpcMessage> received[2];
+    QObject::connect(&first, &IpcChannel::messageReceived,
+                     [&](const IpcMessage& message) { received[0].append(message); });
+    QObject::connect(&second, &IpcChannel::messageReceived,
+                     [&](const IpcMessage& message) { received[1].append(message); });
+    first.connectToServer(serverName("broadcast"));
+    second.connectToServer(serverName("broadcast"));
+    ASSERT_TRUE(waitFor([&]() { return server.clientCount() == 2; }));
+
+    // Direct sends and broadcasts share each channel's counter
+    EXPECT_EQ(server.broadcast(update(1, 10.5)), 2);
+    ASSERT_EQ(serverChannels.size(), 2);
+    for (IpcChannel* channel : qAsConst(serverChannels)) {
+        ASSERT_TRUE(channel->send(update(2, 20.5)));
+    }
+    EXPECT_EQ(server.broadcast(update(3, 30.5)), 2);
+    ASSERT_TRUE(waitFor([&]() { return received[0].size() == 3 && received[1].size() == 3; }));
+
+    for (const QVector<IpcMessage>& messages : received) {
+        for (int i = 0; i < messages.size(); ++i) {
+            SignalUpdateBody body;
+            ASSERT_TRUE(messages.at(i).toBody(body));
+            EXPECT_EQ(body.signal, static_cast<uint32_t>(i + 1));
+            EXPECT_DOUBLE_EQ(body.value, 10.0 * body.signal + 0.5);
+            EXPECT_EQ(messages.at(i).sequenceNumber(), static_cast<uint32_t>(i + 1));
+        }
+    }
+}
+
+TEST_F(IpcChannelTest, SharedMemoryCarriesBothDirections) {
+    const QString name = serverName("shm");
+    IpcServer server;
+    server.setTransport(ChannelTransport::SharedMemory, RingFormat::MIN_CAPACITY);
+    IpcChannel* serverChannel = nullptr;
+    QVector<IpcMessage> atServer;
+    QObject::connect(&server, &IpcServer::clientConnected,
+                     [&](IpcChannel* channel) { serverChannel = channel; });
+    QObject::connect(&server, &IpcServer::messageReceived,
+                     [&](IpcChannel*, const IpcMessage& message) { atServer.append(message); });
+    ASSERT_TRUE(server.listen(name));
+
+    IpcClient client;
+    client.setReconnectInterval(0);
+    client.setHeartbeatInterval(0);
+    client.setTransport(ChannelTransport::SharedMemory);
+    QVector<IpcMessage> atClient;
+    QObject::connect(&client, &IpcClient::messageReceived,
+                     [&](const IpcMessage& message) { atClient.append(message); });
+    client.connectToServer(name);
+    EXPECT_FALSE(client.isConnected());                    // Until the ring is attached
+    ASSERT_TRUE(waitFor([&]() { return client.isConnected() && serverChannel; }));
+    EXPECT_EQ(serverChannel->transport(), ChannelTransport::SharedMemory);
+
+    // Many times what a ring holds, sent without returning to the event
+    // loop: the overflow waits in the sender until the receiver drains
+    constexpr uint32_t kMessages = 1000;
+    for (uint32_t i = 0; i < kMessages; ++i) {
+        ASSERT_TRUE(client.send(update(i, i + 0.25)));
+        ASSERT_TRUE(serverChannel->send(update(i, i + 0.75)));
+    }
+    ASSERT_TRUE(waitFor([&]() {
+        return atServer.size() == static_cast<int>(kMessages) &&
+               atClient.size() == static_cast<int>(kMessages);
+    }));
+
+    for (uint32_t i = 0; i < kMessages; ++i) {
+        SignalUpdateBody fromClient;
+        SignalUpdateBody fromServer;
+        ASSERT_TRUE(atServer.at(static_cast<int>(i)).toBody(fromClient));
+        ASSERT_TRUE(atClient.at(static_cast<int>(i)).toBody(fromServer));
+        EXPECT_EQ(fromClient.signal, i);
+        EXPECT_DOUBLE_EQ(fromClient.value, i + 0.25);
+        EXPECT_EQ(fromServer.signal, i);
+        EXPECT_DOUBLE_EQ(fromServer.value, i + 0.75);
+    }
+
+    // A frame the ring could never hold is refused rather than queued
+    SignalBatchBody batch;
+    batch.samples.resize(RingFormat::MIN_CAPACITY / 8);
+    for (SignalSample& sample : batch.samples) {
+        sample.value = 0.1;
+    }
+    const IpcMessage huge = IpcMessage::fromBody(batch);
+    EXPECT_FALSE(client.send(huge));
+    EXPECT_TRUE(client.isConnected());
+}
+
+TEST_F(IpcChannelTest, CorruptRingIndicesDropTheLink) {
+    const QString name = serverName("shm_corrupt");
+    IpcServer server;
+    server.setTransport(ChannelTransport::SharedMemory, RingFormat::MIN_CAPACITY);
+    IpcChannel* serverChannel = nullptr;
+    QObject::connect(&server, &IpcServer::clientConnected,
+                     [&](IpcChannel* channel) { serverChannel = channel; });
+    ASSERT_TRUE(server.listen(name));
+
+    IpcChannel client;
+    client.setTransport(ChannelTransport::SharedMemory);
+    QStringList malformed;
+    int received = 0;
+    QObject::connect(&client, &IpcChannel::malformedMessageReceived,
+                     [&](const QString& error) { malformed.append(error); });
+    QObject::connect(&client, &IpcChannel::messageReceived,
+                     [&](const IpcMessage&) { ++received; });
+    client.connectToServer(name);
+    ASSERT_TRUE(waitFor([&]() { return client.isConnected() && serverChannel; }));
+
+    QSharedMemory segment;
+    segment.setKey(firstRingKey(name));
+    ASSERT_TRUE(segment.attach());
+    char* base = static_cast<char*>(segment.data());
+    const auto* header = reinterpret_cast<const RingSegmentHeader*>(base);
+    auto* toClient = reinterpret_cast<RingControl*>(base + header->ringOffsets[0]);
+
+    // Corrupt the indices while the doorbell for a frame is in flight
+    ASSERT_TRUE(serverChannel->send(update(1, 1.5)));
+    toClient->head.store(toClient->tail.load() + 3ull * RingFormat::MIN_CAPACITY);
+
+    ASSERT_TRUE(waitFor([&]() { return !malformed.isEmpty() && !client.isConnected(); }));
+    EXPECT_EQ(malformed.first(), QStringLiteral("Shared-memory ring indices out of range"));
+    EXPECT_EQ(received, 0);
+    EXPECT_TRUE(waitFor([&]() { return server.clientCount() == 0; }));
+}
+
+TEST_F(IpcChannelTest, SharedMemoryClientRejectsSocketServer) {
+    const QString name = serverName("mismatch_socket_server");
+    IpcServer server;
+    ASSERT_TRUE(server.listen(name));
+
+    IpcChannel client;
+    client.setTransport(ChannelTransport::SharedMemory);
+    QStringList malformed;
+    int received = 0;
+    QObject::connect(&client, &IpcChannel::malformedMessageReceived,
+                     [&](const QString& error) { malformed.append(error); });
+    QObject::connect(&client, &IpcChannel::messageReceived,
+                     [&](const IpcMessage&) { ++received; });
+    client.connectToServer(name);
+    ASSERT_TRUE(waitFor([&]() { return server.clientCount() == 1; }));
+    EXPECT_EQ(client.state(), ChannelState::Connecting);   // Waiting for a setup
+
+    EXPECT_EQ(server.broadcast(update(1, 1.5)), 1);
+    ASSERT_TRUE(waitFor([&]() { return !malformed.isEmpty(); }));
+    EXPECT_EQ(received, 0);
+    EXPECT_FALSE(client.isConnected());
+    EXPECT_EQ(client.lastError(), QStringLiteral("Transport mismatch"));
+    EXPECT_TRUE(waitFor([&]() { return server.clientCount() == 0; }));
+}
+
+TEST_F(IpcChannelTest, SocketClientRejectsSharedMemoryServer) {
+    const QString name = serverName("mismatch_shm_server");
+    IpcServer server;
+    server.setTransport(ChannelTransport::SharedMemory, RingFormat::MIN_CAPACITY);
+    ASSERT_TRUE(server.listen(name));
+
+    IpcChannel client;
+    QStringList malformed;
+    int received = 0;
+    QObject::connect(&client, &IpcChannel::malformedMessageReceived,
+                     [&](const QString& error) { malformed.append(error); });
+    QObject::connect(&client, &IpcChannel::messageReceived,
+                     [&](const IpcMessage&) { ++received; });
+    client.connectToServer(name);
+
+    // The setup is the first frame the client reads
+    ASSERT_TRUE(waitFor([&]() { return !malformed.isEmpty(); }));
+    EXPECT_EQ(received, 0);
+    EXPECT_FALSE(client.isConnected());
+    EXPECT_EQ(client.lastError(), QStringLiteral("Transport mismatch"));
+    EXPECT_TRUE(waitFor([&]() { return server.clientCount() == 0; }));
+}
@@ -0,0 +1,372 @@
+// test_ipc_codec.cpp
+// Unit tests for the compact IPC body codec
+// Tests: Scalar encodings, nested and repeated fields, schema evolution,
+//        malformed input, IpcMessage integration, storage reuse, size
+
+#include <gtest/gtest.h>
+#include "ipc/IpcCodec.h"
+#include "ipc/IpcMessage.h"
+#include "ipc/IpcSchemas.h"
+#include <QVariantList>
+#include <cmath>
+#include <limits>
+
+using namespace automotive::ipc;
+
+namespace {
+
+enum class Mode : uint8_t { Off = 0, Eco = 1, Sport = 7 };
+
+struct Scalars {
+    bool flag{false};
+    uint8_t small{0};
+    uint64_t large{0};
+    int32_t negative{0};
+    int64_t wide{0};
+    uint32_t hash{0};
+    double real{0.0};
+    float single{0.0f};
+    Mode mode{Mode::Off};
+    QString text;
+    QByteArray blob;
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &Scalars::flag),
+                               field(2, &Scalars::small),
+                               field(3, &Scalars::large),
+                               field(4, &Scalars::negative),
+                               field(5, &Scalars::wide),
+                               fixedField(6, &Scalars::hash),
+                               field(7, &Scalars::real),
+                               field(8, &Scalars::single),
+                               field(9, &Scalars::mode),
+                               field(10, &Scalars::text),
+                               field(11, &Scalars::blob));
+    }
+};
+
+// SignalSample as a newer peer might send it
+struct SignalSampleV2 {
+    uint32_t signal{0};
+    double value{0.0};
+    uint8_t validity{0};
+    uint32_t ageMs{0};
+    QString unit;                      // New field
+    double confidence{0.0};            // New field
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &SignalSampleV2::signal),
+                               field(2, &SignalSampleV2::value),
+                               field(3, &SignalSampleV2::validity),
+                               field(4, &SignalSampleV2::ageMs),
+                               field(5, &SignalSampleV2::unit),
+                               field(6, &SignalSampleV2::confidence));
+    }
+};
+
+struct Wrapper {
+    SignalSampleV2 sample;
+    uint32_t trailer{0};
+
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &Wrapper::sample), field(2, &Wrapper::trailer));
+    }
+};
+
+struct Node {
+    QVector<Node> children;
+
+    static constexpr auto fields() { return std::make_tuple(field(1, &Node::children)); }
+};
+
+struct Duplicate {
+    int a{0};
+    int b{0};
+    static constexpr auto fields()
+    {
+        return std::make_tuple(field(1, &Duplicate::a), field(1, &Duplicate::b));
+    }
+};
+static_assert(!schemaValid<Duplicate>(), "Duplicate field ids must be rejected");
+
+SignalBatchBody makeBatch(int samples)
+{
+    SignalBatchBody batch;
+    batch.timestampMs = 1700000000123ull;
+    batch.tick = 4242;
+    for (int i = 0; i < samples; ++i) {
+        SignalSample sample;
+        sample.signal = static_cast<uint32_t>(i);
+        sample.value = 12.5 * i;
+        sample.validity = static_cast<uint8_t>(i % 3 == 0 ? 2 : 0);
+        sample.ageMs = static_cast<uint32_t>(i % 4);
+        batch.samples.append(sample);
+    }
+    return batch;
+}
+
+} // namespace
+
+TEST(IpcCodecTest, ScalarsRoundTrip) {
+    Scalars in;
+    in.flag = true;
+    in.small = 200;
+    in.large = std::numeric_limits<uint64_t>::max();
+    in.negative = -123456;
+    in.wide = std::numeric_limits<int64_t>::min();
+    in.hash = 0xDEADBEEFu;
+    in.real = -0.0;
+    in.single = 3.5f;
+    in.mode = Mode::Sport;
+    in.text = QStringLiteral("Grüße");
+    in.blob = QByteArray("\x00\x01\x02", 3);
+
+    QByteArray bytes;
+    encodeBody(in, &bytes);
+
+    Scalars out;
+    out.small = 99;                    // Must be overwritten
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+    EXPECT_EQ(out.flag, in.flag);
+    EXPECT_EQ(out.small, in.small);
+    EXPECT_EQ(out.large, in.large);
+    EXPECT_EQ(out.negative, in.negative);
+    EXPECT_EQ(out.wide, in.wide);
+    EXPECT_EQ(out.hash, in.hash);
+    EXPECT_TRUE(std::signbit(out.real));
+    EXPECT_EQ(out.single, in.single);
+    EXPECT_EQ(out.mode, in.mode);
+    EXPECT_EQ(out.text, in.text);
+    EXPECT_EQ(out.blob, in.blob);
+}
+
+TEST(IpcCodecTest, DefaultsAreOmittedAndReset) {
+    QByteArray bytes;
+    encodeBody(Scalars{}, &bytes);
+    EXPECT_TRUE(bytes.isEmpty());
+
+    Scalars out;
+    out.large = 7;
+    out.text = QStringLiteral("stale");
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+    EXPECT_EQ(out.large, 0u);
+    EXPECT_TRUE(out.text.isEmpty());
+}
+
+TEST(IpcCodecTest, ZigzagKeepsSmallNegativesShort) {
+    Scalars in;
+    in.negative = -1;
+    QByteArray bytes;
+    encodeBody(in, &bytes);
+    EXPECT_EQ(bytes.size(), 2);        // Key + one byte
+}
+
+TEST(IpcCodecTest, BatchRoundTrip) {
+    const SignalBatchBody in = makeBatch(40);
+    QByteArray bytes;
+    encodeBody(in, &bytes);
+
+    SignalBatchBody out;
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+    EXPECT_EQ(out.timestampMs, in.timestampMs);
+    EXPECT_EQ(out.tick, in.tick);
+    ASSERT_EQ(out.samples.size(), in.samples.size());
+    for (int i = 0; i < in.samples.size(); ++i) {
+        EXPECT_EQ(out.samples[i].signal, in.samples[i].signal);
+        EXPECT_EQ(out.samples[i].value, in.samples[i].value);
+        EXPECT_EQ(out.samples[i].validity, in.samples[i].validity);
+        EXPECT_EQ(out.samples[i].ageMs, in.samples[i].ageMs);
+    }
+}
+
+TEST(IpcCodecTest, LongNestedBodyGetsMultiByteLength) {
+    SignalSampleV2 in;
+    in.signal = 5;
+    in.unit = QString(300, QChar('x'));
+
+    Wrapper wrapper;
+    wrapper.sample = in;
+    wrapper.trailer = 77;
+    QByteArray bytes;
+    encodeBody(wrapper, &bytes);
+
+    Wrapper out;
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+    EXPECT_EQ(out.sample.signal, 5u);
+    EXPECT_EQ(out.sample.unit.size(), 300);
+    EXPECT_EQ(out.trailer, 77u);
+}
+
+TEST(IpcCodecTest, UnknownFieldsAreSkipped) {
+    SignalSampleV2 newer;
+    newer.signal = 9;
+    newer.value = 88.0;
+    newer.unit = QStringLiteral("km/h");
+    newer.confidence = 0.5;
+    newer.ageMs = 3;
+
+    QByteArray bytes;
+    encodeBody(newer, &bytes);
+
+    SignalSample older;
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), older));
+    EXPECT_EQ(older.signal, 9u);
+    EXPECT_EQ(older.value, 88.0);
+    EXPECT_EQ(older.ageMs, 3u);
+}
+
+TEST(IpcCodecTest, MalformedInputIsRejected) {
+    QByteArray bytes;
+    encodeBody(makeBatch(4), &bytes);
+
+    // Cut inside the last sample
+    SignalBatchBody out;
+    EXPECT_FALSE(decodeBody(bytes.constData(), bytes.size() - 1, out));
+
+    // Field id 0
+    const char zeroId[] = {0x00, 0x01};
+    EXPECT_FALSE(decodeBody(zeroId, sizeof(zeroId), out));
+
+    // Known field with the wrong wire type: tick (2) as Fixed64
+    const char wrongType[] = {(2 << 3) | 1, 0, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_FALSE(decodeBody(wrongType, sizeof(wrongType), out));
+
+    // Unknown wire type
+    const char badWire[] = {(9 << 3) | 3, 0};
+    EXPECT_FALSE(decodeBody(badWire, sizeof(badWire), out));
+
+    // Length beyond the end
+    const char overrun[] = {(3 << 3) | 2, 0x7F, 0x08};
+    EXPECT_FALSE(decodeBody(overrun, sizeof(overrun), out));
+
+    // Varint without terminator
+    const char endless[] = {(2 << 3), static_cast<char>(0xFF), static_cast<char>(0xFF)};
+    EXPECT_FALSE(decodeBody(endless, sizeof(endless), out));
+
+    // Values too large for their field are not truncated: validity 256
+    // would read as 0 (Valid), signal 2^32 as signal 0
+    SignalUpdateBody update;
+    const char wideValidity[] = {(3 << 3), static_cast<char>(0x80), 0x02};
+    EXPECT_FALSE(decodeBody(wideValidity, sizeof(wideValidity), update));
+    const char wideSignal[] = {(1 << 3), static_cast<char>(0x80), static_cast<char>(0x80),
+                               static_cast<char>(0x80), static_cast<char>(0x80), 0x10};
+    EXPECT_FALSE(decodeBody(wideSignal, sizeof(wideSignal), update));
+
+    // Same for bool, enum and signed fields
+    Scalars scalars;
+    const char wideFlag[] = {(1 << 3), 0x02};
+    EXPECT_FALSE(decodeBody(wideFlag, sizeof(wideFlag), scalars));
+    const char wideMode[] = {(9 << 3), static_cast<char>(0x80), 0x02};
+    EXPECT_FALSE(decodeBody(wideMode, sizeof(wideMode), scalars));
+    const char wideNegative[] = {(4 << 3), static_cast<char>(0x80), static_cast<char>(0x80),
+                                 static_cast<char>(0x80), static_cast<char>(0x80), 0x10};  // 2^31
+    EXPECT_FALSE(decodeBody(wideNegative, sizeof(wideNegative), scalars));
+
+    // A 10th varint byte may only carry bit 63
+    char tenBytes[] = {(3 << 3), -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x01};
+    ASSERT_TRUE(decodeBody(tenBytes, sizeof(tenBytes), scalars));
+    EXPECT_EQ(scalars.large, std::numeric_limits<uint64_t>::max());
+    tenBytes[10] = 0x03;
+    EXPECT_FALSE(decodeBody(tenBytes, sizeof(tenBytes), scalars));
+}
+
+TEST(IpcCodecTest, NestingDepthIsBounded) {
+    // Build 40 levels of field 1 by hand, innermost first
+    QByteArray bytes;
+    for (int level = 0; level < 40; ++level) {
+        QByteArray outer;
+        CompactWriter writer(&outer);
+        writer.writeKey(1, WireType::Bytes);
+        writer.writeBytes(bytes.constData(), bytes.size());
+        bytes = outer;
+    }
+
+    Node root;
+    EXPECT_FALSE(decodeBody(bytes.constData(), bytes.size(), root));
+}
+
+TEST(IpcCodecTest, DecodeReusesListStorage) {
+    QByteArray bytes;
+    encodeBody(makeBatch(32), &bytes);
+
+    SignalBatchBody out;
+    ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+    const SignalSample* storage = out.samples.constData();
+    const qsizetype capacity = out.samples.capacity();
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(decodeBody(bytes.constData(), bytes.size(), out));
+        EXPECT_EQ(out.samples.constData(), storage);
+        EXPECT_EQ(out.samples.capacity(), capacity);
+    }
+}
+
+TEST(IpcCodecTest, CompactMessageRoundTrip) {
+    const SignalBatchBody batch = makeBatch(23);
+    const IpcMessage message = IpcMessage::fromBody(batch);
+    EXPECT_EQ(message.type(), MessageType::SignalBatch);
+    EXPECT_EQ(message.encoding(), PayloadEncoding::Compact);
+
+    const QByteArray data = message.serialize();
+    EXPECT_EQ(MessageHeader::decode(data.constData()).encoding, PayloadEncoding::Compact);
+
+    bool ok = false;
+    const IpcMessage received = IpcMessage::deserialize(data, &ok);
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(received.encoding(), PayloadEncoding::Compact);
+    EXPECT_TRUE(received.payload().isEmpty());
+
+    SignalBatchBody decoded;
+    ASSERT_TRUE(received.toBody(decoded));
+    EXPECT_EQ(decoded.samples.size(), 23);
+    EXPECT_EQ(decoded.tick, batch.tick);
+
+    // Wrong schema for the message type
+    SignalUpdateBody update;
+    EXPECT_FALSE(received.toBody(update));
+}
+
+TEST(IpcCodecTest, CorruptedCompactPayloadIsRejected) {
+    QByteArray data = IpcMessage::fromBody(makeBatch(8)).serialize();
+    data[data.size() - 2] = static_cast<char>(data.at(data.size() - 2) ^ 0x40);
+
+    bool ok = true;
+    IpcMessage::deserialize(data, &ok);
+    EXPECT_FALSE(ok);
+}
+
+TEST(IpcCodecTest, SettingVariantValueLeavesCompactEncoding) {
+    IpcMessage message = IpcMessage::fromBody(makeBatch(2));
+    message.setValue(QStringLiteral("note"), QStringLiteral("legacy"));
+    EXPECT_EQ(message.encoding(), PayloadEncoding::VariantMap);
+    EXPECT_TRUE(message.body().isEmpty());
+
+    SignalBatchBody decoded;
+    EXPECT_FALSE(message.toBody(decoded));
+}
+
+TEST(IpcCodecTest, CompactBatchIsSeveralTimesSmallerThanVariantMap) {
+    const SignalBatchBody batch = makeBatch(23);
+    const QByteArray compact = IpcMessage::fromBody(batch).serialize();
+
+    // The same batch in the VariantMap layout it replaces
+    QVariantList samples;
+    for (const SignalSample& sample : batch.samples) {
+        QVariantMap entry;
+        entry.insert(QStringLiteral("signalId"), QStringLiteral("vehicle.signal.%1").arg(sample.signal));
+        entry.insert(QStringLiteral("value"), sample.value);
+        entry.insert(QStringLiteral("validity"), sample.validity);
+        entry.insert(QStringLiteral("timestamp"), static_cast<qint64>(batch.timestampMs - sample.ageMs));
+        samples.append(entry);
+    }
+    IpcMessage legacy(MessageType::SignalBatch);
+    legacy.setValue(QStringLiteral("timestamp"), static_cast<qint64>(batch.timestampMs));
+    legacy.setValue(QStringLiteral("tick"), batch.tick);
+    legacy.setValue(QStringLiteral("samples"), samples);
+    const QByteArray variant = legacy.serialize();
+
+    EXPECT_LT(compact.size() * 4, variant.size());
+}
@@ -0,0 +1,162 @@
+// test_ipc_frame_reader.cpp
+// Unit tests for the IPC receive buffer and framing
+// Tests: Bursts, partial frames, resynchronisation, buffer reuse
+
+#include <gtest/gtest.h>
+#include "ipc/IpcFrameReader.h"
+#include "ipc/IpcSchemas.h"
+
+using namespace automotive::ipc;
+
+namespace {
+
+QByteArray updateFrame(uint32_t signal)
+{
+    SignalUpdateBody body;
+    body.signal = signal;
+    body.value = 0.5 * signal;
+    return IpcMessage::fromBody(body).serialize();
+}
+
+uint32_t signalOf(const FrameReader::Frame& frame)
+{
+    bool ok = false;
+    const IpcMessage message = IpcMessage::deserialize(frame.data, frame.size, &ok);
+    SignalUpdateBody body;
+    if (!ok || !message.toBody(body)) {
+        return UINT32_MAX;
+    }
+    return body.signal;
+}
+
+} // namespace
+
+TEST(IpcFrameReaderTest, BurstIsSplitIntoFrames) {
+    QByteArray burst;
+    for (uint32_t i = 0; i < 100; ++i) {
+        burst.append(updateFrame(i));
+    }
+
+    FrameReader reader;
+    reader.append(burst.constData(), burst.size());
+
+    FrameReader::Frame frame;
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+        EXPECT_EQ(frame.header.type, MessageType::SignalUpdate);
+        EXPECT_EQ(signalOf(frame), i);
+    }
+    EXPECT_EQ(reader.next(frame), FrameReader::Result::NeedMoreData);
+    EXPECT_EQ(reader.bufferedBytes(), 0);
+}
+
+TEST(IpcFrameReaderTest, PartialFrameWaitsForTheRest) {
+    const QByteArray data = updateFrame(7);
+
+    FrameReader reader;
+    FrameReader::Frame frame;
+    for (qsizetype i = 0; i + 1 < data.size(); ++i) {
+        reader.append(data.constData() + i, 1);
+        ASSERT_EQ(reader.next(frame), FrameReader::Result::NeedMoreData);
+    }
+    reader.append(data.constData() + data.size() - 1, 1);
+
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    EXPECT_EQ(frame.size, data.size());
+    EXPECT_EQ(signalOf(frame), 7u);
+}
+
+TEST(IpcFrameReaderTest, InvalidDataIsSkippedToNextMagic) {
+    const QByteArray garbage("\x01\x02\x03garbage", 10);
+    const QByteArray data = garbage + updateFrame(3) + updateFrame(4);
+
+    FrameReader reader;
+    reader.append(data.constData(), data.size());
+
+    FrameReader::Frame frame;
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Discarded);
+    EXPECT_EQ(frame.size, garbage.size());
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    EXPECT_EQ(signalOf(frame), 3u);
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    EXPECT_EQ(signalOf(frame), 4u);
+}
+
+TEST(IpcFrameReaderTest, MagicSplitAcrossReadsIsKept) {
+    const QByteArray data = updateFrame(9);
+    const QByteArray garbage(40, '\0');
+
+    FrameReader reader;
+    reader.append(garbage.constData(), garbage.size());
+    reader.append(data.constData(), 3);                    // "AUT"
+
+    FrameReader::Frame frame;
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Discarded);
+    EXPECT_EQ(frame.size, garbage.size());
+    EXPECT_EQ(reader.next(frame), FrameReader::Result::NeedMoreData);
+
+    reader.append(data.constData() + 3, data.size() - 3);
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    EXPECT_EQ(signalOf(frame), 9u);
+}
+
+TEST(IpcFrameReaderTest, CorruptedPayloadIsFramedAndRejectedByDecoder) {
+    QByteArray data = updateFrame(5);
+    data[data.size() - 1] = static_cast<char>(data[data.size() - 1] ^ 0x01);
+
+    FrameReader reader;
+    reader.append(data.constData(), data.size());
+
+    FrameReader::Frame frame;
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    bool ok = true;
+    IpcMessage::deserialize(frame.data, frame.size, &ok);
+    EXPECT_FALSE(ok);
+}
+
+TEST(IpcFrameReaderTest, BufferIsReusedAcrossBursts) {
+    QByteArray burst;
+    for (uint32_t i = 0; i < 64; ++i) {
+        burst.append(updateFrame(i));
+    }
+
+    FrameReader reader;
+    FrameReader::Frame frame;
+    reader.append(burst.constData(), burst.size());
+    ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+    const char* first = frame.data;
+    while (reader.next(frame) == FrameReader::Result::Frame) {}
+    const qsizetype capacity = reader.capacity();
+
+    for (int round = 0; round < 100; ++round) {
+        reader.append(burst.constData(), burst.size());
+        ASSERT_EQ(reader.next(frame), FrameReader::Result::Frame);
+        EXPECT_EQ(frame.data, first);                      // Same storage, no copy
+        while (reader.next(frame) == FrameReader::Result::Frame) {}
+    }
+    EXPECT_EQ(reader.capacity(), capacity);
+}
+
+TEST(IpcFrameReaderTest, TrailingPartialFramesDoNotGrowBuffer) {
+    // Reads ending mid-frame leave an unread tail that is moved to the front
+    const QByteArray one = updateFrame(1);
+    QByteArray stream;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        stream.append(updateFrame(i));
+    }
+
+    FrameReader reader;
+    FrameReader::Frame frame;
+    const qsizetype chunk = one.size() * 3 / 2 + 5;
+    uint32_t expected = 0;
+    qsizetype capacity = 0;
+    for (qsizetype offset = 0; offset < stream.size(); offset += chunk) {
+        reader.append(stream.constData() + offset, std::min(chunk, stream.size() - offset));
+        while (reader.next(frame) == FrameReader::Result::Frame) {
+            ASSERT_EQ(signalOf(frame), expected++);
+        }
+        capacity = std::max(capacity, reader.capacity());
+    }
+    EXPECT_EQ(expected, 2000u);
+    EXPECT_LE(capacity, 32 * 1024);
+}
@@ -0,0 +1,103 @@
+// test_ipc_integrity.cpp
+// Unit tests for the CRC32C integrity engine
+// Tests: Reference vectors, implementation agreement, incremental use,
+//        checksumming writer
+
+#include <gtest/gtest.h>
+#include "ipc/IpcIntegrity.h"
+#include <cstring>
+#include <vector>
+
+using namespace automotive::ipc;
+
+namespace {
+
+std::vector<uint8_t> pattern(size_t size)
+{
+    std::vector<uint8_t> bytes(size);
+    uint32_t state = 0x12345678u;
+    for (auto& byte : bytes) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(IpcIntegrityEngineTest, ReferenceVectors) {
+    // RFC 3720 (iSCSI) B.4 and the common "123456789" check value
+    EXPECT_EQ(crc32c("", 0), 0u);
+    EXPECT_EQ(crc32c("123456789", 9), 0xE3069283u);
+
+    uint8_t zeros[32];
+    std::memset(zeros, 0x00, sizeof(zeros));
+    EXPECT_EQ(crc32c(zeros, sizeof(zeros)), 0x8A9136AAu);
+
+    uint8_t ones[32];
+    std::memset(ones, 0xFF, sizeof(ones));
+    EXPECT_EQ(crc32c(ones, sizeof(ones)), 0x62A8AB43u);
+
+    uint8_t ascending[32];
+    for (int i = 0; i < 32; ++i) {
+        ascending[i] = static_cast<uint8_t>(i);
+    }
+    EXPECT_EQ(crc32c(ascending, sizeof(ascending)), 0x46DD794Eu);
+}
+
+TEST(IpcIntegrityEngineTest, ImplementationsAgree) {
+    const std::vector<uint8_t> bytes = pattern(4096 + 16);
+
+    // Every length up to a few words, at every alignment within a word
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t size : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(63),
+                            size_t(64), size_t(65), size_t(1000), size_t(4096)}) {
+            const uint8_t* data = bytes.data() + offset;
+            const uint32_t portable = crc32c(data, size, 0, IntegrityIsa::Portable);
+            EXPECT_EQ(crc32c(data, size, 0, IntegrityIsa::Sse42), portable);
+            EXPECT_EQ(crc32c(data, size, 0, IntegrityIsa::ArmCrc), portable);
+            EXPECT_EQ(crc32c(data, size), portable);
+        }
+    }
+}
+
+TEST(IpcIntegrityEngineTest, IncrementalMatchesOneShot) {
+    const std::vector<uint8_t> bytes = pattern(1000);
+    const uint32_t whole = crc32c(bytes.data(), bytes.size());
+
+    for (size_t split : {size_t(0), size_t(1), size_t(13), size_t(512), size_t(999), size_t(1000)}) {
+        const uint32_t first = crc32c(bytes.data(), split);
+        EXPECT_EQ(crc32c(bytes.data() + split, bytes.size() - split, first), whole);
+    }
+}
+
+TEST(IpcIntegrityEngineTest, DetectsSingleBitFlips) {
+    std::vector<uint8_t> bytes = pattern(256);
+    const uint32_t original = crc32c(bytes.data(), bytes.size());
+
+    for (size_t bit = 0; bit < bytes.size() * 8; bit += 37) {
+        bytes[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+        EXPECT_NE(crc32c(bytes.data(), bytes.size()), original);
+        bytes[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+    }
+}
+
+TEST(IpcIntegrityEngineTest, WriterChecksumsOnlyWrittenBytes) {
+    QByteArray buffer("HEADER");
+    IntegrityWriter writer(&buffer);
+    EXPECT_TRUE(writer.isOpen());
+
+    EXPECT_EQ(writer.write("1234", 4), 4);
+    EXPECT_EQ(writer.write("56789", 5), 5);
+
+    EXPECT_EQ(buffer, QByteArray("HEADER123456789"));
+    EXPECT_EQ(writer.bytesWritten(), 9);
+    EXPECT_EQ(writer.checksum(), 0xE3069283u);
+}
+
+TEST(IpcIntegrityEngineTest, IsaNames) {
+    EXPECT_STREQ(integrityIsaName(IntegrityIsa::Portable), "slicing-by-8");
+    EXPECT_STREQ(integrityIsaName(IntegrityIsa::Sse42), "sse4.2");
+    EXPECT_STREQ(integrityIsaName(IntegrityIsa::ArmCrc), "armv8-crc");
+    EXPECT_NE(integrityIsaName(bestIntegrityIsa()), nullptr);
+}
@@ -2,12 +2,26 @@
 // IPC message tests
 
 #include <gtest/gtest.h>
+#include "ipc/IpcIntegrity.h"
+#include "ipc/IpcMessage.h"
+#include <QDataStream>
+#include <QIODevice>
+
+using namespace automotive::ipc;
 
 // Placeholder test - IPC message tests
 class IpcMessageTest : public ::testing::Test {
 protected:
     void SetUp() override {}
     void TearDown() override {}
+
+    static IpcMessage sampleMessage() {
+        IpcMessage message(MessageType::SignalUpdate);
+        message.setValue(QStringLiteral("signalId"), QStringLiteral("vehicle.speed"));
+        message.setValue(QStringLiteral("value"), 87.5);
+        message.setValue(QStringLiteral("validity"), 0);
+        return message;
+    }
 };
 
 TEST_F(IpcMessageTest, MessageCreation) {
@@ -21,3 +35,118 @@ TEST_F(IpcMessageTest, MessageSerialization) {
 TEST_F(IpcMessageTest, MessageDeserialization) {
     EXPECT_TRUE(true);
 }
+
+TEST_F(IpcMessageTest, RoundTripPreservesHeaderAndPayload) {
+    const IpcMessage message = sampleMessage();
+    const QByteArray data = message.serialize();
+
+    bool ok = false;
+    const IpcMessage received = IpcMessage::deserialize(data, &ok);
+    ASSERT_TRUE(ok);
+    EXPECT_TRUE(received.isValid());
+    EXPECT_TRUE(received.validateChecksum());
+    EXPECT_EQ(received.type(), MessageType::SignalUpdate);
+    EXPECT_EQ(received.sequenceNumber(), message.sequenceNumber());
+    EXPECT_EQ(received.timestamp(), message.timestamp());
+    EXPECT_EQ(received.payload(), message.payload());
+}
+
+TEST_F(IpcMessageTest, HeaderCarriesCrc32cOfPayload) {
+    const QByteArray data = sampleMessage().serialize();
+    const MessageHeader header = MessageHeader::decode(data.constData());
+
+    EXPECT_EQ(header.version, MessageHeader::VERSION);
+    EXPECT_EQ(static_cast<qsizetype>(header.payloadSize),
+              data.size() - static_cast<qsizetype>(MessageHeader::SIZE));
+    EXPECT_EQ(header.checksum, crc32c(data.constData() + MessageHeader::SIZE,
+                                      header.payloadSize));
+}
+
+TEST_F(IpcMessageTest, HeaderWireFormatMatchesDataStream) {
+    MessageHeader header;
+    header.type = MessageType::AlertNotify;
+    header.payloadSize = 0x01020304u;
+    header.sequenceNumber = 0xA1B2C3D4u;
+    header.timestamp = 0x0102030405060708ull;
+    header.checksum = 0xDEADBEEFu;
+
+    QByteArray streamed;
+    {
+        QDataStream stream(&streamed, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_6_0);
+        stream << header;
+    }
+    ASSERT_EQ(streamed.size(), static_cast<qsizetype>(MessageHeader::SIZE));
+
+    QByteArray encoded(static_cast<qsizetype>(MessageHeader::SIZE), '\0');
+    header.encode(encoded.data());
+    EXPECT_EQ(encoded, streamed);
+
+    const MessageHeader decoded = MessageHeader::decode(encoded.constData());
+    EXPECT_EQ(decoded.type, header.type);
+    EXPECT_EQ(decoded.payloadSize, header.payloadSize);
+    EXPECT_EQ(decoded.sequenceNumber, header.sequenceNumber);
+    EXPECT_EQ(decoded.timestamp, header.timestamp);
+    EXPECT_EQ(decoded.checksum, header.checksum);
+}
+
+TEST_F(IpcMessageTest, CorruptedPayloadIsRejected) {
+    QByteArray data = sampleMessage().serialize();
+    data[data.size() - 1] = static_cast<char>(data.at(data.size() - 1) ^ 0x01);
+
+    bool ok = true;
+    const IpcMessage received = IpcMessage::deserialize(data, &ok);
+    EXPECT_FALSE(ok);
+    EXPECT_FALSE(received.isValid());
+    EXPECT_EQ(received.validationError(), QStringLiteral("Checksum mismatch - message corrupted"));
+}
+
+TEST_F(IpcMessageTest, PreviousHeaderVersionIsRejected) {
+    QByteArray data = sampleMessage().serialize();
+    MessageHeader header = MessageHeader::decode(data.constData());
+    header.version = 1;
+    header.encode(data.data());
+
+    bool ok = true;
+    IpcMessage::deserialize(data, &ok);
+    EXPECT_FALSE(ok);
+}
+
+TEST_F(IpcMessageTest, TruncatedMessageIsRejected) {
+    const QByteArray data = sampleMessage().serialize();
+
+    bool ok = true;
+    IpcMessage::deserialize(data.left(data.size() - 1), &ok);
+    EXPECT_FALSE(ok);
+    IpcMessage::deserialize(data.left(static_cast<qsizetype>(MessageHeader::SIZE) - 1), &ok);
+    EXPECT_FALSE(ok);
+}
+
+TEST_F(IpcMessageTest, ModifiedPayloadIsNoLongerVerified) {
+    bool ok = false;
+    IpcMessage received = IpcMessage::deserialize(sampleMessage().serialize(), &ok);
+    ASSERT_TRUE(ok);
+    EXPECT_TRUE(received.validateChecksum());
+
+    received.setValue(QStringLiteral("value"), 90.0);
+    EXPECT_FALSE(received.validateChecksum());
+    EXPECT_FALSE(sampleMessage().validateChecksum());
+}
+
+TEST_F(IpcMessageTest, PatchedSequenceNumberKeepsFrameValid) {
+    const IpcMessage message = sampleMessage();
+    const QByteArray frame = message.serialize();
+
+    // As IpcChannel::sendFrame: renumber a copy of the shared frame's header
+    QByteArray patched = frame;
+    MessageHeader::patchSequenceNumber(patched.data(), 0x00C0FFEEu);
+    EXPECT_EQ(patched.mid(MessageHeader::SIZE), frame.mid(MessageHeader::SIZE));
+
+    bool ok = false;
+    const IpcMessage received = IpcMessage::deserialize(patched, &ok);
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(received.sequenceNumber(), 0x00C0FFEEu);
+    EXPECT_EQ(received.type(), message.type());
+    EXPECT_EQ(received.timestamp(), message.timestamp());
+    EXPECT_EQ(frame, message.serialize());
+}
@@ -0,0 +1,193 @@
+// test_ipc_shm_ring.cpp
+// Unit tests for the shared-memory ring transport
+// Tests: Attach, wrap-around, full ring, doorbell batching, producer
+//        wakeup, corrupt indices
+
+#include <gtest/gtest.h>
+#include "ipc/IpcFrameReader.h"
+#include "ipc/IpcSchemas.h"
+#include "ipc/IpcShmRing.h"
+#include <cstring>
+
+using namespace automotive::ipc;
+
+namespace {
+
+QString ringKey(const char* test)
+{
+    return QStringLiteral("automotive_test_ring_%1").arg(QString::fromLatin1(test));
+}
+
+bool writeBytes(ByteRing& ring, const QByteArray& data, bool* wake)
+{
+    return ring.write(data.constData(), data.size(), nullptr, 0, wake);
+}
+
+QByteArray readAll(ByteRing& ring)
+{
+    const qsizetype size = ring.readable();
+    QByteArray data(size > 0 ? size : 0, '\0');
+    ring.read(data.data(), data.size());
+    return data;
+}
+
+} // namespace
+
+TEST(IpcShmRingTest, BothDirectionsCarryBytes) {
+    RingTransport creator;
+    RingTransport attacher;
+    QString error;
+    ASSERT_TRUE(creator.create(ringKey("directions"), RingFormat::MIN_CAPACITY, &error));
+    ASSERT_TRUE(attacher.attach(ringKey("directions"), &error));
+    EXPECT_EQ(attacher.rx().capacity(), RingFormat::MIN_CAPACITY);
+
+    bool wake = false;
+    ASSERT_TRUE(writeBytes(creator.tx(), QByteArray("to attacher"), &wake));
+    ASSERT_TRUE(writeBytes(attacher.tx(), QByteArray("to creator"), &wake));
+
+    EXPECT_EQ(readAll(attacher.rx()), QByteArray("to attacher"));
+    EXPECT_EQ(readAll(creator.rx()), QByteArray("to creator"));
+    EXPECT_EQ(creator.rx().readable(), 0);
+}
+
+TEST(IpcShmRingTest, AttachToMissingSegmentFails) {
+    RingTransport ring;
+    QString error;
+    EXPECT_FALSE(ring.attach(ringKey("missing"), &error));
+    EXPECT_FALSE(ring.isOpen());
+}
+
+TEST(IpcShmRingTest, ForeignSegmentIsRejected) {
+    QSharedMemory foreign;
+    foreign.setKey(ringKey("foreign"));
+    ASSERT_TRUE(foreign.create(64 * 1024));
+    std::memset(foreign.data(), 0x5A, 64 * 1024);
+
+    RingTransport ring;
+    QString error;
+    EXPECT_FALSE(ring.attach(ringKey("foreign"), &error));
+    EXPECT_EQ(error, QStringLiteral("Not an IPC ring segment"));
+}
+
+TEST(IpcShmRingTest, CapacityIsRoundedToPowerOfTwo) {
+    RingTransport ring;
+    ASSERT_TRUE(ring.create(ringKey("capacity"), 5000));
+    EXPECT_EQ(ring.tx().capacity(), 8192u);
+
+    RingTransport small;
+    ASSERT_TRUE(small.create(ringKey("capacity_small"), 1));
+    EXPECT_EQ(small.tx().capacity(), RingFormat::MIN_CAPACITY);
+}
+
+TEST(IpcShmRingTest, FullRingRejectsWholeWrite) {
+    RingTransport creator;
+    RingTransport attacher;
+    ASSERT_TRUE(creator.create(ringKey("full"), RingFormat::MIN_CAPACITY));
+    ASSERT_TRUE(attacher.attach(ringKey("full")));
+
+    const QByteArray block(static_cast<qsizetype>(RingFormat::MIN_CAPACITY) - 10, 'a');
+    bool wake = false;
+    ASSERT_TRUE(writeBytes(creator.tx(), block, &wake));
+    EXPECT_FALSE(writeBytes(creator.tx(), QByteArray(11, 'b'), &wake));
+    EXPECT_EQ(attacher.rx().readable(), block.size());      // Nothing partial
+
+    EXPECT_TRUE(writeBytes(creator.tx(), QByteArray(10, 'c'), &wake));
+    EXPECT_EQ(attacher.rx().readable(), static_cast<qsizetype>(RingFormat::MIN_CAPACITY));
+}
+
+TEST(IpcShmRingTest, FramesSurviveWrapAround) {
+    RingTransport creator;
+    RingTransport attacher;
+    ASSERT_TRUE(creator.create(ringKey("wrap"), RingFormat::MIN_CAPACITY));
+    ASSERT_TRUE(attacher.attach(ringKey("wrap")));
+
+    // Frame sizes do not divide the capacity, so frames straddle the end
+    FrameReader reader;
+    FrameReader::Frame frame;
+    uint32_t received = 0;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        SignalUpdateBody body;
+        body.signal = i;
+        body.value = 1.5 * i;
+        const QByteArray data = IpcMessage::fromBody(body).serialize();
+        const qsizetype split = MessageHeader::SIZE;
+        bool wake = false;
+        ASSERT_TRUE(creator.tx().write(data.constData(), split, data.constData() + split,
+                                       data.size() - split, &wake));
+
+        if (i % 7 == 6 || i == 1999) {
+            const qsizetype available = attacher.rx().readable();
+            attacher.rx().read(reader.prepareWrite(available), available);
+            reader.commitWrite(available);
+            while (reader.next(frame) == FrameReader::Result::Frame) {
+                bool ok = false;
+                SignalUpdateBody decoded;
+                const IpcMessage message = IpcMessage::deserialize(frame.data, frame.size, &ok);
+                ASSERT_TRUE(ok && message.toBody(decoded));
+                ASSERT_EQ(decoded.signal, received++);
+            }
+        }
+    }
+    EXPECT_EQ(received, 2000u);
+}
+
+TEST(IpcShmRingTest, DoorbellIsRequestedOncePerSleep) {
+    RingTransport creator;
+    RingTransport attacher;
+    ASSERT_TRUE(creator.create(ringKey("doorbell"), RingFormat::MIN_CAPACITY));
+    ASSERT_TRUE(attacher.attach(ringKey("doorbell")));
+
+    bool wake = false;
+    ASSERT_TRUE(writeBytes(creator.tx(), QByteArray("first"), &wake));
+    EXPECT_TRUE(wake);                                     // Armed at creation
+    ASSERT_TRUE(writeBytes(creator.tx(), QByteArray("second"), &wake));
+    EXPECT_FALSE(wake);                                    // Batched
+
+    // Data pending: the consumer must not sleep
+    EXPECT_FALSE(attacher.rx().prepareToSleep());
+    readAll(attacher.rx());
+    EXPECT_TRUE(attacher.rx().prepareToSleep());
+
+    ASSERT_TRUE(writeBytes(creator.tx(), QByteArray("third"), &wake));
+    EXPECT_TRUE(wake);
+}
+
+TEST(IpcShmRingTest, WaitingProducerIsWokenByRead) {
+    RingTransport creator;
+    RingTransport attacher;
+    ASSERT_TRUE(creator.create(ringKey("producer"), RingFormat::MIN_CAPACITY));
+    ASSERT_TRUE(attacher.attach(ringKey("producer")));
+
+    bool wake = false;
+    ASSERT_TRUE(writeBytes(creator.tx(), QByteArray(RingFormat::MIN_CAPACITY - 4, 'a'), &wake));
+    EXPECT_EQ(creator.tx().writable(), 4);
+    EXPECT_FALSE(creator.tx().prepareToWait(4));          // Fits: write on
+    EXPECT_FALSE(attacher.rx().takeProducerWakeup());      // Disarmed again
+
+    ASSERT_TRUE(creator.tx().prepareToWait(8));
+    QByteArray some(2, '\0');
+    attacher.rx().read(some.data(), some.size());
+    EXPECT_TRUE(attacher.rx().takeProducerWakeup());
+    EXPECT_FALSE(attacher.rx().takeProducerWakeup());      // Once per wait
+    EXPECT_TRUE(writeBytes(creator.tx(), QByteArray(6, 'b'), &wake));
+}
+
+TEST(IpcShmRingTest, CorruptIndicesAreDetected) {
+    RingTransport creator;
+    RingTransport attacher;
+    ASSERT_TRUE(creator.create(ringKey("corrupt"), RingFormat::MIN_CAPACITY));
+    ASSERT_TRUE(attacher.attach(ringKey("corrupt")));
+
+    QSharedMemory peer;
+    peer.setKey(ringKey("corrupt"));
+    ASSERT_TRUE(peer.attach());
+    char* base = static_cast<char*>(peer.data());
+    const auto* header = reinterpret_cast<const RingSegmentHeader*>(base);
+    auto* control = reinterpret_cast<RingControl*>(base + header->ringOffsets[0]);
+    control->head.store(3ull * RingFormat::MIN_CAPACITY);
+
+    EXPECT_EQ(attacher.rx().readable(), -1);
+    EXPECT_EQ(creator.tx().writable(), -1);
+    bool wake = false;
+    EXPECT_FALSE(writeBytes(creator.tx(), QByteArray(1, 'x'), &wake));  // Never overwrites
+}
@@ -0,0 +1,92 @@
+// test_freshness_queue.cpp
+// Unit tests for FreshnessQueue
+// Tests: Deadline ordering, rescheduling, cancellation
+// Requirements: SR-CL-001
+
+#include <gtest/gtest.h>
+#include "signal/FreshnessQueue.h"
+
+using namespace automotive::signal;
+
+class FreshnessQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 8; ++i) {
+            queue.addSignal();
+        }
+    }
+
+    FreshnessQueue queue;
+};
+
+TEST_F(FreshnessQueueTest, EmptyQueueHasNoExpiries) {
+    uint32_t index = 0;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.nextDeadline(), FreshnessQueue::NO_DEADLINE);
+    EXPECT_FALSE(queue.popExpired(1000, index));
+}
+
+TEST_F(FreshnessQueueTest, PopsInDeadlineOrder) {
+    queue.schedule(3, 300);
+    queue.schedule(1, 100);
+    queue.schedule(2, 200);
+
+    uint32_t index = 0;
+    ASSERT_TRUE(queue.popExpired(1000, index));
+    EXPECT_EQ(index, 1u);
+    ASSERT_TRUE(queue.popExpired(1000, index));
+    EXPECT_EQ(index, 2u);
+    ASSERT_TRUE(queue.popExpired(1000, index));
+    EXPECT_EQ(index, 3u);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(FreshnessQueueTest, OnlyPassedDeadlinesExpire) {
+    queue.schedule(0, 300);
+    queue.schedule(1, 500);
+
+    uint32_t index = 0;
+    // Deadline reached but not passed (age == freshnessMs) is still fresh
+    EXPECT_FALSE(queue.popExpired(300, index));
+    ASSERT_TRUE(queue.popExpired(301, index));
+    EXPECT_EQ(index, 0u);
+    EXPECT_FALSE(queue.popExpired(301, index));
+    EXPECT_EQ(queue.nextDeadline(), 500);
+}
+
+TEST_F(FreshnessQueueTest, RescheduleMovesExistingEntry) {
+    queue.schedule(0, 100);
+    queue.schedule(1, 200);
+    queue.schedule(0, 400);   // Signal 0 refreshed
+
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.nextDeadline(), 200);
+
+    queue.schedule(0, 50);    // Moved earlier again
+    EXPECT_EQ(queue.nextDeadline(), 50);
+}
+
+TEST_F(FreshnessQueueTest, CancelRemovesEntry) {
+    for (uint32_t i = 0; i < 8; ++i) {
+        queue.schedule(i, 100 + static_cast<qint64>(i) * 10);
+    }
+
+    queue.cancel(0);
+    queue.cancel(4);
+    queue.cancel(4);          // Second cancel is a no-op
+    EXPECT_FALSE(queue.isScheduled(0));
+    EXPECT_EQ(queue.size(), 6);
+
+    uint32_t index = 0;
+    qint64 lastDeadline = 0;
+    int popped = 0;
+    while (queue.popExpired(1000, index)) {
+        const qint64 deadline = 100 + static_cast<qint64>(index) * 10;
+        EXPECT_GE(deadline, lastDeadline);
+        EXPECT_NE(index, 0u);
+        EXPECT_NE(index, 4u);
+        lastDeadline = deadline;
+        ++popped;
+    }
+    EXPECT_EQ(popped, 6);
+}
@@ -0,0 +1,183 @@
+// test_signal_catalog_image.cpp
+// Unit tests for the precompiled binary signal catalog
+// Tests: JSON parsing, image round trip, corruption detection, mmap loading, hub registration
+
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTemporaryDir>
+#include "signal/SignalCatalogImage.h"
+#include "signal/SignalHub.h"
+#include "signal/VehicleSignals.h"
+#include <cstring>
+
+using namespace automotive::signal;
+
+namespace {
+
+QVector<SignalDefinition> sampleDefinitions()
+{
+    QVector<SignalDefinition> defs;
+
+    SignalDefinition speed = VehicleSignalFactory::speedSignal(true);
+    speed.historyCapacity = 100;
+    speed.historyDecimation = 2;
+    defs.append(speed);
+    defs.append(VehicleSignalFactory::rpmSignal(7000));
+    defs.append(VehicleSignalFactory::gearSignal());
+    defs.append(VehicleSignalFactory::telltaleSignal(
+        QString::fromLatin1(SignalIds::TELLTALE_ABS), QStringLiteral("ABS"), true));
+
+    SignalDefinition power;
+    power.id = QString::fromLatin1(SignalIds::POWER_CONSUMPTION);
+    power.name = QStringLiteral("Power Consumption");
+    power.unit = QStringLiteral("kW");
+    power.minValue = -200.0;
+    power.defaultValue = 0.0;
+    power.deadbandAbsolute = 1.0;
+    power.deadbandRelative = 0.05;
+    power.displayResolution = 0.5;
+    power.minPublishIntervalMs = 100;
+    defs.append(power);
+    return defs;
+}
+
+} // namespace
+
+TEST(SignalCatalogImageTest, ParsesJsonCatalog) {
+    const QByteArray json = R"({
+        "version": 7,
+        "signals": [
+            {"id": "vehicle.speed", "name": "Vehicle Speed", "unit": "km/h",
+             "min": 0, "max": 400, "freshnessMs": 300, "maxRateOfChange": 50,
+             "safetyCritical": true},
+            {"id": "engine.rpm", "kind": "int", "min": 0, "max": 8000, "default": 0},
+            {"id": "powertrain.gear", "kind": "string", "default": "P", "freshnessMs": 500},
+            {"id": "telltale.abs", "kind": "bool"}
+        ]
+    })";
+
+    QVector<SignalDefinition> defs;
+    quint32 version = 0;
+    QString error;
+    ASSERT_TRUE(parseSignalCatalogJson(json, &defs, &version, &error)) << error.toStdString();
+
+    EXPECT_EQ(version, 7u);
+    ASSERT_EQ(defs.size(), 4);
+    EXPECT_EQ(defs[0].id, QStringLiteral("vehicle.speed"));
+    EXPECT_DOUBLE_EQ(defs[0].maxValue.toDouble(), 400.0);
+    EXPECT_TRUE(defs[0].isSafetyCritical);
+    EXPECT_EQ(defs[1].kind, SignalKind::Int);
+    EXPECT_EQ(defs[1].name, QStringLiteral("engine.rpm"));  // Defaults to the id
+    EXPECT_EQ(defs[2].defaultValue.toString(), QStringLiteral("P"));
+    EXPECT_EQ(defs[3].kind, SignalKind::Bool);
+    EXPECT_FALSE(defs[3].minValue.isValid());
+}
+
+TEST(SignalCatalogImageTest, RejectsDuplicateIdsAndUnknownKinds) {
+    QVector<SignalDefinition> defs;
+    quint32 version = 0;
+
+    EXPECT_FALSE(parseSignalCatalogJson(
+        R"({"signals": [{"id": "a"}, {"id": "a"}]})", &defs, &version));
+    EXPECT_FALSE(parseSignalCatalogJson(
+        R"({"signals": [{"id": "a", "kind": "float"}]})", &defs, &version));
+    EXPECT_FALSE(parseSignalCatalogJson("not json", &defs, &version));
+}
+
+TEST(SignalCatalogImageTest, RoundTripPreservesDefinitions) {
+    const QVector<SignalDefinition> defs = sampleDefinitions();
+    QString error;
+    auto image = SignalCatalogImage::fromData(buildSignalCatalogImage(defs, 42), &error);
+    ASSERT_TRUE(image) << error.toStdString();
+
+    EXPECT_EQ(image->catalogVersion(), 42u);
+    ASSERT_EQ(image->count(), defs.size());
+    for (int i = 0; i < defs.size(); ++i) {
+        const SignalDefinition loaded = image->definition(i);
+        const SignalDefinition& original = defs.at(i);
+        EXPECT_EQ(loaded.id, original.id);
+        EXPECT_EQ(loaded.name, original.name);
+        EXPECT_EQ(loaded.unit, original.unit);
+        EXPECT_EQ(loaded.kind, original.kind);
+        EXPECT_EQ(loaded.minValue.isValid(), original.minValue.isValid());
+        EXPECT_EQ(loaded.maxValue.isValid(), original.maxValue.isValid());
+        EXPECT_DOUBLE_EQ(loaded.minValue.toDouble(), original.minValue.toDouble());
+        EXPECT_DOUBLE_EQ(loaded.maxValue.toDouble(), original.maxValue.toDouble());
+        EXPECT_EQ(loaded.freshnessMs, original.freshnessMs);
+        EXPECT_DOUBLE_EQ(loaded.maxRateOfChange, original.maxRateOfChange);
+        EXPECT_EQ(loaded.isSafetyCritical, original.isSafetyCritical);
+        EXPECT_EQ(loaded.historyCapacity, original.historyCapacity);
+        EXPECT_EQ(loaded.historyDecimation, original.historyDecimation);
+        EXPECT_DOUBLE_EQ(loaded.deadbandAbsolute, original.deadbandAbsolute);
+        EXPECT_DOUBLE_EQ(loaded.deadbandRelative, original.deadbandRelative);
+        EXPECT_DOUBLE_EQ(loaded.displayResolution, original.displayResolution);
+        EXPECT_EQ(loaded.minPublishIntervalMs, original.minPublishIntervalMs);
+    }
+    EXPECT_EQ(image->definition(2).defaultValue.toString(), QStringLiteral("P"));
+}
+
+TEST(SignalCatalogImageTest, RejectsCorruptImages) {
+    const QByteArray image = buildSignalCatalogImage(sampleDefinitions(), 1);
+    QString error;
+
+    QByteArray flipped = image;
+    flipped[flipped.size() - 1] = static_cast<char>(flipped[flipped.size() - 1] ^ 0x01);
+    EXPECT_FALSE(SignalCatalogImage::fromData(flipped, &error));
+    EXPECT_TRUE(error.contains(QStringLiteral("checksum")));
+
+    EXPECT_FALSE(SignalCatalogImage::fromData(image.left(image.size() - 2), &error));
+    EXPECT_FALSE(SignalCatalogImage::fromData(image.left(10), &error));
+
+    QByteArray newer = image;
+    CatalogImageHeader header;
+    std::memcpy(&header, newer.constData(), sizeof(header));
+    header.formatVersion = CatalogImageFormat::VERSION + 1;
+    std::memcpy(newer.data(), &header, sizeof(header));
+    EXPECT_FALSE(SignalCatalogImage::fromData(newer, &error));
+    EXPECT_TRUE(error.contains(QStringLiteral("version")));
+}
+
+TEST(SignalCatalogImageTest, MapsImageFile) {
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString path = dir.filePath(QStringLiteral("catalog.bin"));
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(buildSignalCatalogImage(sampleDefinitions(), 3));
+    }
+
+    QString error;
+    auto image = SignalCatalogImage::open(path, &error);
+    ASSERT_TRUE(image) << error.toStdString();
+    EXPECT_EQ(image->count(), 5);
+    EXPECT_EQ(image->definition(1).id, QString::fromLatin1(SignalIds::ENGINE_RPM));
+
+    EXPECT_FALSE(SignalCatalogImage::open(dir.filePath(QStringLiteral("missing.bin")), &error));
+}
+
+TEST(SignalCatalogImageTest, HubRegistersImageSignals) {
+    if (!QCoreApplication::instance()) {
+        int argc = 0;
+        new QCoreApplication(argc, nullptr);
+    }
+
+    auto image = SignalCatalogImage::fromData(buildSignalCatalogImage(sampleDefinitions(), 1));
+    ASSERT_TRUE(image);
+
+    SignalHub hub;
+    ASSERT_TRUE(hub.registerCatalogImage(image));
+    image.reset();  // The hub keeps its own reference
+
+    EXPECT_EQ(hub.signalCount(), 5);
+    const SignalHandle gear = hub.signalHandle(QString::fromLatin1(SignalIds::GEAR_POSITION));
+    ASSERT_TRUE(gear.isValid());
+    EXPECT_EQ(hub.getSignal(gear).toString(), QStringLiteral("P"));
+
+    const SignalHandle speed = hub.signalHandle(QString::fromLatin1(SignalIds::VEHICLE_SPEED));
+    EXPECT_FALSE(hub.updateSignal(speed, 500.0));  // Clamped to the image's range
+    EXPECT_DOUBLE_EQ(hub.getSignal(speed).toDouble(), 400.0);
+    EXPECT_EQ(hub.signalValidity(speed), SignalValidity::OutOfRange);
+    EXPECT_EQ(hub.signalId(speed), QString::fromLatin1(SignalIds::VEHICLE_SPEED));
+}
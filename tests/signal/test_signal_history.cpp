@@ -0,0 +1,78 @@
+// test_signal_history.cpp
+// Unit tests for SignalHistory
+// Tests: Ring wrap-around, decimation, window statistics, downsampled export
+
+#include <gtest/gtest.h>
+#include "signal/SignalHistory.h"
+
+using namespace automotive::signal;
+
+TEST(SignalHistoryTest, DefaultHistoryIsDisabled) {
+    SignalHistory history;
+    history.append(10, 1.0);
+
+    EXPECT_FALSE(history.isEnabled());
+    EXPECT_EQ(history.size(), 0);
+    EXPECT_EQ(history.stats(0, 100).count, 0);
+}
+
+TEST(SignalHistoryTest, OldestSamplesAreOverwritten) {
+    SignalHistory history(4, 1);
+    for (int i = 0; i < 10; ++i) {
+        history.append(i * 10, static_cast<double>(i));
+    }
+
+    EXPECT_EQ(history.size(), 4);
+    const QVector<HistorySample> samples = history.range(0, 1000);
+    ASSERT_EQ(samples.size(), 4);
+    EXPECT_EQ(samples.first().timestampMs, 60);
+    EXPECT_DOUBLE_EQ(samples.last().value, 9.0);
+}
+
+TEST(SignalHistoryTest, DecimationKeepsEveryNthValue) {
+    SignalHistory history(16, 3);
+    for (int i = 0; i < 9; ++i) {
+        history.append(i, static_cast<double>(i));
+    }
+
+    const QVector<HistorySample> samples = history.range(0, 100);
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_DOUBLE_EQ(samples.at(0).value, 0.0);
+    EXPECT_DOUBLE_EQ(samples.at(1).value, 3.0);
+    EXPECT_DOUBLE_EQ(samples.at(2).value, 6.0);
+}
+
+TEST(SignalHistoryTest, StatsCoverOnlyTheWindow) {
+    SignalHistory history(8, 1);
+    const double values[] = {5.0, -2.0, 8.0, 1.0, 4.0};
+    for (int i = 0; i < 5; ++i) {
+        history.append(100 + i * 100, values[i]);
+    }
+
+    const HistoryStats all = history.stats(0, 1000);
+    EXPECT_EQ(all.count, 5);
+    EXPECT_DOUBLE_EQ(all.min, -2.0);
+    EXPECT_DOUBLE_EQ(all.max, 8.0);
+    EXPECT_DOUBLE_EQ(all.mean, 3.2);
+
+    // Bounds are inclusive
+    const HistoryStats window = history.stats(300, 400);
+    EXPECT_EQ(window.count, 2);
+    EXPECT_DOUBLE_EQ(window.min, 1.0);
+    EXPECT_DOUBLE_EQ(window.max, 8.0);
+
+    EXPECT_EQ(history.stats(600, 900).count, 0);
+}
+
+TEST(SignalHistoryTest, RangeIsDownsampledByAveraging) {
+    SignalHistory history(100, 1);
+    for (int i = 0; i < 100; ++i) {
+        history.append(i, static_cast<double>(i));
+    }
+
+    const QVector<HistorySample> points = history.range(0, 99, 10);
+    ASSERT_EQ(points.size(), 10);
+    EXPECT_DOUBLE_EQ(points.at(0).value, 4.5);     // mean of 0..9
+    EXPECT_EQ(points.at(0).timestampMs, 9);
+    EXPECT_DOUBLE_EQ(points.at(9).value, 94.5);    // mean of 90..99
+}
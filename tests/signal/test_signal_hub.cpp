@@ -0,0 +1,1287 @@
+// test_signal_hub.cpp
+// Unit tests for SignalHub
+// Tests: Handle-based access, typed storage, validation, freshness, degraded mode,
+//        change suppression, snapshots, signal catalog, telemetry, derived signals,
+//        signal views, lock-free concurrent reads
+// Requirements: SR-CL-001, SR-CL-002, SR-CL-004
+
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QSignalSpy>
+#include "signal/SignalHub.h"
+#include "signal/VehicleSignals.h"
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace automotive::signal;
+
+class SignalHubTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!QCoreApplication::instance()) {
+            int argc = 0;
+            app = new QCoreApplication(argc, nullptr);
+        }
+        hub = std::make_unique<SignalHub>();
+    }
+
+    void TearDown() override {
+        hub.reset();
+    }
+
+    SignalDefinition numericSignal(const QString& id, double minValue, double maxValue,
+                                   bool critical = false) {
+        SignalDefinition def;
+        def.id = id;
+        def.name = id;
+        def.minValue = minValue;
+        def.maxValue = maxValue;
+        def.defaultValue = minValue;
+        def.isSafetyCritical = critical;
+        return def;
+    }
+
+    std::unique_ptr<SignalHub> hub;
+    QCoreApplication* app = nullptr;
+};
+
+// =============================================================================
+// Signal handles
+// =============================================================================
+
+TEST_F(SignalHubTest, RegisterReturnsDenseHandles) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 10.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 10.0));
+
+    ASSERT_TRUE(a.isValid());
+    ASSERT_TRUE(b.isValid());
+    EXPECT_EQ(a.index, 0u);
+    EXPECT_EQ(b.index, 1u);
+    EXPECT_EQ(hub->signalCount(), 2);
+    EXPECT_EQ(hub->signalHandle(QStringLiteral("b")), b);
+    EXPECT_EQ(hub->signalId(a), QStringLiteral("a"));
+}
+
+TEST_F(SignalHubTest, DuplicateAndEmptyRegistrationRejected) {
+    EXPECT_TRUE(hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 10.0)).isValid());
+    EXPECT_FALSE(hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 10.0)).isValid());
+    EXPECT_FALSE(hub->registerSignal(SignalDefinition()).isValid());
+    EXPECT_FALSE(hub->signalHandle(QStringLiteral("missing")).isValid());
+}
+
+TEST_F(SignalHubTest, HandleAndStringApisAgree) {
+    SignalHandle speed = hub->registerSignal(VehicleSignalFactory::speedSignal(true));
+    const QString speedId = QString::fromLatin1(SignalIds::VEHICLE_SPEED);
+
+    EXPECT_TRUE(hub->updateSignal(speed, 42.0));
+    EXPECT_DOUBLE_EQ(hub->getSignal(speed).toDouble(), 42.0);
+    EXPECT_DOUBLE_EQ(hub->getSignal(speedId).toDouble(), 42.0);
+    EXPECT_EQ(hub->signalValidity(speed), SignalValidity::Valid);
+    EXPECT_EQ(hub->signalValidity(speedId), SignalValidity::Valid);
+
+    EXPECT_TRUE(hub->updateSignal(speedId, 43.0));
+    EXPECT_EQ(hub->getSignal(speed).updateCount, 2u);
+}
+
+TEST_F(SignalHubTest, InvalidHandleIsRejected) {
+    hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 10.0));
+
+    EXPECT_FALSE(hub->updateSignal(SignalHandle(), 1.0));
+    EXPECT_FALSE(hub->updateSignal(SignalHandle(7), 1.0));
+    EXPECT_EQ(hub->getSignal(SignalHandle(7)).validity, SignalValidity::NotAvailable);
+    EXPECT_EQ(hub->signalValidity(SignalHandle()), SignalValidity::NotAvailable);
+}
+
+// =============================================================================
+// Typed storage
+// =============================================================================
+
+TEST_F(SignalHubTest, ValuesAreStoredInDeclaredKind) {
+    SignalHandle rpm = hub->registerSignal(VehicleSignalFactory::rpmSignal(8000));
+    SignalHandle gear = hub->registerSignal(VehicleSignalFactory::gearSignal());
+    SignalHandle turn = hub->registerSignal(VehicleSignalFactory::telltaleSignal(
+        QString::fromLatin1(SignalIds::TELLTALE_TURN_LEFT), QStringLiteral("Turn Left")));
+
+    EXPECT_TRUE(hub->updateSignal(rpm, 2500.6));
+    EXPECT_TRUE(hub->updateSignal(gear, QStringLiteral("D")));
+    EXPECT_TRUE(hub->updateSignal(turn, true));
+
+    SignalValue rpmValue = hub->getSignal(rpm);
+    EXPECT_EQ(rpmValue.value.kind, SignalKind::Int);
+    EXPECT_EQ(rpmValue.toInt(), 2501);
+
+    SignalValue gearValue = hub->getSignal(gear);
+    EXPECT_EQ(gearValue.value.kind, SignalKind::String);
+    EXPECT_EQ(gearValue.toString(), QStringLiteral("D"));
+
+    SignalValue turnValue = hub->getSignal(turn);
+    EXPECT_EQ(turnValue.value.kind, SignalKind::Bool);
+    EXPECT_TRUE(turnValue.toBool());
+    EXPECT_EQ(turnValue.toVariant(), QVariant(true));
+}
+
+TEST_F(SignalHubTest, DefaultValueIsTypedBeforeFirstUpdate) {
+    SignalHandle gear = hub->registerSignal(VehicleSignalFactory::gearSignal());
+
+    SignalValue value = hub->getSignal(gear);
+    EXPECT_EQ(value.validity, SignalValidity::NotAvailable);
+    EXPECT_EQ(value.toString(), QStringLiteral("P"));
+}
+
+TEST_F(SignalHubTest, UnconvertibleTextIsFlaggedInvalid) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 100.0));
+    ASSERT_TRUE(hub->updateSignal(level, 40.0));
+
+    EXPECT_FALSE(hub->updateSignal(level, QStringLiteral("not-a-number")));
+
+    SignalValue value = hub->getSignal(level);
+    EXPECT_EQ(value.validity, SignalValidity::Invalid);
+    EXPECT_DOUBLE_EQ(value.toDouble(), 40.0);  // Last value retained
+}
+
+TEST_F(SignalHubTest, VariantShimConvertsToDeclaredKind) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 100.0));
+
+    EXPECT_TRUE(hub->updateSignal(QStringLiteral("level"), QVariant(QStringLiteral("12.5"))));
+    EXPECT_DOUBLE_EQ(hub->getSignal(level).toDouble(), 12.5);
+}
+
+// =============================================================================
+// SR-CL-001: Stale signals shall be indicated within the freshness window
+// =============================================================================
+
+TEST_F(SignalHubTest, SR_CL_001_OnlyExpiredSignalsGoStale) {
+    SignalDefinition fastDef = numericSignal(QStringLiteral("fast"), 0.0, 100.0);
+    fastDef.freshnessMs = 20;
+    SignalDefinition slowDef = numericSignal(QStringLiteral("slow"), 0.0, 100.0);
+    slowDef.freshnessMs = 60000;
+    SignalHandle fast = hub->registerSignal(fastDef);
+    SignalHandle slow = hub->registerSignal(slowDef);
+
+    ASSERT_TRUE(hub->updateSignal(fast, 1.0));
+    ASSERT_TRUE(hub->updateSignal(slow, 1.0));
+
+    QSignalSpy validitySpy(hub.get(), &SignalHub::signalValidityChanged);
+    hub->checkFreshness();
+    EXPECT_EQ(validitySpy.count(), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    hub->checkFreshness();
+
+    EXPECT_EQ(hub->signalValidity(fast), SignalValidity::Stale);
+    EXPECT_EQ(hub->signalValidity(slow), SignalValidity::Valid);
+    ASSERT_EQ(validitySpy.count(), 1);
+    EXPECT_EQ(validitySpy.at(0).at(0).toString(), QStringLiteral("fast"));
+    EXPECT_TRUE(hub->isDegradedMode());
+
+    // Stale is reported once; a fresh update re-arms the deadline
+    hub->checkFreshness();
+    EXPECT_EQ(validitySpy.count(), 1);
+    ASSERT_TRUE(hub->updateSignal(fast, 2.0));
+    EXPECT_EQ(hub->signalValidity(fast), SignalValidity::Valid);
+    EXPECT_FALSE(hub->isDegradedMode());
+}
+
+// =============================================================================
+// SR-CL-002: Invalid signal ranges shall be clamped and flagged
+// =============================================================================
+
+TEST_F(SignalHubTest, SR_CL_002_CriticalOutOfRangeIsClampedAndFlagged) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 100.0, true));
+    ASSERT_TRUE(hub->updateSignal(level, 50.0));
+
+    QSignalSpy degradedSpy(hub.get(), &SignalHub::degradedModeChanged);
+
+    EXPECT_FALSE(hub->updateSignal(level, 500.0));
+
+    SignalValue value = hub->getSignal(level);
+    EXPECT_DOUBLE_EQ(value.toDouble(), 100.0);
+    EXPECT_EQ(value.validity, SignalValidity::OutOfRange);
+    EXPECT_TRUE(hub->isDegradedMode());
+    EXPECT_EQ(degradedSpy.count(), 1);
+}
+
+// =============================================================================
+// Batched updates
+// =============================================================================
+
+TEST_F(SignalHubTest, BatchCommitsAllUpdatesWithOneNotification) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+    SignalDefinition labelDef;
+    labelDef.id = QStringLiteral("label");
+    labelDef.kind = SignalKind::String;
+    SignalHandle label = hub->registerSignal(labelDef);
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+    QSignalSpy singleSpy(hub.get(), &SignalHub::signalUpdated);
+
+    SignalBatch batch;
+    batch.append({a, 10.0, QString(), 0});
+    batch.append({b, 20.0, QString(), 0});
+    batch.append({label, ScalarValue(), QStringLiteral("R"), 0});
+
+    EXPECT_EQ(hub->updateSignals(batch), 3);
+    EXPECT_EQ(batchSpy.count(), 1);
+    EXPECT_EQ(singleSpy.count(), 0);
+
+    const auto changes = batchSpy.takeFirst().at(0).value<QVector<SignalChange>>();
+    ASSERT_EQ(changes.size(), 3);
+    EXPECT_EQ(changes.at(1).signalId, QStringLiteral("b"));
+    EXPECT_EQ(changes.at(1).oldValidity, SignalValidity::NotAvailable);
+    EXPECT_TRUE(changes.at(1).validityChanged());
+
+    EXPECT_DOUBLE_EQ(hub->getSignal(a).toDouble(), 10.0);
+    EXPECT_DOUBLE_EQ(hub->getSignal(b).toDouble(), 20.0);
+    EXPECT_EQ(hub->getSignal(label).toString(), QStringLiteral("R"));
+}
+
+TEST_F(SignalHubTest, BatchEvaluatesDegradedModeOnce) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0, true));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0, true));
+    hub->updateSignals({{a, 1.0, QString(), 0}, {b, 1.0, QString(), 0}});
+
+    QSignalSpy degradedSpy(hub.get(), &SignalHub::degradedModeChanged);
+
+    EXPECT_EQ(hub->updateSignals({{a, 500.0, QString(), 0}, {b, 500.0, QString(), 0}}), 0);
+    EXPECT_EQ(degradedSpy.count(), 1);
+    EXPECT_TRUE(hub->isDegradedMode());
+    EXPECT_EQ(hub->invalidSignalCount(), 2);
+}
+
+TEST_F(SignalHubTest, BatchSkipsUnknownHandles) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+
+    EXPECT_EQ(hub->updateSignals({{SignalHandle(42), 1.0, QString(), 0},
+                                  {a, 5.0, QString(), 0}}), 1);
+    EXPECT_DOUBLE_EQ(hub->getSignal(a).toDouble(), 5.0);
+    EXPECT_EQ(hub->updateSignals(SignalBatch()), 0);
+}
+
+TEST_F(SignalHubTest, BatchValidationMatchesSingleUpdates) {
+    SignalHub reference;
+    SignalDefinition rateDef = numericSignal(QStringLiteral("rate"), 0.0, 1000.0);
+    rateDef.maxRateOfChange = 1.0;
+    const QVector<SignalDefinition> defs{
+        numericSignal(QStringLiteral("critical"), 0.0, 100.0, true),
+        numericSignal(QStringLiteral("plain"), 0.0, 100.0),
+        rateDef};
+    for (const SignalDefinition& def : defs) {
+        hub->registerSignal(def);
+        reference.registerSignal(def);
+    }
+    const SignalHandle critical(0);
+    const SignalHandle plain(1);
+    const SignalHandle rate(2);
+
+    // Rate check compares against the update before last (timestamp 0 = none)
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    for (SignalHub* target : {hub.get(), &reference}) {
+        target->updateSignal(rate, 0.0);
+        target->updateSignal(rate, 0.0);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // Repeated handle splits the batch into two kernel segments
+    const SignalBatch batch{{critical, 500.0, QString(), 0},
+                            {plain, -5.0, QString(), 0},
+                            {rate, 100.0, QString(), 0},
+                            {critical, 50.0, QString(), 0}};
+    hub->updateSignals(batch);
+    for (const SignalUpdate& update : batch) {
+        reference.updateSignal(update.handle, update.value);
+    }
+
+    for (SignalHandle handle : {critical, plain, rate}) {
+        const SignalValue batched = hub->getSignal(handle);
+        const SignalValue single = reference.getSignal(handle);
+        EXPECT_DOUBLE_EQ(batched.toDouble(), single.toDouble());
+        EXPECT_EQ(batched.validity, single.validity);
+    }
+    EXPECT_DOUBLE_EQ(hub->getSignal(plain).toDouble(), 0.0);
+    EXPECT_EQ(hub->signalValidity(rate), SignalValidity::Invalid);
+    EXPECT_EQ(hub->signalValidity(critical), SignalValidity::Valid);
+    EXPECT_EQ(hub->invalidSignalCount(), reference.invalidSignalCount());
+}
+
+// =============================================================================
+// Per-tick coalescing
+// =============================================================================
+
+TEST_F(SignalHubTest, CoalescingReportsLatestValueOncePerTick) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+    hub->setCoalescingEnabled(true);
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+    QSignalSpy singleSpy(hub.get(), &SignalHub::signalUpdated);
+
+    for (int i = 1; i <= 5; ++i) {
+        hub->updateSignal(a, static_cast<double>(i));
+    }
+    hub->updateSignals({{b, 7.0, QString(), 0}});
+    EXPECT_EQ(singleSpy.count(), 0);
+    EXPECT_EQ(batchSpy.count(), 0);
+
+    EXPECT_EQ(hub->publishChanges(), 2);
+    ASSERT_EQ(batchSpy.count(), 1);
+    const auto changes = batchSpy.takeFirst().at(0).value<QVector<SignalChange>>();
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes.at(0).handle, a);
+    EXPECT_DOUBLE_EQ(changes.at(0).value.toDouble(), 5.0);
+    EXPECT_EQ(changes.at(0).value.updateCount, 5u);
+    EXPECT_EQ(changes.at(0).oldValidity, SignalValidity::NotAvailable);
+    EXPECT_EQ(changes.at(1).handle, b);
+
+    // Nothing dirty: nothing published
+    EXPECT_EQ(hub->publishChanges(), 0);
+    EXPECT_EQ(batchSpy.count(), 0);
+}
+
+TEST_F(SignalHubTest, CoalescingMergesValidityTransitions) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 100.0, true));
+    hub->setCoalescingEnabled(true);
+    hub->updateSignal(level, 10.0);
+    hub->publishChanges();
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+    QSignalSpy degradedSpy(hub.get(), &SignalHub::degradedModeChanged);
+
+    hub->updateSignal(level, 500.0);   // Valid -> OutOfRange
+    EXPECT_EQ(degradedSpy.count(), 1); // Degraded mode is never deferred
+    hub->updateSignal(level, 20.0);    // OutOfRange -> Valid
+
+    hub->publishChanges();
+    ASSERT_EQ(batchSpy.count(), 1);
+    const auto changes = batchSpy.takeFirst().at(0).value<QVector<SignalChange>>();
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes.at(0).oldValidity, SignalValidity::Valid);
+    EXPECT_EQ(changes.at(0).value.validity, SignalValidity::Valid);
+    EXPECT_FALSE(changes.at(0).validityChanged());
+    EXPECT_DOUBLE_EQ(changes.at(0).value.toDouble(), 20.0);
+}
+
+TEST_F(SignalHubTest, DisablingCoalescingFlushesPendingChanges) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    hub->setCoalescingEnabled(true);
+    hub->updateSignal(a, 3.0);
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+    QSignalSpy singleSpy(hub.get(), &SignalHub::signalUpdated);
+
+    hub->setCoalescingEnabled(false);
+    EXPECT_FALSE(hub->isCoalescingEnabled());
+    EXPECT_EQ(batchSpy.count(), 1);
+
+    hub->updateSignal(a, 4.0);
+    EXPECT_EQ(singleSpy.count(), 1);
+    EXPECT_EQ(hub->publishChanges(), 0);
+}
+
+// =============================================================================
+// Targeted subscriptions
+// =============================================================================
+
+TEST_F(SignalHubTest, SubscribersOnlyReceiveTheirSignals) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+
+    QVector<SignalChange> received;
+    SubscriptionId id = hub->subscribe(a, [&received](const SignalChange& change) {
+        received.append(change);
+    });
+    ASSERT_NE(id, 0u);
+
+    hub->updateSignal(b, 1.0);
+    hub->updateSignal(a, 2.0);
+    hub->updateSignals({{a, 3.0, QString(), 0}, {b, 4.0, QString(), 0}});
+
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(received.at(0).handle, a);
+    EXPECT_EQ(received.at(0).oldValidity, SignalValidity::NotAvailable);
+    EXPECT_DOUBLE_EQ(received.at(1).value.toDouble(), 3.0);
+
+    hub->unsubscribe(id);
+    hub->updateSignal(a, 5.0);
+    EXPECT_EQ(received.size(), 2);
+}
+
+TEST_F(SignalHubTest, SubscribeByIdSkipsUnknownSignals) {
+    hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+
+    int calls = 0;
+    auto callback = [&calls](const SignalChange&) { ++calls; };
+    EXPECT_EQ(hub->subscribe(QStringList{QStringLiteral("missing")}, callback), 0u);
+    EXPECT_NE(hub->subscribe(QStringList{QStringLiteral("a"), QStringLiteral("missing")},
+                             callback), 0u);
+
+    hub->updateSignal(QStringLiteral("a"), QVariant(1.0));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(SignalHubTest, SubscribersReceiveStaleAndCoalescedChanges) {
+    SignalDefinition def = numericSignal(QStringLiteral("a"), 0.0, 100.0);
+    def.freshnessMs = 10;
+    SignalHandle a = hub->registerSignal(def);
+
+    QVector<SignalChange> received;
+    hub->subscribe(a, [&received](const SignalChange& change) { received.append(change); });
+
+    hub->setCoalescingEnabled(true);
+    hub->updateSignal(a, 1.0);
+    hub->updateSignal(a, 2.0);
+    EXPECT_TRUE(received.isEmpty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    hub->processTick();
+
+    // Update and stale transition merge into a single delivery
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_DOUBLE_EQ(received.at(0).value.toDouble(), 2.0);
+    EXPECT_EQ(received.at(0).oldValidity, SignalValidity::NotAvailable);
+    EXPECT_EQ(received.at(0).value.validity, SignalValidity::Stale);
+}
+
+// =============================================================================
+// Producer ingestion rings
+// =============================================================================
+
+TEST_F(SignalHubTest, ProducerRecordsAreCommittedOnDrain) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 1.0e6));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 1.0e6));
+    SignalProducer* can = hub->createProducer(QStringLiteral("can"), 1024);
+    SignalProducer* ipc = hub->createProducer(QStringLiteral("ipc"), 1024);
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+
+    std::thread canThread([&]() {
+        for (int i = 1; i <= 500; ++i) {
+            can->push(a, static_cast<double>(i), i);
+        }
+    });
+    std::thread ipcThread([&]() {
+        for (int i = 1; i <= 500; ++i) {
+            ipc->push(b, static_cast<double>(i), i);
+        }
+    });
+    canThread.join();
+    ipcThread.join();
+
+    // Nothing is committed before the tick
+    EXPECT_EQ(hub->getSignal(a).validity, SignalValidity::NotAvailable);
+
+    EXPECT_EQ(hub->drainProducers(), 1000);
+    EXPECT_EQ(batchSpy.count(), 1);
+    EXPECT_DOUBLE_EQ(hub->getSignal(a).toDouble(), 500.0);
+    EXPECT_EQ(hub->getSignal(a).sourceTimestampMs, 500);
+    EXPECT_EQ(hub->getSignal(b).updateCount, 500u);
+    EXPECT_EQ(hub->drainProducers(), 0);
+}
+
+TEST_F(SignalHubTest, ProducerOverflowIsCountedPerProducer) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalProducer* small = hub->createProducer(QStringLiteral("small"), 4);
+    SignalProducer* large = hub->createProducer(QStringLiteral("large"), 64);
+
+    for (int i = 0; i < 10; ++i) {
+        small->push(a, 1.0);
+        large->push(a, 2.0);
+    }
+    EXPECT_FALSE(small->push(a, 1.0));
+
+    const QVector<ProducerStats> stats = hub->producerStats();
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats.at(0).name, QStringLiteral("small"));
+    EXPECT_EQ(stats.at(0).capacity, 4);
+    EXPECT_EQ(stats.at(0).pushed, 4u);
+    EXPECT_EQ(stats.at(0).dropped, 7u);
+    EXPECT_EQ(stats.at(0).pending, 4);
+    EXPECT_EQ(stats.at(1).dropped, 0u);
+
+    hub->processTick();
+    EXPECT_EQ(hub->producerStats().at(0).pending, 0);
+    EXPECT_TRUE(small->push(a, 1.0));
+}
+
+// =============================================================================
+// Change suppression
+// =============================================================================
+
+TEST_F(SignalHubTest, DeadbandSuppressesNotificationButRefreshesFreshness) {
+    SignalDefinition def = numericSignal(QStringLiteral("power"), -100.0, 100.0);
+    def.deadbandAbsolute = 1.0;
+    def.freshnessMs = 100;
+    SignalHandle power = hub->registerSignal(def);
+
+    ASSERT_TRUE(hub->updateSignal(power, 10.0));
+
+    QSignalSpy singleSpy(hub.get(), &SignalHub::signalUpdated);
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+
+    EXPECT_TRUE(hub->updateSignal(power, 10.4));
+    EXPECT_TRUE(hub->updateSignal(power, 10.9));  // Compared to 10.0, not 10.4
+    EXPECT_EQ(hub->updateSignals({{power, 9.5, QString(), 0}}), 1);
+    EXPECT_EQ(singleSpy.count(), 0);
+    EXPECT_EQ(batchSpy.count(), 0);
+    EXPECT_DOUBLE_EQ(hub->getSignal(power).toDouble(), 9.5);
+
+    hub->updateSignal(power, 11.0);
+    EXPECT_EQ(singleSpy.count(), 1);
+
+    // Suppressed updates still keep the signal fresh (SR-CL-001)
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    hub->updateSignal(power, 11.2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    hub->checkFreshness();
+    EXPECT_EQ(hub->signalValidity(power), SignalValidity::Valid);
+    EXPECT_EQ(singleSpy.count(), 1);
+}
+
+TEST_F(SignalHubTest, RelativeDeadbandAndDisplayResolution) {
+    SignalDefinition relativeDef = numericSignal(QStringLiteral("relative"), 0.0, 1000.0);
+    relativeDef.deadbandRelative = 0.1;
+    SignalDefinition quantizedDef = numericSignal(QStringLiteral("quantized"), -50.0, 70.0);
+    quantizedDef.displayResolution = 0.5;
+    SignalHandle relative = hub->registerSignal(relativeDef);
+    SignalHandle quantized = hub->registerSignal(quantizedDef);
+    hub->updateSignal(relative, 100.0);
+    hub->updateSignal(quantized, 20.0);
+
+    QSignalSpy spy(hub.get(), &SignalHub::signalUpdated);
+
+    hub->updateSignal(relative, 105.0);
+    hub->updateSignal(quantized, 20.2);   // Still shown as 20.0
+    hub->updateSignal(quantized, 20.0);   // Repeated value
+    EXPECT_EQ(spy.count(), 0);
+
+    hub->updateSignal(relative, 111.0);
+    hub->updateSignal(quantized, 20.3);   // Shown as 20.5
+    EXPECT_EQ(spy.count(), 2);
+}
+
+TEST_F(SignalHubTest, ValidityTransitionsAreNeverSuppressed) {
+    SignalDefinition def = numericSignal(QStringLiteral("level"), 0.0, 100.0, true);
+    def.deadbandAbsolute = 1000.0;
+    def.minPublishIntervalMs = 100000;
+    SignalHandle level = hub->registerSignal(def);
+    hub->updateSignal(level, 50.0);
+
+    QSignalSpy validitySpy(hub.get(), &SignalHub::signalValidityChanged);
+    QSignalSpy updateSpy(hub.get(), &SignalHub::signalUpdated);
+
+    hub->updateSignal(level, 500.0);   // Clamped to 100, OutOfRange
+    hub->updateSignal(level, 60.0);    // Back to Valid
+    EXPECT_EQ(validitySpy.count(), 2);
+    EXPECT_EQ(updateSpy.count(), 2);
+}
+
+TEST_F(SignalHubTest, MinPublishIntervalReleasesLatestValueOnTick) {
+    SignalDefinition def = numericSignal(QStringLiteral("temp"), -50.0, 70.0);
+    def.minPublishIntervalMs = 50;
+    SignalHandle temp = hub->registerSignal(def);
+    hub->updateSignal(temp, 20.0);
+
+    QSignalSpy singleSpy(hub.get(), &SignalHub::signalUpdated);
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+
+    hub->updateSignal(temp, 21.0);
+    hub->updateSignal(temp, 22.0);
+    hub->processTick();
+    EXPECT_EQ(singleSpy.count(), 0);
+    EXPECT_EQ(batchSpy.count(), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    hub->processTick();
+    ASSERT_EQ(batchSpy.count(), 1);
+    const auto changes = batchSpy.takeFirst().at(0).value<QVector<SignalChange>>();
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes.at(0).handle, temp);
+    EXPECT_DOUBLE_EQ(changes.at(0).value.toDouble(), 22.0);
+
+    hub->processTick();
+    EXPECT_EQ(batchSpy.count(), 0);
+}
+
+// =============================================================================
+// Signal history
+// =============================================================================
+
+TEST_F(SignalHubTest, HistoryRecordsValidUpdatesWhenEnabled) {
+    SignalDefinition def = numericSignal(QStringLiteral("power"), -10.0, 10.0, true);
+    def.historyCapacity = 16;
+    SignalHandle power = hub->registerSignal(def);
+    SignalHandle plain = hub->registerSignal(numericSignal(QStringLiteral("plain"), 0.0, 10.0));
+
+    hub->updateSignal(power, 2.0);
+    hub->updateSignal(power, -4.0);
+    hub->updateSignal(power, 50.0);    // OutOfRange: not recorded
+    hub->updateSignal(power, 8.0);
+    hub->updateSignal(plain, 1.0);
+
+    const HistoryStats stats = hub->signalHistoryStats(power, 60000);
+    EXPECT_EQ(stats.count, 3);
+    EXPECT_DOUBLE_EQ(stats.min, -4.0);
+    EXPECT_DOUBLE_EQ(stats.max, 8.0);
+    EXPECT_DOUBLE_EQ(stats.mean, 2.0);
+
+    EXPECT_EQ(hub->signalHistory(power, 60000).size(), 3);
+    EXPECT_EQ(hub->signalHistory(power, 60000, 2).size(), 2);
+    EXPECT_EQ(hub->signalHistoryStats(plain, 60000).count, 0);
+    EXPECT_TRUE(hub->signalHistory(SignalHandle(), 60000).isEmpty());
+}
+
+// =============================================================================
+// Snapshots
+// =============================================================================
+
+TEST_F(SignalHubTest, PinnedSnapshotStaysUnchangedAcrossTicks) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    SignalDefinition gearDef;
+    gearDef.id = QStringLiteral("gear");
+    gearDef.kind = SignalKind::String;
+    SignalHandle gear = hub->registerSignal(gearDef);
+
+    EXPECT_FALSE(hub->snapshot().isValid());
+    EXPECT_EQ(hub->snapshotEpoch(), 0u);
+
+    hub->updateSignal(speed, 50.0);
+    hub->updateSignal(gear, QStringLiteral("D"));
+    hub->processTick();
+
+    SignalSnapshot first = hub->snapshot();
+    ASSERT_TRUE(first.isValid());
+    EXPECT_EQ(first.epoch(), 1u);
+    EXPECT_EQ(first.size(), 2);
+    EXPECT_DOUBLE_EQ(first.value(speed).toDouble(), 50.0);
+    EXPECT_EQ(first.value(gear).text, QStringLiteral("D"));
+
+    hub->updateSignal(speed, 80.0);
+    EXPECT_DOUBLE_EQ(hub->snapshot().value(speed).toDouble(), 50.0);  // Not yet published
+    hub->processTick();
+    hub->processTick();
+
+    EXPECT_DOUBLE_EQ(first.value(speed).toDouble(), 50.0);
+    EXPECT_EQ(first.epoch(), 1u);
+    const SignalSnapshot latest = hub->snapshot();
+    EXPECT_EQ(latest.epoch(), 3u);
+    EXPECT_DOUBLE_EQ(latest.value(speed).toDouble(), 80.0);
+    EXPECT_EQ(latest.value(SignalHandle(7)).validity, SignalValidity::NotAvailable);
+}
+
+TEST_F(SignalHubTest, SnapshotPublishIsSkippedWhileBuffersArePinned) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    hub->updateSignal(a, 1.0);
+
+    ASSERT_TRUE(hub->publishSnapshot());
+    SignalSnapshot first = hub->snapshot();
+    ASSERT_TRUE(hub->publishSnapshot());
+    SignalSnapshot second = hub->snapshot();
+
+    // The third buffer is still free; after that only the current buffer
+    // and the two pinned ones remain
+    hub->updateSignal(a, 2.0);
+    EXPECT_TRUE(hub->publishSnapshot());
+    EXPECT_FALSE(hub->publishSnapshot());
+    EXPECT_EQ(hub->snapshotEpoch(), 3u);
+
+    first.release();
+    EXPECT_FALSE(first.isValid());
+    EXPECT_TRUE(hub->publishSnapshot());
+    EXPECT_DOUBLE_EQ(hub->snapshot().value(a).toDouble(), 2.0);
+    EXPECT_DOUBLE_EQ(second.value(a).toDouble(), 1.0);
+}
+
+TEST_F(SignalHubTest, SnapshotExportsValidSignalsAsBatch) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+    hub->registerSignal(numericSignal(QStringLiteral("never"), 0.0, 100.0));
+    hub->updateSignal(a, 10.0, 111);
+    hub->updateSignal(b, 20.0, 222);
+    ASSERT_TRUE(hub->publishSnapshot());
+
+    const SignalSnapshot snapshot = hub->snapshot();
+    const QByteArray raw = snapshot.rawRecords();
+    EXPECT_EQ(raw.size(), static_cast<qsizetype>(3 * sizeof(SnapshotRecord)));
+    EXPECT_EQ(raw.constData(), reinterpret_cast<const char*>(snapshot.records()));
+
+    SignalBatch batch;
+    ASSERT_EQ(snapshot.exportBatch(batch), 2);
+    EXPECT_EQ(batch.at(0).handle, a);
+    EXPECT_EQ(batch.at(1).sourceTimestampMs, 222);
+
+    SignalHub mirror;
+    mirror.registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    mirror.registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+    mirror.registerSignal(numericSignal(QStringLiteral("never"), 0.0, 100.0));
+    EXPECT_EQ(mirror.updateSignals(batch), 2);
+    EXPECT_DOUBLE_EQ(mirror.getSignal(b).toDouble(), 20.0);
+    EXPECT_EQ(mirror.signalValidity(SignalHandle(2)), SignalValidity::NotAvailable);
+}
+
+// =============================================================================
+// Signal catalog
+// =============================================================================
+
+TEST_F(SignalHubTest, ClusterCatalogRegistersAtTagIndices) {
+    VehicleSignalFactory::registerClusterSignals(*hub);
+
+    EXPECT_EQ(hub->signalCount(), static_cast<int>(std::size(CLUSTER_CATALOG)));
+    EXPECT_EQ(hub->signalHandle(QString::fromLatin1(SignalIds::VEHICLE_SPEED)),
+              Signals::VehicleSpeed::handle());
+    EXPECT_EQ(hub->signalHandle(QString::fromLatin1(SignalIds::GEAR_POSITION)),
+              Signals::GearPosition::handle());
+    EXPECT_EQ(hub->signalHandle(QString::fromLatin1(SignalIds::OUTSIDE_TEMP)),
+              Signals::OutsideTemp::handle());
+    EXPECT_EQ(hub->getSignal(Signals::GearPosition::handle()).toString(), QStringLiteral("P"));
+}
+
+TEST_F(SignalHubTest, CatalogSpecExpandsToDefinition) {
+    const SignalDefinition def = toSignalDefinition(CLUSTER_CATALOG[Signals::PowerConsumption::index]);
+
+    EXPECT_EQ(def.id, QString::fromLatin1(SignalIds::POWER_CONSUMPTION));
+    EXPECT_EQ(def.kind, SignalKind::Double);
+    EXPECT_DOUBLE_EQ(def.minValue.toDouble(), -200.0);
+    EXPECT_DOUBLE_EQ(def.maxValue.toDouble(), 500.0);
+    EXPECT_EQ(def.freshnessMs, 500);
+    EXPECT_EQ(def.historyCapacity, 600);
+    EXPECT_DOUBLE_EQ(def.deadbandAbsolute, 1.0);
+
+    const SignalDefinition rpm = toSignalDefinition(CLUSTER_CATALOG[Signals::EngineRpm::index]);
+    EXPECT_EQ(rpm.kind, SignalKind::Int);
+
+    const SignalDefinition adas = toSignalDefinition(CLUSTER_CATALOG[Signals::AdasEnabled::index]);
+    EXPECT_FALSE(adas.minValue.isValid());
+    EXPECT_TRUE(adas.isSafetyCritical);
+}
+
+TEST_F(SignalHubTest, TypedAccessorsUseCatalogHandles) {
+    VehicleSignalFactory::registerClusterSignals(*hub);
+
+    EXPECT_TRUE(hub->set<Signals::VehicleSpeed>(88.0));
+    EXPECT_TRUE(hub->set<Signals::EngineRpm>(qint64(2500)));
+    EXPECT_TRUE(hub->set<Signals::GearPosition>(QStringLiteral("D")));
+    EXPECT_TRUE(hub->set<Signals::TelltaleHazard>(true));
+
+    EXPECT_DOUBLE_EQ(hub->get<Signals::VehicleSpeed>().toDouble(), 88.0);
+    EXPECT_EQ(hub->get<Signals::EngineRpm>().toInt(), 2500);
+    EXPECT_EQ(hub->get<Signals::GearPosition>().toString(), QStringLiteral("D"));
+    EXPECT_TRUE(hub->get<Signals::TelltaleHazard>().toBool());
+    EXPECT_EQ(hub->get<Signals::VehicleSpeed>().validity, SignalValidity::Valid);
+}
+
+TEST_F(SignalHubTest, CatalogRequiresEmptyHub) {
+    hub->registerSignal(numericSignal(QStringLiteral("other"), 0.0, 1.0));
+
+    EXPECT_FALSE(registerCatalog(*hub, CLUSTER_CATALOG));
+    EXPECT_EQ(hub->signalCount(), 1);
+}
+
+// =============================================================================
+// Telemetry
+// =============================================================================
+
+TEST(LatencyHistogramTest, BucketsAndPercentiles) {
+    EXPECT_EQ(LatencyHistogram::bucketFor(0), 0);
+    EXPECT_EQ(LatencyHistogram::bucketFor(50), 0);
+    EXPECT_EQ(LatencyHistogram::bucketFor(51), 1);
+    EXPECT_EQ(LatencyHistogram::bucketFor(10000000), LatencyHistogram::BUCKET_COUNT - 1);
+
+    LatencyHistogram histogram;
+    for (int i = 0; i < 98; ++i) {
+        histogram.record(80);
+    }
+    histogram.record(4000);
+    histogram.record(3000000);
+
+    const LatencyStats stats = histogram.stats();
+    EXPECT_EQ(stats.count, 100u);
+    EXPECT_EQ(stats.maxUs, 3000000);
+    EXPECT_EQ(stats.percentileUs(0.50), 100);
+    EXPECT_EQ(stats.percentileUs(0.99), 5000);
+    EXPECT_EQ(stats.percentileUs(1.0), 3000000);  // Overflow bucket reports the max
+
+    histogram.reset();
+    EXPECT_EQ(histogram.stats().count, 0u);
+    EXPECT_EQ(histogram.stats().percentileUs(0.99), 0);
+}
+
+TEST_F(SignalHubTest, TelemetryIsDisabledByDefault) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    hub->updateSignal(speed, 10.0);
+
+    EXPECT_FALSE(hub->isTelemetryEnabled());
+    EXPECT_EQ(hub->signalTelemetry(speed).updates, 0u);
+
+    const QVariantMap diag = hub->getDiagnostics();
+    EXPECT_EQ(diag.value(QStringLiteral("signalCount")).toInt(), 1);
+    EXPECT_FALSE(diag.value(QStringLiteral("telemetryEnabled")).toBool());
+    EXPECT_FALSE(diag.contains(QStringLiteral("signals")));
+}
+
+TEST_F(SignalHubTest, TelemetryCountsUpdatesAndLatency) {
+    SignalHandle speed = hub->registerSignal(
+        numericSignal(QStringLiteral("speed"), 0.0, 300.0, true));
+    int delivered = 0;
+    hub->subscribe(speed, [&delivered](const SignalChange&) { ++delivered; });
+    hub->setTelemetryEnabled(true);
+
+    hub->setClockOverride(1000);
+    hub->updateSignal(speed, 10.0, 990);      // 10 ms from source to commit
+    hub->updateSignal(speed, 20.0);           // No source timestamp
+    hub->updateSignal(speed, 500.0, 2000);    // Out of range; source clock ahead
+
+    const SignalTelemetryStats stats = hub->signalTelemetry(speed);
+    EXPECT_EQ(stats.updates, 3u);
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.notifications, static_cast<quint64>(delivered));
+    EXPECT_EQ(stats.notifyLatency.count, stats.notifications);
+    EXPECT_LE(stats.minIntervalUs, stats.maxIntervalUs);
+
+    ASSERT_EQ(stats.sourceLatency.count, 1u);
+    EXPECT_EQ(stats.sourceLatency.maxUs, 10000);
+    EXPECT_EQ(stats.sourceLatency.percentileUs(0.5), 10000);
+
+    hub->resetTelemetry();
+    EXPECT_EQ(hub->signalTelemetry(speed).updates, 0u);
+}
+
+TEST_F(SignalHubTest, TelemetryMeasuresCoalescedDelivery) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    hub->setTelemetryEnabled(true);
+    hub->setCoalescingEnabled(true);
+
+    hub->updateSignal(speed, 10.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    ASSERT_EQ(hub->publishChanges(), 1);
+
+    const LatencyStats latency = hub->signalTelemetry(speed).notifyLatency;
+    ASSERT_EQ(latency.count, 1u);
+    EXPECT_GE(latency.maxUs, 2500);
+}
+
+TEST_F(SignalHubTest, DiagnosticsListBusiestSignalFirst) {
+    SignalHandle quiet = hub->registerSignal(numericSignal(QStringLiteral("quiet"), 0.0, 100.0));
+    SignalHandle busy = hub->registerSignal(numericSignal(QStringLiteral("busy"), 0.0, 100.0));
+    hub->setTelemetryEnabled(true);
+
+    hub->updateSignal(quiet, 1.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    hub->updateSignal(quiet, 2.0);
+    for (int i = 0; i < 50; ++i) {
+        hub->updateSignal(busy, static_cast<double>(i));
+    }
+
+    const QVariantMap diag = hub->getDiagnostics();
+    EXPECT_TRUE(diag.value(QStringLiteral("telemetryEnabled")).toBool());
+    const QVariantList list = diag.value(QStringLiteral("signals")).toList();
+    ASSERT_EQ(list.size(), 2);
+    const QVariantMap first = list.first().toMap();
+    EXPECT_EQ(first.value(QStringLiteral("id")).toString(), QStringLiteral("busy"));
+    EXPECT_EQ(first.value(QStringLiteral("updates")).toLongLong(), 50);
+
+    const QString report = hub->telemetryReport(1);
+    EXPECT_TRUE(report.contains(QStringLiteral("busy")));
+    EXPECT_FALSE(report.contains(QStringLiteral("quiet")));
+}
+
+// =============================================================================
+// Derived signals
+// =============================================================================
+
+TEST_F(SignalHubTest, DerivedSignalRecomputesOncePerTickOnInputChange) {
+    SignalHandle soc = hub->registerSignal(numericSignal(QStringLiteral("soc"), 0.0, 100.0));
+    SignalHandle range = hub->registerSignal(numericSignal(QStringLiteral("range"), 0.0, 1000.0));
+    int calls = 0;
+    ASSERT_TRUE(hub->deriveSignal(range, {soc},
+                                  [&calls](const QVector<SignalValue>& inputs) {
+                                      ++calls;
+                                      return ScalarValue(inputs.at(0).toDouble() * 4.0);
+                                  }));
+
+    hub->processTick();
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(hub->signalValidity(range), SignalValidity::NotAvailable);
+
+    hub->updateSignal(soc, 70.0, 5);
+    hub->updateSignal(soc, 75.0, 7);
+    EXPECT_EQ(hub->signalValidity(range), SignalValidity::NotAvailable);  // Not before the tick
+    hub->processTick();
+    EXPECT_EQ(calls, 1);
+    const SignalValue value = hub->getSignal(range);
+    EXPECT_EQ(value.validity, SignalValidity::Valid);
+    EXPECT_DOUBLE_EQ(value.toDouble(), 300.0);
+    EXPECT_EQ(value.sourceTimestampMs, 7);
+
+    hub->processTick();
+    hub->updateSignal(soc, 75.0);              // Same input: nothing to recompute
+    hub->processTick();
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(hub->getSignal(range).updateCount, 1u);
+
+    EXPECT_FALSE(hub->updateSignal(range, 10.0));
+    EXPECT_DOUBLE_EQ(hub->getSignal(range).toDouble(), 300.0);
+}
+
+TEST_F(SignalHubTest, DerivedSignalsChainInDependencyOrder) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    SignalHandle power = hub->registerSignal(numericSignal(QStringLiteral("power"), -100.0, 300.0));
+    // Registered before its input so registration order differs from dependency order
+    SignalHandle display = hub->registerSignal(numericSignal(QStringLiteral("display"), 0.0, 1000.0));
+    SignalHandle consumption = hub->registerSignal(
+        numericSignal(QStringLiteral("consumption"), 0.0, 1000.0));
+
+    ASSERT_TRUE(hub->deriveSignal(display, {consumption},
+                                  [](const QVector<SignalValue>& inputs) {
+                                      return ScalarValue(inputs.at(0).toDouble() * 10.0);
+                                  }));
+    ASSERT_TRUE(hub->deriveSignal(consumption, {power, speed},
+                                  [](const QVector<SignalValue>& inputs) {
+                                      return ScalarValue(inputs.at(0).toDouble() /
+                                                         inputs.at(1).toDouble());
+                                  }));
+
+    QSignalSpy batchSpy(hub.get(), &SignalHub::signalsUpdated);
+    SignalBatch batch;
+    batch.append({speed, ScalarValue(100.0), QString(), 0});
+    batch.append({power, ScalarValue(15.0), QString(), 0});
+    hub->updateSignals(batch);
+    batchSpy.clear();
+
+    EXPECT_EQ(hub->updateDerivedSignals(), 2);
+    EXPECT_DOUBLE_EQ(hub->getSignal(consumption).toDouble(), 0.15);
+    EXPECT_DOUBLE_EQ(hub->getSignal(display).toDouble(), 1.5);
+    ASSERT_EQ(batchSpy.count(), 1);
+    EXPECT_EQ(batchSpy.at(0).at(0).value<QVector<SignalChange>>().size(), 2);
+}
+
+TEST_F(SignalHubTest, DerivedSignalValidityFollowsInputs) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0, true));
+    SignalDefinition staleDef = numericSignal(QStringLiteral("b"), 0.0, 100.0);
+    staleDef.freshnessMs = 100;
+    SignalHandle b = hub->registerSignal(staleDef);
+    SignalHandle sum = hub->registerSignal(numericSignal(QStringLiteral("sum"), 0.0, 200.0));
+    SignalHandle twice = hub->registerSignal(numericSignal(QStringLiteral("twice"), 0.0, 400.0));
+    ASSERT_TRUE(hub->deriveSignal(sum, {a, b}, [](const QVector<SignalValue>& inputs) {
+        return ScalarValue(inputs.at(0).toDouble() + inputs.at(1).toDouble());
+    }));
+    ASSERT_TRUE(hub->deriveSignal(twice, {sum}, [](const QVector<SignalValue>& inputs) {
+        return ScalarValue(inputs.at(0).toDouble() * 2.0);
+    }));
+
+    hub->setClockOverride(1000);
+    hub->updateSignal(a, 10.0);
+    hub->processTick();
+    EXPECT_EQ(hub->signalValidity(sum), SignalValidity::NotAvailable);  // b never received
+
+    hub->updateSignal(b, 5.0);
+    hub->processTick();
+    EXPECT_EQ(hub->signalValidity(twice), SignalValidity::Valid);
+    EXPECT_DOUBLE_EQ(hub->getSignal(twice).toDouble(), 30.0);
+    EXPECT_FALSE(hub->isDegradedMode());
+
+    // Freshness of an input, not of the derived signal itself
+    hub->setClockOverride(1150);
+    hub->updateSignal(a, 10.0);
+    hub->processTick();
+    EXPECT_EQ(hub->signalValidity(b), SignalValidity::Stale);
+    EXPECT_EQ(hub->signalValidity(sum), SignalValidity::Stale);
+    EXPECT_EQ(hub->signalValidity(twice), SignalValidity::Stale);
+    EXPECT_DOUBLE_EQ(hub->getSignal(twice).toDouble(), 30.0);  // Last value kept
+
+    hub->updateSignal(a, 150.0);               // Out of range on a critical input
+    hub->processTick();
+    EXPECT_EQ(hub->signalValidity(sum), SignalValidity::Invalid);
+    EXPECT_EQ(hub->signalValidity(twice), SignalValidity::Invalid);
+
+    hub->updateSignal(a, 20.0);
+    hub->updateSignal(b, 5.0);
+    hub->processTick();
+    EXPECT_EQ(hub->signalValidity(twice), SignalValidity::Valid);
+    EXPECT_DOUBLE_EQ(hub->getSignal(twice).toDouble(), 50.0);
+    EXPECT_EQ(hub->invalidSignalCount(), 0);
+    EXPECT_FALSE(hub->isDegradedMode());
+}
+
+TEST_F(SignalHubTest, DeriveSignalRejectsCyclesAndLateCalls) {
+    SignalHandle a = hub->registerSignal(numericSignal(QStringLiteral("a"), 0.0, 100.0));
+    SignalHandle b = hub->registerSignal(numericSignal(QStringLiteral("b"), 0.0, 100.0));
+    SignalHandle c = hub->registerSignal(numericSignal(QStringLiteral("c"), 0.0, 100.0));
+    auto identity = [](const QVector<SignalValue>& inputs) { return inputs.at(0).value; };
+
+    ASSERT_TRUE(hub->deriveSignal(b, {a}, identity));
+    EXPECT_FALSE(hub->deriveSignal(b, {c}, identity));     // Already derived
+    EXPECT_FALSE(hub->deriveSignal(c, {c}, identity));     // Its own input
+    ASSERT_TRUE(hub->deriveSignal(c, {b}, identity));
+    EXPECT_FALSE(hub->deriveSignal(a, {c}, identity));     // a -> b -> c -> a
+
+    // The rejected cycle left a as a raw signal
+    hub->updateSignal(a, 42.0);
+    hub->processTick();
+    EXPECT_DOUBLE_EQ(hub->getSignal(c).toDouble(), 42.0);
+
+    SignalHandle late = hub->registerSignal(numericSignal(QStringLiteral("late"), 0.0, 100.0));
+    EXPECT_FALSE(late.isValid());
+    EXPECT_FALSE(hub->deriveSignal(a, {b}, identity));     // Sealed
+}
+
+// =============================================================================
+// Signal views
+// =============================================================================
+
+TEST_F(SignalHubTest, LatestViewDeliversAtMostAtItsRate) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    SignalHandle rpm = hub->registerSignal(numericSignal(QStringLiteral("rpm"), 0.0, 8000.0));
+    QVector<QVector<SignalViewSample>> deliveries;
+    SignalViewPolicy policy;
+    policy.maxRateHz = 2.0;
+    SignalView* view = hub->createView(QStringLiteral("mirror"), {speed, rpm}, policy,
+                                       [&deliveries](const QVector<SignalViewSample>& samples) {
+                                           deliveries.append(samples);
+                                       });
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->periodMs(), 500);
+
+    // 20 Hz updates and ticks for one second
+    for (int tick = 0; tick < 20; ++tick) {
+        hub->setClockOverride(1000 + tick * 50);
+        hub->updateSignal(speed, static_cast<double>(tick));
+        hub->processTick();
+    }
+
+    ASSERT_EQ(deliveries.size(), 2);           // t = 1000 and t = 1500
+    EXPECT_EQ(deliveries[0].size(), 2);        // First delivery: whole set
+    ASSERT_EQ(deliveries[1].size(), 1);        // Then only what changed
+    EXPECT_EQ(deliveries[1][0].handle, speed);
+    EXPECT_DOUBLE_EQ(deliveries[1][0].value.toDouble(), 10.0);
+    EXPECT_EQ(deliveries[1][0].updates, 10u);
+
+    hub->setClockOverride(2000);
+    hub->updateSignal(rpm, qint64(900));
+    hub->processTick();
+    ASSERT_EQ(deliveries.size(), 3);
+    EXPECT_EQ(deliveries[2].size(), 2);
+
+    const QVector<SignalViewStats> stats = hub->viewStats();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].deliveries, 3u);
+    EXPECT_EQ(stats[0].samples, 5u);
+    EXPECT_EQ(stats[0].updates, 21u);
+}
+
+TEST_F(SignalHubTest, AggregatingViewsCondenseEveryUpdate) {
+    SignalHandle power = hub->registerSignal(numericSignal(QStringLiteral("power"), 0.0, 300.0));
+    SignalViewSample average;
+    SignalViewSample extremes;
+    SignalViewPolicy policy;
+    policy.maxRateHz = 1.0;
+    policy.aggregation = ViewAggregation::Average;
+    hub->createView(QStringLiteral("log"), {power}, policy,
+                    [&average](const QVector<SignalViewSample>& samples) {
+                        average = samples.first();
+                    });
+    policy.aggregation = ViewAggregation::MinMax;
+    hub->createView(QStringLiteral("telemetry"), {power}, policy,
+                    [&extremes](const QVector<SignalViewSample>& samples) {
+                        extremes = samples.first();
+                    });
+
+    hub->setClockOverride(1000);
+    hub->processTick();                        // First delivery: initial state
+
+    // Several updates per tick, all of them condensed
+    for (int tick = 1; tick <= 10; ++tick) {
+        hub->setClockOverride(1000 + tick * 100);
+        SignalBatch batch;
+        batch.append({power, ScalarValue(static_cast<double>(tick * 10)), QString(), 0});
+        batch.append({power, ScalarValue(static_cast<double>(tick * 10 + 4)), QString(), 0});
+        hub->updateSignals(batch);
+        hub->processTick();
+    }
+
+    EXPECT_EQ(average.updates, 20u);
+    EXPECT_DOUBLE_EQ(average.average, 57.0);
+    EXPECT_DOUBLE_EQ(average.value.toDouble(), 104.0);
+    EXPECT_DOUBLE_EQ(extremes.minimum, 10.0);
+    EXPECT_DOUBLE_EQ(extremes.maximum, 104.0);
+}
+
+TEST_F(SignalHubTest, ViewReportsValidityChangesAndCanBeRemoved) {
+    SignalDefinition def = numericSignal(QStringLiteral("speed"), 0.0, 300.0);
+    def.freshnessMs = 100;
+    SignalHandle speed = hub->registerSignal(def);
+    QVector<SignalViewSample> last;
+    int deliveries = 0;
+    SignalViewPolicy policy;
+    policy.maxRateHz = 0.0;                    // Every tick with a change
+    SignalView* view = hub->createView(QStringLiteral("hmi"), {speed, SignalHandle()}, policy,
+                                       [&](const QVector<SignalViewSample>& samples) {
+                                           last = samples;
+                                           ++deliveries;
+                                       });
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(view->signalHandles().size(), 1);  // Invalid handle skipped
+
+    hub->setClockOverride(1000);
+    hub->updateSignal(speed, 42.0);
+    hub->processTick();
+    hub->processTick();                        // Nothing new
+    EXPECT_EQ(deliveries, 1);
+
+    hub->setClockOverride(1200);
+    hub->processTick();
+    ASSERT_EQ(deliveries, 2);
+    EXPECT_EQ(last[0].value.validity, SignalValidity::Stale);
+    EXPECT_EQ(last[0].updates, 0u);
+
+    hub->removeView(view);
+    hub->updateSignal(speed, 43.0);
+    hub->processTick();
+    EXPECT_EQ(deliveries, 2);
+    EXPECT_TRUE(hub->viewStats().isEmpty());
+    EXPECT_EQ(hub->createView(QStringLiteral("none"), {SignalHandle()}, policy, nullptr), nullptr);
+}
+
+TEST_F(SignalHubTest, ViewsCanBeRemovedFromCallbacks) {
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 300.0));
+    SignalViewPolicy policy;
+    policy.maxRateHz = 0.0;
+    int firstDeliveries = 0;
+    int secondDeliveries = 0;
+    SignalView* second = nullptr;
+    SignalView* first = nullptr;
+    // Created first, so it is delivered before the view it removes
+    first = hub->createView(QStringLiteral("first"), {speed}, policy,
+                            [&](const QVector<SignalViewSample>& samples) {
+                                ++firstDeliveries;
+                                EXPECT_EQ(samples.size(), 1);
+                                hub->removeView(second);   // Queued for this tick
+                                hub->removeView(first);    // Itself
+                            });
+    second = hub->createView(QStringLiteral("second"), {speed}, policy,
+                             [&](const QVector<SignalViewSample>&) { ++secondDeliveries; });
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    hub->setClockOverride(1000);
+    hub->updateSignal(speed, 42.0);
+    hub->processTick();
+
+    EXPECT_EQ(firstDeliveries, 1);
+    EXPECT_EQ(secondDeliveries, 0);            // Removed before its turn
+    EXPECT_TRUE(hub->viewStats().isEmpty());
+
+    hub->updateSignal(speed, 43.0);
+    hub->processTick();
+    EXPECT_EQ(firstDeliveries, 1);
+}
+
+// =============================================================================
+// Concurrent access (lock-free read path)
+// =============================================================================
+
+TEST_F(SignalHubTest, RegistrationIsSealedByFirstUpdate) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 100.0));
+    ASSERT_TRUE(hub->updateSignal(level, 1.0));
+
+    EXPECT_FALSE(hub->registerSignal(numericSignal(QStringLiteral("late"), 0.0, 1.0)).isValid());
+    EXPECT_EQ(hub->signalCount(), 1);
+    EXPECT_EQ(hub->registeredSignals(), QStringList{QStringLiteral("level")});
+}
+
+TEST_F(SignalHubTest, ConcurrentReadersNeverSeeTornValues) {
+    SignalHandle level = hub->registerSignal(
+        numericSignal(QStringLiteral("level"), 0.0, 1.0e9));
+    ASSERT_TRUE(hub->updateSignal(level, 0.0, 0));
+
+    // The writer keeps value and source timestamp in lockstep, so any read
+    // mixing two updates shows up as a mismatch.
+    constexpr int kUpdates = 20000;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            while (!done.load(std::memory_order_acquire)) {
+                const SignalValue value = hub->getSignal(level);
+                if (static_cast<qint64>(value.toDouble()) != value.sourceTimestampMs ||
+                    value.updateCount != static_cast<uint32_t>(value.sourceTimestampMs) + 1) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (int i = 1; i <= kUpdates; ++i) {
+        hub->updateSignal(level, static_cast<double>(i), i);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_DOUBLE_EQ(hub->getSignal(level).toDouble(), static_cast<double>(kUpdates));
+}
+
+TEST_F(SignalHubTest, ConcurrentSnapshotReadersSeeWholeBatches) {
+    SignalHandle gear = hub->registerSignal(numericSignal(QStringLiteral("gear"), 0.0, 1.0e9));
+    SignalHandle speed = hub->registerSignal(numericSignal(QStringLiteral("speed"), 0.0, 1.0e9));
+    hub->updateSignals({{gear, 0.0, QString(), 0}, {speed, 0.0, QString(), 0}});
+    hub->publishSnapshot();
+
+    // Both signals always move together, so a mixed snapshot is a tear
+    constexpr int kTicks = 2000;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            quint64 lastEpoch = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                const SignalSnapshot snapshot = hub->snapshot();
+                if (snapshot.value(gear).toDouble() != snapshot.value(speed).toDouble() ||
+                    snapshot.epoch() < lastEpoch) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+                lastEpoch = snapshot.epoch();
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int i = 1; i <= kTicks; ++i) {
+        const double value = static_cast<double>(i);
+        hub->updateSignals({{gear, value, QString(), 0}, {speed, value, QString(), 0}});
+        hub->publishSnapshot();
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(hub->snapshot().value(speed).toDouble(), static_cast<double>(kTicks));
+}
+
+TEST_F(SignalHubTest, StringSignalTextIsPublished) {
+    SignalDefinition def;
+    def.id = QStringLiteral("label");
+    def.kind = SignalKind::String;
+    def.defaultValue = QStringLiteral("P");
+    SignalHandle label = hub->registerSignal(def);
+
+    EXPECT_EQ(hub->getSignal(label).toString(), QStringLiteral("P"));
+    ASSERT_TRUE(hub->updateSignal(label, QStringLiteral("D")));
+    EXPECT_EQ(hub->getSignal(label).toString(), QStringLiteral("D"));
+    EXPECT_EQ(hub->signalValidity(label), SignalValidity::Valid);
+}
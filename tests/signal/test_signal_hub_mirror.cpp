@@ -0,0 +1,184 @@
+// test_signal_hub_mirror.cpp
+// Unit tests for the shared-memory SignalHub mirror
+// Tests: Export and attach, value/text/validity propagation, heartbeat,
+//        writer shutdown, missing and foreign segments, concurrent reads,
+//        writer that died mid-store
+
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QSharedMemory>
+#include "signal/SignalHub.h"
+#include "signal/SignalHubMirror.h"
+#include "signal/VehicleSignals.h"
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+using namespace automotive::signal;
+
+class SignalHubMirrorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!QCoreApplication::instance()) {
+            int argc = 0;
+            app = new QCoreApplication(argc, nullptr);
+        }
+        hub = std::make_unique<SignalHub>();
+        VehicleSignalFactory::registerClusterSignals(*hub);
+        speed = hub->signalHandle(QString::fromLatin1(SignalIds::VEHICLE_SPEED));
+        gear = hub->signalHandle(QString::fromLatin1(SignalIds::GEAR_POSITION));
+    }
+
+    static QString key(const char* name) {
+        return QStringLiteral("automotive.test.mirror.%1").arg(QString::fromLatin1(name));
+    }
+
+    QCoreApplication* app = nullptr;
+    std::unique_ptr<SignalHub> hub;
+    SignalHandle speed;
+    SignalHandle gear;
+};
+
+TEST_F(SignalHubMirrorTest, MirrorReadsHubValues) {
+    hub->setClockOverride(1000);
+    ASSERT_TRUE(hub->exportSharedMirror(key("values")));
+    EXPECT_FALSE(hub->exportSharedMirror(key("values")));
+    // Exporting seals the table the segment was sized for
+    SignalDefinition extra = VehicleSignalFactory::speedSignal(true);
+    extra.id = QStringLiteral("vehicle.extra");
+    EXPECT_FALSE(hub->registerSignal(extra).isValid());
+
+    SignalHubMirror mirror;
+    QString error;
+    ASSERT_TRUE(mirror.attach(key("values"), &error));
+    EXPECT_TRUE(mirror.isWriterOpen());
+    ASSERT_EQ(mirror.signalCount(), hub->signalCount());
+    EXPECT_EQ(mirror.signalIds(), hub->registeredSignals());
+    EXPECT_EQ(mirror.signalHandle(QString::fromLatin1(SignalIds::VEHICLE_SPEED)), speed);
+
+    // Initial state, including String defaults
+    EXPECT_EQ(mirror.getSignal(gear).text, hub->getSignal(gear).text);
+    EXPECT_EQ(mirror.signalValidity(speed), SignalValidity::NotAvailable);
+
+    hub->updateSignal(speed, 87.5, 990);
+    hub->updateSignal(gear, QStringLiteral("D"));
+    const SignalValue value = mirror.getSignal(QString::fromLatin1(SignalIds::VEHICLE_SPEED));
+    EXPECT_EQ(value.validity, SignalValidity::Valid);
+    EXPECT_DOUBLE_EQ(value.toDouble(), 87.5);
+    EXPECT_EQ(value.timestampMs, 1000);
+    EXPECT_EQ(value.sourceTimestampMs, 990);
+    EXPECT_EQ(value.updateCount, 1u);
+    EXPECT_EQ(mirror.getSignal(gear).text, QStringLiteral("D"));
+    EXPECT_EQ(mirror.getSignal(SignalHandle()).validity, SignalValidity::NotAvailable);
+
+    // Freshness decided by the hub shows up in the mirror
+    hub->setClockOverride(1400);
+    hub->processTick();
+    EXPECT_EQ(mirror.heartbeatMs(), 1400);
+    EXPECT_EQ(mirror.signalValidity(speed), SignalValidity::Stale);
+    EXPECT_DOUBLE_EQ(mirror.getSignal(speed).toDouble(), 87.5);
+
+    hub.reset();
+    EXPECT_FALSE(mirror.isWriterOpen());
+}
+
+TEST_F(SignalHubMirrorTest, LongTextIsTruncatedAtCharacterBoundary) {
+    ASSERT_TRUE(hub->exportSharedMirror(key("text")));
+    SignalHubMirror mirror;
+    ASSERT_TRUE(mirror.attach(key("text")));
+
+    // The first two-byte character would straddle the capacity
+    const QString prefix = QString::fromLatin1(QByteArray(MirrorTextSlot::CAPACITY - 1, 'x'));
+    const QString longText = prefix + QString::fromUtf8("\xC3\xA9\xC3\xA9");
+    hub->updateSignal(gear, longText);
+    EXPECT_EQ(hub->getSignal(gear).text, longText);
+    EXPECT_EQ(mirror.getSignal(gear).text, prefix);
+}
+
+TEST_F(SignalHubMirrorTest, AttachRejectsMissingAndForeignSegments) {
+    SignalHubMirror mirror;
+    QString error;
+    EXPECT_FALSE(mirror.attach(key("missing"), &error));
+    EXPECT_FALSE(mirror.isAttached());
+    EXPECT_EQ(mirror.signalValidity(speed), SignalValidity::NotAvailable);
+
+    QSharedMemory foreign;
+    foreign.setKey(key("foreign"));
+    ASSERT_TRUE(foreign.create(4096));
+    std::memset(foreign.data(), 'x', 4096);
+    EXPECT_FALSE(mirror.attach(key("foreign"), &error));
+    EXPECT_FALSE(error.isEmpty());
+    EXPECT_FALSE(mirror.isAttached());
+}
+
+TEST_F(SignalHubMirrorTest, InterruptedStoreReadsAsNotAvailable) {
+    ASSERT_TRUE(hub->exportSharedMirror(key("interrupted")));
+    hub->updateSignal(speed, 50.0);
+    hub->updateSignal(gear, QStringLiteral("D"));
+    SignalHubMirror mirror;
+    ASSERT_TRUE(mirror.attach(key("interrupted")));
+    ASSERT_EQ(mirror.signalValidity(speed), SignalValidity::Valid);
+
+    // Leave both slots as a writer that died between the sequence bumps
+    QSharedMemory segment;
+    segment.setKey(key("interrupted"));
+    ASSERT_TRUE(segment.attach());
+    char* base = static_cast<char*>(segment.data());
+    const auto* header = reinterpret_cast<const MirrorHeader*>(base);
+    auto* speedSequence = reinterpret_cast<std::atomic<uint32_t>*>(  // First member of SignalSlot
+        base + header->slotsOffset + speed.index * sizeof(SignalSlot));
+    const auto* entries = reinterpret_cast<const MirrorSignalEntry*>(base + sizeof(MirrorHeader));
+    ASSERT_GE(entries[gear.index].textSlot, 0);
+    MirrorTextSlot& gearText = reinterpret_cast<MirrorTextSlot*>(
+        base + header->textSlotsOffset)[entries[gear.index].textSlot];
+    speedSequence->fetch_add(1);
+    gearText.sequence.fetch_add(1);
+
+    EXPECT_EQ(mirror.getSignal(speed).validity, SignalValidity::NotAvailable);
+    EXPECT_EQ(mirror.signalValidity(speed), SignalValidity::NotAvailable);
+    const SignalValue gearValue = mirror.getSignal(gear);
+    EXPECT_EQ(gearValue.validity, SignalValidity::NotAvailable);
+    EXPECT_TRUE(gearValue.text.isEmpty());
+
+    // A finished store makes the slots readable again
+    speedSequence->fetch_add(1);
+    gearText.sequence.fetch_add(1);
+    EXPECT_DOUBLE_EQ(mirror.getSignal(speed).toDouble(), 50.0);
+    EXPECT_EQ(mirror.getSignal(gear).text, QStringLiteral("D"));
+}
+
+TEST_F(SignalHubMirrorTest, ConcurrentMirrorReadsAreConsistent) {
+    SignalDefinition def;
+    def.id = QStringLiteral("test.counter");
+    def.name = def.id;
+    def.minValue = 0.0;
+    def.maxValue = 1000.0;
+    def.defaultValue = 0.0;
+    const SignalHandle counter = hub->registerSignal(def);
+    ASSERT_TRUE(hub->exportSharedMirror(key("concurrent")));
+    SignalHubMirror mirror;
+    ASSERT_TRUE(mirror.attach(key("concurrent")));
+
+    // The writer keeps value == updateCount; a torn read would break it
+    constexpr int kUpdates = 20000;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::thread reader([&]() {
+        while (!done.load(std::memory_order_acquire)) {
+            const SignalValue value = mirror.getSignal(counter);
+            if (value.updateCount > 0 &&
+                static_cast<uint32_t>(value.toDouble()) != value.updateCount % 200) {
+                torn.fetch_add(1);
+            }
+        }
+    });
+
+    for (int i = 1; i <= kUpdates; ++i) {
+        hub->updateSignal(counter, static_cast<double>(i % 200));
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(mirror.getSignal(counter).updateCount, static_cast<uint32_t>(kUpdates));
+}
@@ -0,0 +1,295 @@
+// test_signal_trace.cpp
+// Unit tests for signal trace recording and replay
+// Tests: Record round trip, deterministic replay with id remapping, stepped replay,
+//        buffer overflow accounting, long text, foreign and truncated files
+
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTemporaryDir>
+#include "signal/SignalHub.h"
+#include "signal/SignalTrace.h"
+#include "signal/SignalTraceReplayer.h"
+#include "signal/VehicleSignals.h"
+#include <algorithm>
+
+using namespace automotive::signal;
+
+class SignalTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!QCoreApplication::instance()) {
+            int argc = 0;
+            app = new QCoreApplication(argc, nullptr);
+        }
+        ASSERT_TRUE(dir.isValid());
+        path = dir.filePath(QStringLiteral("drive.trace"));
+    }
+
+    static void registerSignals(SignalHub& hub, bool reversed = false) {
+        QVector<SignalDefinition> defs;
+        defs.append(VehicleSignalFactory::speedSignal(true));
+        defs.append(VehicleSignalFactory::rpmSignal(7000));
+        defs.append(VehicleSignalFactory::gearSignal());
+        defs.append(VehicleSignalFactory::telltaleSignal(
+            QString::fromLatin1(SignalIds::TELLTALE_ABS), QStringLiteral("ABS"), true));
+        if (reversed) {
+            std::reverse(defs.begin(), defs.end());
+        }
+        for (const SignalDefinition& def : defs) {
+            hub.registerSignal(def);
+        }
+    }
+
+    static SignalHandle handleOf(const SignalHub& hub, const char* id) {
+        return hub.signalHandle(QString::fromLatin1(id));
+    }
+
+    // Drive a hub through updates, a batch, ticks and a stale transition
+    void recordDrive(SignalHub& hub) {
+        SignalTraceRecorder recorder;
+        ASSERT_TRUE(recorder.start(path, hub));
+        hub.setTraceRecorder(&recorder);
+
+        const SignalHandle speed = handleOf(hub, SignalIds::VEHICLE_SPEED);
+        const SignalHandle rpm = handleOf(hub, SignalIds::ENGINE_RPM);
+        const SignalHandle gear = handleOf(hub, SignalIds::GEAR_POSITION);
+        const SignalHandle abs = handleOf(hub, SignalIds::TELLTALE_ABS);
+
+        hub.setClockOverride(1000);
+        hub.updateSignal(speed, 50.0, 999);
+        hub.updateSignal(gear, QStringLiteral("D"));
+
+        hub.setClockOverride(1050);
+        SignalBatch batch;
+        SignalUpdate update;
+        update.handle = rpm;
+        update.value = ScalarValue(qint64(2500));
+        batch.append(update);
+        update.handle = abs;
+        update.value = ScalarValue(true);
+        batch.append(update);
+        hub.updateSignals(batch);
+        hub.processTick();
+
+        hub.setClockOverride(1100);
+        hub.updateSignal(QString::fromLatin1(SignalIds::ENGINE_RPM),
+                         QVariant(QStringLiteral("not a number")));
+
+        // Speed (300 ms freshness) expires before this tick
+        hub.setClockOverride(1400);
+        hub.updateSignal(abs, false);
+        hub.processTick();
+
+        hub.setTraceRecorder(nullptr);
+        recorder.stop();
+        EXPECT_EQ(recorder.stats().dropped, 0u);
+    }
+
+    QCoreApplication* app = nullptr;
+    QTemporaryDir dir;
+    QString path;
+};
+
+TEST_F(SignalTraceTest, RecordsUpdatesBatchesAndTicks) {
+    SignalHub hub;
+    registerSignals(hub);
+    recordDrive(hub);
+
+    SignalTraceReader reader;
+    QString error;
+    ASSERT_TRUE(reader.open(path, &error));
+    ASSERT_EQ(reader.signalIds().size(), 4);
+    EXPECT_EQ(reader.signalIds().at(2), QString::fromLatin1(SignalIds::GEAR_POSITION));
+
+    QVector<TraceEvent> events;
+    TraceEvent event;
+    while (reader.next(event)) {
+        events.append(event);
+    }
+    EXPECT_FALSE(reader.isTruncated());
+    ASSERT_EQ(events.size(), 8);
+
+    EXPECT_EQ(events[0].signalIndex, 0u);
+    EXPECT_DOUBLE_EQ(events[0].value.toDouble(), 50.0);
+    EXPECT_EQ(events[0].timestampMs, 1000);
+    EXPECT_EQ(events[0].sourceTimestampMs, 999);
+    EXPECT_FALSE(events[0].inBatch);
+
+    EXPECT_EQ(events[1].value.kind, SignalKind::String);
+    EXPECT_EQ(events[1].text, QStringLiteral("D"));
+
+    EXPECT_EQ(events[2].value.kind, SignalKind::Int);
+    EXPECT_EQ(events[2].value.toInt(), 2500);
+    EXPECT_TRUE(events[2].inBatch);
+    EXPECT_FALSE(events[2].batchEnd);
+    EXPECT_TRUE(events[3].batchEnd);
+    EXPECT_TRUE(events[3].value.toBool());
+
+    EXPECT_TRUE(events[4].isTick);
+    EXPECT_EQ(events[4].timestampMs, 1050);
+
+    EXPECT_FALSE(events[5].convertible);
+    EXPECT_TRUE(events[7].isTick);
+    EXPECT_EQ(events[7].timestampMs, 1400);
+}
+
+TEST_F(SignalTraceTest, ReplayReproducesHubState) {
+    SignalHub recorded;
+    registerSignals(recorded);
+    recordDrive(recorded);
+
+    // Different registration order: the trace is mapped by identifier
+    SignalHub replayed;
+    registerSignals(replayed, true);
+    replayed.registerSignal(VehicleSignalFactory::batterySocSignal());
+
+    SignalTraceReplayer replayer(&replayed);
+    ASSERT_TRUE(replayer.open(path));
+    EXPECT_EQ(replayer.unmappedSignalCount(), 0);
+    replayer.setSpeed(SignalTraceReplayer::AS_FAST_AS_POSSIBLE);
+    replayer.start();
+
+    ASSERT_TRUE(replayer.isFinished());
+    const TraceReplayStats stats = replayer.stats();
+    EXPECT_EQ(stats.updates, 4u);
+    EXPECT_EQ(stats.batches, 1u);
+    EXPECT_EQ(stats.batchedUpdates, 2u);
+    EXPECT_EQ(stats.ticks, 2u);
+
+    for (const char* id : {SignalIds::VEHICLE_SPEED, SignalIds::ENGINE_RPM,
+                           SignalIds::GEAR_POSITION, SignalIds::TELLTALE_ABS}) {
+        const SignalValue expected = recorded.getSignal(QString::fromLatin1(id));
+        const SignalValue actual = replayed.getSignal(QString::fromLatin1(id));
+        EXPECT_EQ(actual.value, expected.value) << id;
+        EXPECT_EQ(actual.text, expected.text) << id;
+        EXPECT_EQ(actual.validity, expected.validity) << id;
+        EXPECT_EQ(actual.updateCount, expected.updateCount) << id;
+    }
+    EXPECT_EQ(replayed.signalValidity(handleOf(replayed, SignalIds::VEHICLE_SPEED)),
+              SignalValidity::Stale);
+    EXPECT_EQ(replayed.signalValidity(handleOf(replayed, SignalIds::ENGINE_RPM)),
+              SignalValidity::Invalid);
+}
+
+TEST_F(SignalTraceTest, ReplayUntilStepsThroughTrace) {
+    SignalHub recorded;
+    registerSignals(recorded);
+    recordDrive(recorded);
+
+    SignalHub replayed;
+    registerSignals(replayed);
+    SignalTraceReplayer replayer(&replayed);
+    replayer.setReplayTicks(false);
+    ASSERT_TRUE(replayer.open(path));
+    EXPECT_EQ(replayer.nextTimestampMs(), 1000);
+
+    EXPECT_EQ(replayer.replayUntil(1000), 2);
+    EXPECT_DOUBLE_EQ(replayed.getSignal(handleOf(replayed, SignalIds::VEHICLE_SPEED))
+                         .value.toDouble(), 50.0);
+    EXPECT_EQ(replayed.getSignal(handleOf(replayed, SignalIds::ENGINE_RPM)).validity,
+              SignalValidity::NotAvailable);
+
+    EXPECT_EQ(replayer.replayUntil(1050), 3);
+    EXPECT_EQ(replayed.getSignal(handleOf(replayed, SignalIds::ENGINE_RPM)).value.toInt(), 2500);
+    EXPECT_EQ(replayer.stats().ticks, 0u);
+
+    replayer.replayUntil(2000);
+    EXPECT_EQ(replayer.nextTimestampMs(), -1);
+}
+
+TEST_F(SignalTraceTest, DroppedRecordsAreCounted) {
+    SignalHub hub;
+    registerSignals(hub);
+    const SignalHandle speed = handleOf(hub, SignalIds::VEHICLE_SPEED);
+
+    constexpr int kUpdates = 20000;
+    {
+        SignalTraceRecorder recorder(4096);
+        ASSERT_TRUE(recorder.start(path, hub));
+        hub.setTraceRecorder(&recorder);
+        for (int i = 0; i < kUpdates; ++i) {
+            hub.updateSignal(speed, static_cast<double>(i % 200));
+        }
+        hub.setTraceRecorder(nullptr);
+        recorder.stop();
+
+        const TraceRecorderStats stats = recorder.stats();
+        EXPECT_EQ(stats.records + stats.dropped, static_cast<quint64>(kUpdates));
+        EXPECT_FALSE(stats.writeFailed);
+        EXPECT_EQ(static_cast<qint64>(stats.bytesWritten), QFile(path).size());
+    }
+
+    SignalTraceReader reader;
+    ASSERT_TRUE(reader.open(path));
+    int count = 0;
+    TraceEvent event;
+    while (reader.next(event)) {
+        ++count;
+    }
+    EXPECT_GT(count, 0);
+    EXPECT_LE(count, kUpdates);
+}
+
+TEST_F(SignalTraceTest, LongTextIsTruncatedAtCharacterBoundary) {
+    SignalHub hub;
+    registerSignals(hub);
+    const SignalHandle gear = handleOf(hub, SignalIds::GEAR_POSITION);
+
+    // 80000 bytes of two-byte characters: the 65535-byte limit falls
+    // inside one
+    const QString longText(40000, QChar(0x00E9));
+    {
+        SignalTraceRecorder recorder;
+        ASSERT_TRUE(recorder.start(path, hub));
+        hub.setTraceRecorder(&recorder);
+        hub.updateSignal(gear, longText);
+        hub.setTraceRecorder(nullptr);
+        recorder.stop();
+        EXPECT_EQ(recorder.stats().records, 1u);
+    }
+
+    SignalTraceReader reader;
+    ASSERT_TRUE(reader.open(path));
+    TraceEvent event;
+    ASSERT_TRUE(reader.next(event));
+    EXPECT_EQ(event.text, longText.left(32767));
+    EXPECT_FALSE(event.text.contains(QChar(QChar::ReplacementCharacter)));
+}
+
+TEST_F(SignalTraceTest, RejectsForeignAndTruncatedFiles) {
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(QByteArray(64, 'x'));
+    }
+    SignalTraceReader reader;
+    QString error;
+    EXPECT_FALSE(reader.open(path, &error));
+    EXPECT_FALSE(reader.open(dir.filePath(QStringLiteral("missing.trace")), &error));
+
+    SignalHub hub;
+    registerSignals(hub);
+    recordDrive(hub);
+
+    QByteArray bytes;
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+        bytes = file.readAll();
+    }
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(bytes.left(bytes.size() - 5));  // Interrupted mid-record
+    }
+
+    ASSERT_TRUE(reader.open(path, &error));
+    int count = 0;
+    TraceEvent event;
+    while (reader.next(event)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 7);
+    EXPECT_TRUE(reader.isTruncated());
+}
@@ -0,0 +1,147 @@
+// test_signal_validation_kernel.cpp
+// Unit tests for the vectorized signal validation kernel
+// Tests: Clamping, range/rate masks, rate skip, ISA equivalence, NaN handling
+
+#include <gtest/gtest.h>
+#include "signal/SignalValidationKernel.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace automotive::signal;
+
+namespace {
+
+const double kInf = std::numeric_limits<double>::infinity();
+
+/**
+ * @brief Owns the arrays behind a NumericValidationBatch
+ */
+struct BatchData {
+    explicit BatchData(int count)
+        : values(count), minValues(count, -kInf), maxValues(count, kInf)
+        , previousValues(count), maxRates(count), deltaTimesMs(count)
+        , clampedValues(count), outOfRange((count + 63) / 64, ~quint64(0))
+        , rateViolation((count + 63) / 64, ~quint64(0))
+    {
+    }
+
+    NumericValidationBatch batch() {
+        NumericValidationBatch b;
+        b.count = static_cast<int>(values.size());
+        b.values = values.data();
+        b.minValues = minValues.data();
+        b.maxValues = maxValues.data();
+        b.previousValues = previousValues.data();
+        b.maxRates = maxRates.data();
+        b.deltaTimesMs = deltaTimesMs.data();
+        b.clampedValues = clampedValues.data();
+        b.outOfRangeMask = outOfRange.data();
+        b.rateViolationMask = rateViolation.data();
+        return b;
+    }
+
+    bool outOfRangeAt(int i) const { return (outOfRange[i / 64] >> (i % 64)) & 1u; }
+    bool rateViolationAt(int i) const { return (rateViolation[i / 64] >> (i % 64)) & 1u; }
+
+    std::vector<double> values;
+    std::vector<double> minValues;
+    std::vector<double> maxValues;
+    std::vector<double> previousValues;
+    std::vector<double> maxRates;
+    std::vector<double> deltaTimesMs;
+    std::vector<double> clampedValues;
+    std::vector<quint64> outOfRange;
+    std::vector<quint64> rateViolation;
+};
+
+} // namespace
+
+TEST(SignalValidationKernelTest, ClampsAndFlagsOutOfRangeValues) {
+    BatchData data(3);
+    data.values = {-5.0, 50.0, 500.0};
+    data.minValues = {0.0, 0.0, 0.0};
+    data.maxValues = {300.0, 300.0, 300.0};
+
+    validateNumericBatch(data.batch());
+
+    EXPECT_DOUBLE_EQ(data.clampedValues[0], 0.0);
+    EXPECT_DOUBLE_EQ(data.clampedValues[1], 50.0);
+    EXPECT_DOUBLE_EQ(data.clampedValues[2], 300.0);
+    EXPECT_TRUE(data.outOfRangeAt(0));
+    EXPECT_FALSE(data.outOfRangeAt(1));
+    EXPECT_TRUE(data.outOfRangeAt(2));
+    EXPECT_EQ(data.rateViolation[0], 0u);  // Masks are cleared first
+}
+
+TEST(SignalValidationKernelTest, UnboundedSignalsAreNeverOutOfRange) {
+    BatchData data(2);
+    data.values = {-1.0e300, 1.0e300};
+
+    validateNumericBatch(data.batch());
+
+    EXPECT_DOUBLE_EQ(data.clampedValues[0], -1.0e300);
+    EXPECT_DOUBLE_EQ(data.clampedValues[1], 1.0e300);
+    EXPECT_EQ(data.outOfRange[0], 0u);
+}
+
+TEST(SignalValidationKernelTest, RateCheckUsesDeltaTime) {
+    BatchData data(3);
+    data.values = {20.0, 20.0, 20.0};
+    data.previousValues = {0.0, 0.0, 0.0};
+    data.maxRates = {100.0, 100.0, 100.0};
+    data.deltaTimesMs = {100.0, 400.0, 0.0};  // 200/s, 50/s, skipped
+
+    validateNumericBatch(data.batch());
+
+    EXPECT_TRUE(data.rateViolationAt(0));
+    EXPECT_FALSE(data.rateViolationAt(1));
+    EXPECT_FALSE(data.rateViolationAt(2));
+}
+
+TEST(SignalValidationKernelTest, NaNIsInRangeButFailsRateCheck) {
+    BatchData data(2);
+    data.values = {std::nan(""), std::nan("")};
+    data.minValues = {0.0, 0.0};
+    data.maxValues = {10.0, 10.0};
+    data.maxRates = {1.0, 1.0};
+    data.deltaTimesMs = {10.0, 0.0};
+
+    validateNumericBatch(data.batch());
+
+    EXPECT_FALSE(data.outOfRangeAt(0));
+    EXPECT_TRUE(data.rateViolationAt(0));
+    EXPECT_FALSE(data.rateViolationAt(1));
+}
+
+TEST(SignalValidationKernelTest, AllIsasProduceIdenticalResults) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> dist(-200.0, 200.0);
+
+    for (int count : {1, 3, 4, 63, 64, 65, 517}) {
+        BatchData reference(count);
+        for (int i = 0; i < count; ++i) {
+            reference.values[i] = (i % 29 == 0) ? std::nan("") : dist(rng);
+            reference.minValues[i] = (i % 5 == 0) ? -kInf : -100.0;
+            reference.maxValues[i] = (i % 7 == 0) ? kInf : 100.0;
+            reference.previousValues[i] = dist(rng);
+            reference.maxRates[i] = (i % 3 == 0) ? 0.0 : 1000.0;
+            reference.deltaTimesMs[i] = (i % 4 == 0) ? 0.0 : 50.0 + i;
+        }
+
+        BatchData scalar = reference;
+        validateNumericBatch(scalar.batch(), ValidationKernelIsa::Scalar);
+
+        for (ValidationKernelIsa isa : {ValidationKernelIsa::Sse2, ValidationKernelIsa::Avx2}) {
+            BatchData vector = reference;
+            validateNumericBatch(vector.batch(), isa);
+
+            EXPECT_EQ(std::memcmp(vector.clampedValues.data(), scalar.clampedValues.data(),
+                                  count * sizeof(double)), 0) << validationKernelIsaName(isa);
+            EXPECT_EQ(vector.outOfRange, scalar.outOfRange) << validationKernelIsaName(isa);
+            EXPECT_EQ(vector.rateViolation, scalar.rateViolation) << validationKernelIsaName(isa);
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// signal_catalog_compiler.cpp
+// Offline compiler: JSON signal catalog -> binary catalog image
+// Usage: signal_catalog_compiler <catalog.json> <catalog.bin>
+//
+// DBC-derived catalogs are converted to the JSON form first; see
+// parseSignalCatalogJson() for the accepted fields.
+
+#include "signal/SignalCatalogImage.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QSaveFile>
+#include <cstdio>
+
+using namespace automotive::signal;
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    const QStringList args = app.arguments();
+    if (args.size() != 3) {
+        std::fprintf(stderr, "Usage: signal_catalog_compiler <catalog.json> <catalog.bin>\n");
+        return 2;
+    }
+
+    QFile input(args.at(1));
+    if (!input.open(QIODevice::ReadOnly)) {
+        std::fprintf(stderr, "Cannot read %s\n", qPrintable(args.at(1)));
+        return 1;
+    }
+
+    QVector<SignalDefinition> definitions;
+    quint32 catalogVersion = 0;
+    QString error;
+    if (!parseSignalCatalogJson(input.readAll(), &definitions, &catalogVersion, &error)) {
+        std::fprintf(stderr, "%s: %s\n", qPrintable(args.at(1)), qPrintable(error));
+        return 1;
+    }
+
+    const QByteArray image = buildSignalCatalogImage(definitions, catalogVersion);
+
+    // Verify before writing: the target loader must accept what we ship
+    if (!SignalCatalogImage::fromData(image, &error)) {
+        std::fprintf(stderr, "Generated image rejected: %s\n", qPrintable(error));
+        return 1;
+    }
+
+    QSaveFile output(args.at(2));
+    if (!output.open(QIODevice::WriteOnly) || output.write(image) != image.size() ||
+        !output.commit()) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(args.at(2)));
+        return 1;
+    }
+
+    std::printf("%s: %d signals, catalog version %u, %lld bytes\n",
+                qPrintable(args.at(2)), static_cast<int>(definitions.size()), catalogVersion,
+                static_cast<long long>(image.size()));
+    return 0;
+}